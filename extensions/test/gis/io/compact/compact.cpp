@@ -0,0 +1,245 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+#include <boost/geometry/extensions/gis/io/compact/read_compact.hpp>
+#include <boost/geometry/extensions/gis/io/compact/write_compact.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/write_wkb.hpp>
+
+
+typedef std::vector<boost::uint8_t> bytes_type;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::point<double, 3, bg::cs::cartesian> point3d_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+template <typename Geometry>
+std::string to_wkt(Geometry const& geometry)
+{
+    std::ostringstream out;
+    out << bg::wkt(geometry);
+    return out.str();
+}
+
+template <typename Geometry>
+bytes_type write(Geometry const& geometry,
+                 bg::compact_options const& options = bg::compact_options())
+{
+    bytes_type result;
+    bg::write_compact(geometry, std::back_inserter(result), options);
+    return result;
+}
+
+// Without quantization the coordinates are restored exactly
+template <typename Geometry>
+void test_round_trip(std::string const& wkt)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bytes_type const bytes = write(geometry);
+    Geometry result;
+    BOOST_CHECK(bg::read_compact(bytes.begin(), bytes.end(), result));
+    BOOST_CHECK_EQUAL(to_wkt(result), to_wkt(geometry));
+    BOOST_CHECK(write(result) == bytes);
+
+    // without envelope, from a pointer
+    bg::compact_options options;
+    options.envelope = false;
+    bytes_type const bare = write(geometry, options);
+    BOOST_CHECK(bare.size() <= bytes.size());
+    Geometry bare_result;
+    BOOST_CHECK(bg::read_compact(&bare[0], &bare[0] + bare.size(), bare_result));
+    BOOST_CHECK_EQUAL(to_wkt(bare_result), to_wkt(geometry));
+
+    // truncated
+    for (std::size_t i = 0; i < bytes.size(); i++)
+    {
+        BOOST_CHECK(! bg::read_compact(bytes.begin(), bytes.begin() + i, result));
+    }
+}
+
+template <typename Geometry>
+void test_quantized(std::string const& wkt, int precision, std::string const& expected)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bytes_type const bytes = write(geometry, bg::compact_options(precision));
+    Geometry result;
+    BOOST_CHECK(bg::read_compact(bytes.begin(), bytes.end(), result));
+    BOOST_CHECK_EQUAL(to_wkt(result), expected);
+}
+
+void test_sizes()
+{
+    // a ring of 1000 points with a step of about 1 meter
+    polygon_type polygon;
+    for (int i = 0; i < 1000; i++)
+    {
+        double const angle = 2 * bg::math::pi<double>() * i / 1000;
+        bg::append(polygon, point_type(500000.123 + 160 * std::cos(angle),
+                                       4649776.22 + 160 * std::sin(angle)));
+    }
+    bg::append(polygon, bg::range::front(bg::exterior_ring(polygon)));
+
+    bytes_type wkb;
+    bg::write_wkb(polygon, std::back_inserter(wkb));
+    bytes_type const lossless = write(polygon);
+    bytes_type const quantized = write(polygon, bg::compact_options(3));
+
+    BOOST_CHECK(lossless.size() < wkb.size());
+    // 3 bytes per coordinate instead of 8
+    BOOST_CHECK(quantized.size() * 2 < wkb.size());
+
+    polygon_type result;
+    BOOST_CHECK(bg::read_compact(quantized.begin(), quantized.end(), result));
+    BOOST_CHECK_EQUAL(bg::num_points(result), 1001u);
+    BOOST_CHECK_CLOSE(bg::area(result), bg::area(polygon), 0.001);
+}
+
+void test_dimensions()
+{
+    point3d_type const p3(1.5, 2.5, 3.5);
+    bytes_type const bytes = write(p3);
+    point_type p2;
+    BOOST_CHECK(bg::read_compact(bytes.begin(), bytes.end(), p2));
+    BOOST_CHECK_EQUAL(bg::get<0>(p2), 1.5);
+    BOOST_CHECK_EQUAL(bg::get<1>(p2), 2.5);
+
+    point3d_type result(9, 9, 9);
+    bytes_type const bytes2 = write(p2);
+    BOOST_CHECK(bg::read_compact(bytes2.begin(), bytes2.end(), result));
+    BOOST_CHECK_EQUAL(bg::get<2>(result), 0.0);
+}
+
+void test_errors()
+{
+    bytes_type const bytes = write(linestring_type());
+    polygon_type polygon;
+    BOOST_CHECK(! bg::read_compact(bytes.begin(), bytes.end(), polygon));
+
+    bool thrown = false;
+    try
+    {
+        write(point_type(1e300, 0), bg::compact_options(2));
+    }
+    catch (bg::compact_exception const& )
+    {
+        thrown = true;
+    }
+    BOOST_CHECK(thrown);
+
+    // a count larger than the remaining bytes doesn't allocate
+    bytes_type corrupted = write(linestring_type());
+    corrupted.back() = 0xff;
+    corrupted.push_back(0xff);
+    corrupted.push_back(0x7f);
+    linestring_type linestring;
+    BOOST_CHECK(! bg::read_compact(corrupted.begin(), corrupted.end(), linestring));
+}
+
+void test_reader()
+{
+    bytes_type buffer;
+    std::back_insert_iterator<bytes_type> out(buffer);
+    char const* const wkts[] = {
+        "POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 2))",
+        "POLYGON((20 20,20 25,25 25,25 20,20 20))",
+        "POLYGON((40 0,40 5,45 5,45 0,40 0))"
+    };
+    for (int i = 0; i < 3; i++)
+    {
+        polygon_type polygon;
+        bg::read_wkt(wkts[i], polygon);
+        out = bg::write_compact(polygon, out, bg::compact_options(2));
+    }
+    out = bg::write_compact(linestring_type(), out);
+    out = bg::write_compact(box_type(point_type(0, 1), point_type(2, 3)), out);
+
+    bg::compact_reader reader(&buffer[0], &buffer[0] + buffer.size());
+    box_type const query(point_type(19, -1), point_type(50, 50));
+    polygon_type polygon;
+    double area = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        box_type envelope;
+        BOOST_CHECK(reader.envelope(envelope));
+        if (bg::intersects(envelope, query))
+        {
+            BOOST_CHECK(reader.next(polygon));
+            area += bg::area(polygon);
+        }
+        else
+        {
+            reader.skip();
+        }
+    }
+    BOOST_CHECK_EQUAL(area, 50.0);
+
+    // empty geometries have no envelope
+    box_type box;
+    BOOST_CHECK(! reader.envelope(box));
+    reader.skip();
+
+    BOOST_CHECK(reader.envelope(box));
+    BOOST_CHECK(reader.next(box));
+    BOOST_CHECK(bg::equals(box, box_type(point_type(0, 1), point_type(2, 3))));
+    BOOST_CHECK(reader.done());
+    BOOST_CHECK(! reader.next(box));
+    BOOST_CHECK_EQUAL(reader.offset(), buffer.size());
+}
+
+int test_main(int, char* [])
+{
+    test_round_trip<point_type>("POINT(1.25 -2.5)");
+    test_round_trip<linestring_type>("LINESTRING(0 0,0.1 0.2,-0.3 1e-300,1e300 -1e300)");
+    test_round_trip<linestring_type>("LINESTRING()");
+    test_round_trip<bg::model::ring<point_type> >("POLYGON((0 0,0 1,1 1,1 0,0 0))");
+    test_round_trip<polygon_type>("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 2))");
+    test_round_trip<bg::model::multi_point<point_type> >("MULTIPOINT((1 2),(3 4))");
+    test_round_trip<bg::model::multi_linestring<linestring_type> >(
+        "MULTILINESTRING((0 0,1 1),(2 2,3 3,4 5))");
+    test_round_trip<multi_polygon_type>(
+        "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 2)),((20 20,20 21,21 21,20 20)))");
+    test_round_trip<box_type>("BOX(-1 -2,3 4)");
+    test_round_trip<bg::model::segment<point_type> >("SEGMENT(1 2,3 4)");
+    test_round_trip<bg::model::linestring<point3d_type> >("LINESTRING(0 0 1,1 1 2)");
+    // float and 32-bit integers are converted to double exactly
+    test_round_trip<bg::model::point<float, 2, bg::cs::cartesian> >("POINT(0.1 -3e30)");
+    test_round_trip<bg::model::linestring<bg::model::point<boost::int32_t, 2, bg::cs::cartesian> > >(
+        "LINESTRING(2147483647 -2147483648,1 -1)");
+
+    test_quantized<linestring_type>("LINESTRING(0.123 1.987,-5.555 2)", 2,
+                                    "LINESTRING(0.12 1.99,-5.55 2)");
+    test_quantized<point_type>("POINT(1234 -5678)", -2, "POINT(1200 -5700)");
+
+    test_sizes();
+    test_dimensions();
+    test_errors();
+    test_reader();
+
+    return 0;
+}
@@ -0,0 +1,203 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/strategies/transform/matrix_transformers.hpp>
+#include <boost/geometry/extensions/gis/io/mvt/encode_mvt.hpp>
+
+
+typedef std::vector<boost::uint32_t> commands_type;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::model::polygon<point_type> polygon_type;
+
+std::string to_string(commands_type const& commands)
+{
+    std::ostringstream out;
+    for (std::size_t i = 0; i < commands.size(); i++)
+    {
+        out << (i > 0 ? "," : "") << commands[i];
+    }
+    return out.str();
+}
+
+// Geometries in tile coordinates
+template <typename Geometry>
+void test_encode(std::string const& wkt, bg::mvt_geometry_type::enum_t type,
+                 std::string const& expected)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+
+    bg::strategy::transform::translate_transformer<double, 2, 2> const identity(0, 0);
+    commands_type commands;
+    BOOST_CHECK_EQUAL(bg::encode_mvt(geometry, identity, commands), type);
+    BOOST_CHECK_MESSAGE(to_string(commands) == expected,
+        wkt << " -> " << to_string(commands) << " expected " << expected);
+}
+
+// Twice the areas of the rings, positive for exterior rings
+// Counts the points outside of (0, 0) (10, 10)
+std::vector<long> ring_areas(commands_type const& commands, long* outside = 0)
+{
+    std::vector<long> result;
+    long x = 0, y = 0, fx = 0, fy = 0, area = 0;
+    for (std::size_t i = 0; i < commands.size(); )
+    {
+        boost::uint32_t const id = commands[i] & 7;
+        boost::uint32_t const count = commands[i] >> 3;
+        ++i;
+        if (id == 7)
+        {
+            area += x * fy - fx * y;
+            result.push_back(area);
+            continue;
+        }
+        for (boost::uint32_t c = 0; c < count; c++, i += 2)
+        {
+            long const nx = x + bg::detail::mvt::parameter_value(commands[i]);
+            long const ny = y + bg::detail::mvt::parameter_value(commands[i + 1]);
+            if (id == 1)
+            {
+                fx = nx;
+                fy = ny;
+                area = 0;
+            }
+            else
+            {
+                area += x * ny - nx * y;
+            }
+            x = nx;
+            y = ny;
+            if (outside != 0 && (x < 0 || y < 0 || x > 10 || y > 10))
+            {
+                ++*outside;
+            }
+        }
+    }
+    return result;
+}
+
+void test_orientation()
+{
+    // counterclockwise exterior and clockwise interior in tile coordinates
+    bg::model::polygon<point_type, false> polygon;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 4,2 2))", polygon);
+
+    bg::strategy::transform::translate_transformer<double, 2, 2> const identity(0, 0);
+    commands_type commands;
+    BOOST_CHECK_EQUAL(bg::encode_mvt(polygon, identity, commands),
+                      bg::mvt_geometry_type::polygon);
+    std::vector<long> const areas = ring_areas(commands);
+    BOOST_CHECK_EQUAL(areas.size(), 2u);
+    BOOST_CHECK_EQUAL(areas.front(), 200);
+    BOOST_CHECK_EQUAL(areas.back(), -8);
+
+    // the cursor continues after the reversed ring
+    bg::model::multi_polygon<bg::model::polygon<point_type, false> > multi;
+    multi.push_back(polygon);
+    multi.push_back(polygon);
+    commands.clear();
+    bg::encode_mvt(multi, identity, commands);
+    long outside = 0;
+    std::vector<long> const multi_areas = ring_areas(commands, &outside);
+    BOOST_CHECK_EQUAL(multi_areas.size(), 4u);
+    BOOST_CHECK_EQUAL(multi_areas[2], 200);
+    BOOST_CHECK_EQUAL(multi_areas[3], -8);
+    BOOST_CHECK_EQUAL(outside, 0);
+}
+
+void test_tile()
+{
+    box_type const tile(point_type(1000, 2000), point_type(1100, 2100));
+    commands_type commands;
+
+    // y downwards, 40.96 units per meter
+    BOOST_CHECK_EQUAL(bg::encode_mvt(point_type(1050, 2075), tile, 4096, commands),
+                      bg::mvt_geometry_type::point);
+    BOOST_CHECK_EQUAL(to_string(commands), "9,4096,2048");
+
+    // the commands are appended
+    polygon_type polygon;
+    bg::read_wkt("POLYGON((1000 2000,1000 2100,1100 2100,1100 2000,1000 2000))", polygon);
+    BOOST_CHECK_EQUAL(bg::encode_mvt(polygon, tile, 4096, commands),
+                      bg::mvt_geometry_type::polygon);
+    BOOST_CHECK_EQUAL(ring_areas(commands).size(), 1u);
+    BOOST_CHECK_EQUAL(ring_areas(commands).front(), 2L * 4096 * 4096);
+
+    // collapsed polygon, the buffer is unchanged
+    std::size_t const size = commands.size();
+    bg::read_wkt("POLYGON((1000 2000,1000 2000.01,1000.01 2000.01,1000 2000))", polygon);
+    BOOST_CHECK_EQUAL(bg::encode_mvt(polygon, tile, 4096, commands),
+                      bg::mvt_geometry_type::unknown);
+    BOOST_CHECK_EQUAL(commands.size(), size);
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::mvt_geometry_type type;
+
+    // Examples of the vector tile specification
+    test_encode<point_type>("POINT(25 17)", type::point, "9,50,34");
+    test_encode<bg::model::multi_point<point_type> >("MULTIPOINT((5 7),(3 2))",
+        type::point, "17,10,14,3,9");
+    test_encode<bg::model::linestring<point_type> >("LINESTRING(2 2,2 10,10 10)",
+        type::linestring, "9,4,4,18,0,16,16,0");
+    test_encode<bg::model::multi_linestring<bg::model::linestring<point_type> > >(
+        "MULTILINESTRING((2 2,2 10,10 10),(1 1,3 5))",
+        type::linestring, "9,4,4,18,0,16,16,0,9,17,17,10,4,8");
+    test_encode<polygon_type>("POLYGON((3 6,8 12,20 34,3 6))",
+        type::polygon, "9,6,12,18,10,12,24,44,15");
+    test_encode<bg::model::multi_polygon<polygon_type> >(
+        "MULTIPOLYGON(((0 0,10 0,10 10,0 10,0 0)),"
+        "((11 11,20 11,20 20,11 20,11 11),(13 13,13 17,17 17,17 13,13 13)))",
+        type::polygon,
+        "9,0,0,26,20,0,0,20,19,0,15,9,22,2,26,18,0,0,18,17,0,15,9,4,13,26,0,8,8,0,0,7,15");
+
+    // coordinates clamped to -(2^30 - 1) and 2^30 - 1, the differences
+    // of 2^31 - 2 are not continuing each other
+    test_encode<bg::model::linestring<point_type> >(
+        "LINESTRING(-1e10 -1e10,1e10 1e10)", type::linestring,
+        "9,2147483645,2147483645,10,4294967292,4294967292");
+    test_encode<bg::model::linestring<point_type> >(
+        "LINESTRING(-1e10 0,1e10 0,-1e10 0)", type::linestring,
+        "9,2147483645,0,18,4294967292,0,4294967291,0");
+
+    // duplicate and collinear points created by rounding
+    test_encode<bg::model::linestring<point_type> >(
+        "LINESTRING(0 0,0.2 0.1,1 0,2 0.4,3 0)", type::linestring, "9,0,0,10,6,0");
+    // going back is kept
+    test_encode<bg::model::linestring<point_type> >(
+        "LINESTRING(0 0,2 0,1 0)", type::linestring, "9,0,0,18,4,0,1,0");
+    test_encode<bg::model::linestring<point_type> >(
+        "LINESTRING(0 0,0.1 0.1)", type::unknown, "");
+    test_encode<bg::model::multi_point<point_type> >("MULTIPOINT((5 7),(5.1 7),(3 2))",
+        type::point, "17,10,14,3,9");
+    // collapsed interior ring
+    test_encode<polygon_type>("POLYGON((3 6,8 12,20 34,3 6),(9 14,9.1 14.1,9.2 14,9 14))",
+        type::polygon, "9,6,12,18,10,12,24,44,15");
+    // open ring
+    test_encode<bg::model::ring<point_type, true, false> >("POLYGON((3 6,8 12,20 34))",
+        type::polygon, "9,6,12,18,10,12,24,44,15");
+
+    test_orientation();
+    test_tile();
+
+    return 0;
+}
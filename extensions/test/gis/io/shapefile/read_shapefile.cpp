@@ -0,0 +1,389 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/extensions/gis/io/shapefile/read_shapefile.hpp>
+
+namespace bgi = bg::index;
+
+
+// Writes the records of a shapefile and its index, on little endian
+// platforms
+struct shapefile_writer
+{
+    typedef std::vector<std::pair<double, double> > points_type;
+
+    explicit shapefile_writer(int type)
+        : m_type(type)
+    {
+        m_shp.resize(100, 0);
+        m_shx.resize(100, 0);
+    }
+
+    void add_null()
+    {
+        std::string content(4, 0);
+        add(content);
+    }
+
+    void add_point(double x, double y, double z)
+    {
+        std::string content;
+        append(content, boost::int32_t(11));
+        append(content, x);
+        append(content, y);
+        append(content, z);
+        append(content, 0.0);
+        add(content);
+    }
+
+    // A point record with only the first coordinates
+    void add_short_point(boost::int32_t type, int coordinates)
+    {
+        std::string content;
+        append(content, type);
+        for (int i = 0; i < coordinates; ++i)
+        {
+            append(content, double(i));
+        }
+        add(content);
+    }
+
+    void add_parts(int type, std::vector<points_type> const& parts)
+    {
+        std::string content;
+        append(content, boost::int32_t(type));
+        double box[4] = { 1e300, 1e300, -1e300, -1e300 };
+        boost::int32_t num_points = 0;
+        for (std::size_t p = 0; p < parts.size(); ++p)
+        {
+            for (std::size_t i = 0; i < parts[p].size(); ++i)
+            {
+                box[0] = (std::min)(box[0], parts[p][i].first);
+                box[1] = (std::min)(box[1], parts[p][i].second);
+                box[2] = (std::max)(box[2], parts[p][i].first);
+                box[3] = (std::max)(box[3], parts[p][i].second);
+            }
+        }
+        for (int i = 0; i < 4; ++i)
+        {
+            append(content, box[i]);
+        }
+        append(content, boost::int32_t(parts.size()));
+        std::string points;
+        for (std::size_t p = 0; p < parts.size(); ++p)
+        {
+            append(content, num_points);
+            for (std::size_t i = 0; i < parts[p].size(); ++i, ++num_points)
+            {
+                append(points, parts[p][i].first);
+                append(points, parts[p][i].second);
+            }
+        }
+        content.insert(4 + 32 + 4, std::string(reinterpret_cast<char const*>(&num_points), 4));
+        add(content + points);
+    }
+
+    void write(std::string const& name, bool with_index)
+    {
+        header(m_shp);
+        header(m_shx);
+        std::ofstream(name.c_str(), std::ios::binary).write(m_shp.data(), m_shp.size());
+        std::string const index_name = name.substr(0, name.size() - 1) + "x";
+        std::remove(index_name.c_str());
+        if (with_index)
+        {
+            std::ofstream(index_name.c_str(), std::ios::binary).write(m_shx.data(), m_shx.size());
+        }
+    }
+
+private:
+    template <typename T>
+    static void append(std::string& s, T const& value)
+    {
+        s.append(reinterpret_cast<char const*>(&value), sizeof(T));
+    }
+
+    static void append_be(std::string& s, boost::int32_t value)
+    {
+        for (int i = 3; i >= 0; --i)
+        {
+            s += char((value >> (8 * i)) & 0xff);
+        }
+    }
+
+    void add(std::string const& content)
+    {
+        append_be(m_shx, boost::int32_t(m_shp.size() / 2));
+        append_be(m_shx, boost::int32_t(content.size() / 2));
+        append_be(m_shp, boost::int32_t(m_shx.size() / 8 - 12));
+        append_be(m_shp, boost::int32_t(content.size() / 2));
+        m_shp += content;
+    }
+
+    void header(std::string& file)
+    {
+        std::string h;
+        append_be(h, 9994);
+        h.resize(24, 0);
+        append_be(h, boost::int32_t(file.size() / 2));
+        append(h, boost::int32_t(1000));
+        append(h, boost::int32_t(m_type));
+        double const box[4] = { 0, 0, 30, 30 };
+        h.append(reinterpret_cast<char const*>(box), sizeof(box));
+        h.resize(100, 0);
+        file.replace(0, 100, h);
+    }
+
+    int m_type;
+    std::string m_shp;
+    std::string m_shx;
+};
+
+shapefile_writer::points_type square(double x, double y, double size, bool clockwise)
+{
+    shapefile_writer::points_type result;
+    result.push_back(std::make_pair(x, y));
+    if (clockwise)
+    {
+        result.push_back(std::make_pair(x, y + size));
+        result.push_back(std::make_pair(x + size, y + size));
+        result.push_back(std::make_pair(x + size, y));
+    }
+    else
+    {
+        result.push_back(std::make_pair(x + size, y));
+        result.push_back(std::make_pair(x + size, y + size));
+        result.push_back(std::make_pair(x, y + size));
+    }
+    result.push_back(std::make_pair(x, y));
+    return result;
+}
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+typedef bg::model::linestring<point_type> linestring_type;
+
+// 0: polygon with a hole, 1: null, 2: two polygons, 3: polyline, 4: point z
+void write_test_file(std::string const& name, bool with_index)
+{
+    shapefile_writer writer(5);
+
+    std::vector<shapefile_writer::points_type> parts;
+    parts.push_back(square(0, 0, 10, true));
+    parts.push_back(square(2, 2, 2, false));
+    writer.add_parts(5, parts);
+
+    writer.add_null();
+
+    parts.clear();
+    parts.push_back(square(20, 20, 5, true));
+    parts.push_back(square(20, 0, 2, true));
+    parts.push_back(square(20.5, 0.5, 1, false));
+    writer.add_parts(5, parts);
+
+    parts.clear();
+    parts.push_back(square(0, 20, 3, true));
+    writer.add_parts(3, parts);
+
+    writer.add_point(5, 25, 7);
+
+    writer.write(name, with_index);
+}
+
+template <typename Exception, typename Geometry>
+void test_wrong(bg::shapefile_reader const& reader, std::size_t index)
+{
+    Geometry geometry;
+    bool thrown = false;
+    try
+    {
+        reader.read(index, geometry);
+    }
+    catch(Exception const&)
+    {
+        thrown = true;
+    }
+    BOOST_CHECK(thrown);
+}
+
+void test_reader(std::string const& name)
+{
+    bg::shapefile_reader reader(name);
+    BOOST_CHECK_EQUAL(reader.size(), 5u);
+    BOOST_CHECK_EQUAL(reader.shape_type(), 5);
+    BOOST_CHECK(reader.is_null(1));
+
+    polygon_type polygon;
+    reader.read(0, polygon);
+    BOOST_CHECK_EQUAL(polygon.inners().size(), 1u);
+    BOOST_CHECK_EQUAL(bg::area(polygon), 96.0);
+
+    multi_polygon_type multi_polygon;
+    reader.read(2, multi_polygon);
+    BOOST_CHECK_EQUAL(multi_polygon.size(), 2u);
+    BOOST_CHECK_EQUAL(bg::area(multi_polygon), 25.0 + 4.0 - 1.0);
+    BOOST_CHECK_EQUAL(multi_polygon[1].inners().size(), 1u);
+
+    // the memory is reused
+    reader.read(0, multi_polygon);
+    BOOST_CHECK_EQUAL(multi_polygon.size(), 1u);
+    BOOST_CHECK_EQUAL(bg::area(multi_polygon), 96.0);
+
+    // rings of polygons with other orientation and closure
+    bg::model::polygon<point_type, false, false> ccw_open;
+    reader.read(0, ccw_open);
+    BOOST_CHECK_EQUAL(ccw_open.outer().size(), 4u);
+    BOOST_CHECK_EQUAL(bg::area(ccw_open), 96.0);
+
+    linestring_type linestring;
+    reader.read(3, linestring);
+    BOOST_CHECK_EQUAL(linestring.size(), 5u);
+    BOOST_CHECK_EQUAL(bg::length(linestring), 12.0);
+
+    bg::model::point<double, 3, bg::cs::cartesian> point3d;
+    reader.read(4, point3d);
+    BOOST_CHECK_EQUAL(bg::get<2>(point3d), 7.0);
+
+    test_wrong<bg::read_shapefile_exception, polygon_type>(reader, 2);
+    test_wrong<bg::read_shapefile_exception, linestring_type>(reader, 0);
+    test_wrong<bg::read_shapefile_exception, polygon_type>(reader, 5);
+
+    // rtree of the boxes stored in the records
+    typedef std::pair<box_type, std::size_t> value_type;
+    std::vector<value_type> values;
+    reader.envelopes<box_type>(std::back_inserter(values));
+    BOOST_CHECK_EQUAL(values.size(), 4u);
+
+    bgi::rtree<value_type, bgi::rstar<4> > rtree(values);
+    std::vector<value_type> found;
+    rtree.query(bgi::intersects(point_type(21, 1)), std::back_inserter(found));
+    BOOST_CHECK_EQUAL(found.size(), 1u);
+    BOOST_CHECK_EQUAL(found.front().second, 2u);
+
+    box_type box;
+    reader.envelope(box);
+    BOOST_CHECK(bg::equals(box, box_type(point_type(0, 0), point_type(30, 30))));
+    BOOST_CHECK(reader.envelope(4, box));
+    BOOST_CHECK(bg::equals(box, box_type(point_type(5, 25), point_type(5, 25))));
+
+    // parts read in place
+    BOOST_CHECK_EQUAL(reader.num_parts(2), 3u);
+    bg::wkb_ring_view<> ring = reader.part_view<bg::wkb_ring_view<> >(2, 1);
+    BOOST_CHECK_EQUAL(bg::area(ring), 4.0);
+    bg::wkb_linestring_view<> line = reader.part_view<bg::wkb_linestring_view<> >(3, 0);
+    BOOST_CHECK_EQUAL(bg::length(line), 12.0);
+}
+
+// Overwrites the content length of the first record, or truncates the file
+// inside the last record, and checks the file is rejected without index
+void test_corrupted(std::string const& name, boost::int32_t length, bool truncate)
+{
+    write_test_file(name, false);
+    std::string content;
+    {
+        std::ifstream in(name.c_str(), std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(in),
+                       std::istreambuf_iterator<char>());
+    }
+    if (truncate)
+    {
+        content.resize(content.size() - 10);
+    }
+    else
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            content[100 + 4 + i] = char((length >> (8 * (3 - i))) & 0xff);
+        }
+    }
+    std::ofstream(name.c_str(), std::ios::binary).write(content.data(), content.size());
+
+    bool thrown = false;
+    try
+    {
+        bg::shapefile_reader reader(name);
+    }
+    catch(bg::read_shapefile_exception const&)
+    {
+        thrown = true;
+    }
+    BOOST_CHECK(thrown);
+}
+
+// Point records shorter than their coordinates
+void test_short_points(std::string const& name)
+{
+    shapefile_writer writer(1);
+    writer.add_short_point(1, 2);
+    writer.add_short_point(1, 1);
+    writer.add_short_point(11, 2);
+    writer.add_short_point(11, 3);
+    writer.write(name, true);
+
+    bg::shapefile_reader reader(name);
+    point_type point;
+    reader.read(0, point);
+    BOOST_CHECK(bg::equals(point, point_type(0, 1)));
+    test_wrong<bg::read_shapefile_exception, point_type>(reader, 1);
+    test_wrong<bg::read_shapefile_exception, point_type>(reader, 2);
+    reader.read(3, point);
+    BOOST_CHECK(bg::equals(point, point_type(0, 1)));
+}
+
+int test_main(int, char* [])
+{
+    std::string const name = "read_shapefile_test.shp";
+
+    write_test_file(name, true);
+    test_reader(name);
+
+    write_test_file(name, false);
+    test_reader(name);
+
+    bool thrown = false;
+    try
+    {
+        bg::shapefile_reader reader(name + ".missing");
+    }
+    catch(bg::read_shapefile_exception const&)
+    {
+        thrown = true;
+    }
+    BOOST_CHECK(thrown);
+
+    // lengths wrapping the offset around, moving it back or beyond the file
+    test_corrupted(name, -4, false);
+    test_corrupted(name, -100, false);
+    test_corrupted(name, 0x7fffffff, false);
+    test_corrupted(name, 0, true);
+
+    test_short_points(name);
+
+    std::remove(name.c_str());
+
+    return 0;
+}
@@ -17,6 +17,7 @@
 #include <boost/cstdint.hpp>
 #include <boost/geometry/strategies/strategies.hpp>
 
+#include <boost/geometry/algorithms/area.hpp>
 #include <boost/geometry/algorithms/equals.hpp>
 #include <boost/geometry/geometries/geometries.hpp>
 #include <boost/geometry/io/wkt/read.hpp>
@@ -96,6 +97,125 @@ void test_geometry_equals(Geometry const& g_expected, std::string const& wkbhex)
 //    bg::read_wkb(wkb, poly);
 //}
 
+// SRID=4326;MULTIPOLYGON Z(((0 0 1,0 4 1,4 4 1,4 0 1,0 0 1),(1 1 1,2 1 1,2 2 1,1 1 1)),
+// ((10 10 2,10 12 2,12 12 2,10 10 2))) with the second polygon in big endian
+std::string const ewkb_multipolygon =
+"01060000A0E6100000020000000103000080020000000500000000000000000000000000000000000000000000000000F03F"
+"00000000000000000000000000001040000000000000F03F00000000000010400000000000001040000000000000F03F0000"
+"0000000010400000000000000000000000000000F03F00000000000000000000000000000000000000000000F03F04000000"
+"000000000000F03F000000000000F03F000000000000F03F0000000000000040000000000000F03F000000000000F03F0000"
+"0000000000400000000000000040000000000000F03F000000000000F03F000000000000F03F000000000000F03F00800000"
+"0300000001000000044024000000000000402400000000000040000000000000004024000000000000402800000000000040"
+"0000000000000040280000000000004028000000000000400000000000000040240000000000004024000000000000400000"
+"0000000000";
+
+void test_ewkb()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+    typedef bg::model::point<double, 3, bg::cs::cartesian> point3d_type;
+    typedef bg::model::polygon<point_type> polygon_type;
+    typedef bg::model::multi_polygon<polygon_type> multipolygon_type;
+    typedef bg::model::multi_polygon<bg::model::polygon<point3d_type> > multipolygon3d_type;
+
+    byte_vector wkb;
+    BOOST_CHECK( bg::hex2wkb(ewkb_multipolygon, std::back_inserter(wkb)) );
+
+    multipolygon_type mpoly;
+    boost::uint32_t srid = 0;
+    BOOST_CHECK( bg::read_wkb(wkb.begin(), wkb.end(), mpoly, srid) );
+    BOOST_CHECK_EQUAL( srid, 4326u );
+    BOOST_CHECK_EQUAL( mpoly.size(), 2u );
+    BOOST_CHECK_CLOSE( bg::area(mpoly), 16.0 - 0.5 + 2.0, 1e-10 );
+
+    multipolygon3d_type mpoly3d;
+    BOOST_CHECK( bg::read_wkb(&wkb[0], wkb.size(), mpoly3d) );
+    BOOST_CHECK_EQUAL( bg::get<2>(mpoly3d[0].inners()[0][1]), 1.0 );
+    BOOST_CHECK( bg::equals(mpoly3d[1].outer()[2], point3d_type(12, 12, 2)) );
+
+    // the multipolygon is reused, also if it had more polygons
+    mpoly.resize(5);
+    BOOST_CHECK( bg::read_wkb(&wkb[0], wkb.size(), mpoly) );
+    BOOST_CHECK_EQUAL( mpoly.size(), 2u );
+    BOOST_CHECK_EQUAL( mpoly[1].inners().size(), 0u );
+
+    // truncated
+    BOOST_CHECK( ! bg::read_wkb(&wkb[0], wkb.size() - 1, mpoly) );
+    BOOST_CHECK( ! bg::read_wkb(wkb.begin(), wkb.end() - 1, mpoly) );
+
+    // ISO WKB POINT ZM(1 2 3 4)
+    wkb.clear();
+    BOOST_CHECK( bg::hex2wkb("01B90B0000000000000000F03F000000000000004000000000000008400000000000001040",
+                             std::back_inserter(wkb)) );
+    point3d_type p;
+    BOOST_CHECK( bg::read_wkb(wkb.begin(), wkb.end(), p, srid) );
+    BOOST_CHECK_EQUAL( srid, 0u );
+    BOOST_CHECK( bg::equals(p, point3d_type(1, 2, 3)) );
+
+    // POINT(1 2) read as 3D
+    wkb.clear();
+    BOOST_CHECK( bg::hex2wkb("0101000000000000000000F03F0000000000000040",
+                             std::back_inserter(wkb)) );
+    BOOST_CHECK( bg::read_wkb(&wkb[0], wkb.size(), p) );
+    BOOST_CHECK( bg::equals(p, point3d_type(1, 2, 0)) );
+}
+
+void test_reader()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+    typedef bg::model::linestring<point_type> linestring_type;
+
+    // LINESTRING(1 2,3 4) in little and big endian
+    byte_vector wkb;
+    BOOST_CHECK( bg::hex2wkb(
+"010200000002000000000000000000F03F000000000000004000000000000008400000000000001040"
+"000000000200000002" "3FF00000000000004000000000000000" "40080000000000004010000000000000",
+        std::back_inserter(wkb)) );
+
+    bg::wkb_reader reader(&wkb[0], &wkb[0] + wkb.size());
+    linestring_type ls;
+    BOOST_CHECK( reader.next(ls) );
+    BOOST_CHECK_EQUAL( reader.offset(), 41u );
+    BOOST_CHECK( reader.next(ls) );
+    BOOST_CHECK_EQUAL( ls.size(), 2u );
+    BOOST_CHECK( bg::equals(ls[1], point_type(3, 4)) );
+    BOOST_CHECK( ! reader.next(ls) );
+
+    // POLYGON((0 0,0 4,4 4,4 0,0 0),(1 1,2 1,2 2,1 2,1 1)) twice, the rings
+    // of the polygon are reused
+    typedef bg::model::polygon<point_type> polygon_type;
+    std::string const polygon_hex =
+"01030000000200000005000000000000000000000000000000000000000000000000000000"
+"00000000000010400000000000001040000000000000104000000000000010400000000000"
+"0000000000000000000000000000000000000005000000000000000000F03F000000000000"
+"F03F0000000000000040000000000000F03F00000000000000400000000000000040000000"
+"000000F03F0000000000000040000000000000F03F000000000000F03F";
+    byte_vector polygon_wkb;
+    BOOST_CHECK( bg::hex2wkb(polygon_hex + polygon_hex,
+                             std::back_inserter(polygon_wkb)) );
+    bg::wkb_reader polygon_reader(&polygon_wkb[0],
+                                  &polygon_wkb[0] + polygon_wkb.size());
+    polygon_type polygon;
+    BOOST_CHECK( polygon_reader.next(polygon) );
+    point_type const* const hole_points = &polygon.inners().front().front();
+    BOOST_CHECK( polygon_reader.next(polygon) );
+    BOOST_CHECK_EQUAL( polygon.inners().size(), 1u );
+    BOOST_CHECK( &polygon.inners().front().front() == hole_points );
+    BOOST_CHECK_EQUAL( bg::area(polygon), 15.0 );
+
+    // truncated record
+    bg::wkb_reader truncated(&wkb[0], &wkb[0] + 30);
+    bool thrown = false;
+    try
+    {
+        truncated.next(ls);
+    }
+    catch(bg::read_wkb_exception const&)
+    {
+        thrown = true;
+    }
+    BOOST_CHECK( thrown );
+}
+
 } // namespace anonymous
 
 int test_main(int, char* [])
@@ -114,35 +234,35 @@ int test_main(int, char* [])
         test_geometry_equals_old<point3d_type, true>(
             "01E90300005839B4C876BEF33F83C0CAA145B616404F401361C3332240", "POINT(1.234 5.678 9.1011)");
 
-        //     // XYZ - POINT(1.234 5.678 99) - Z coordinate ignored
-        //     test_geometry_equals<point_type, true>(
-        //         "01010000805839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT(1.234 5.678)");
-        // 
-        //     // SRID=32632;POINT(1.234 5.678) - PostGIS EWKT
-        //     test_geometry_equals<point_type, false>(
-        //         "0101000020787F00005839B4C876BEF33F83C0CAA145B61640", "POINT (1.234 5.678)");
-        // 
-        //     // SRID=4326;POINT(1.234 5.678 99) - PostGIS EWKT
-        //     test_geometry_equals<point_type, false>(
-        //         "01010000A0E61000005839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT(1.234 5.678)");
-        // 
-        //     // POINTM(1.234 5.678 99) - XYM with M compound ignored
-        //     test_geometry_equals<point_type, true>(
-        //         "01010000405839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT (1.234 5.678)");
-        // 
-        //     // SRID=32632;POINTM(1.234 5.678 99)
-        //     test_geometry_equals<point_type, false>(
-        //         "0101000060787F00005839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT (1.234 5.678)");
-        // 
-        //     // POINT(1.234 5.678 15 79) - XYZM - Z and M compounds ignored
-        //     test_geometry_equals<point_type, true>(
-        //         "01010000C05839B4C876BEF33F83C0CAA145B616400000000000002E400000000000C05340",
-        //         "POINT (1.234 5.678)");
-        // 
-        //     // SRID=4326;POINT(1.234 5.678 15 79) - XYZM + SRID
-        //     test_geometry_equals<point_type, false>(
-        //         "01010000E0E61000005839B4C876BEF33F83C0CAA145B616400000000000002E400000000000C05340",
-        //         "POINT (1.234 5.678)");
+        // XYZ - POINT(1.234 5.678 99) - Z coordinate ignored
+        test_geometry_equals_old<point_type, true>(
+            "01010000805839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT(1.234 5.678)");
+
+        // SRID=32632;POINT(1.234 5.678) - PostGIS EWKT
+        test_geometry_equals_old<point_type, true>(
+            "0101000020787F00005839B4C876BEF33F83C0CAA145B61640", "POINT (1.234 5.678)");
+
+        // SRID=4326;POINT(1.234 5.678 99) - PostGIS EWKT
+        test_geometry_equals_old<point_type, true>(
+            "01010000A0E61000005839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT(1.234 5.678)");
+
+        // POINTM(1.234 5.678 99) - XYM with M compound ignored
+        test_geometry_equals_old<point_type, true>(
+            "01010000405839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT (1.234 5.678)");
+
+        // SRID=32632;POINTM(1.234 5.678 99)
+        test_geometry_equals_old<point_type, true>(
+            "0101000060787F00005839B4C876BEF33F83C0CAA145B616400000000000C05840", "POINT (1.234 5.678)");
+
+        // POINT(1.234 5.678 15 79) - XYZM - Z and M compounds ignored
+        test_geometry_equals_old<point_type, true>(
+            "01010000C05839B4C876BEF33F83C0CAA145B616400000000000002E400000000000C05340",
+            "POINT (1.234 5.678)");
+
+        // SRID=4326;POINT(1.234 5.678 15 79) - XYZM + SRID
+        test_geometry_equals_old<point_type, true>(
+            "01010000E0E61000005839B4C876BEF33F83C0CAA145B616400000000000002E400000000000C05340",
+            "POINT (1.234 5.678)");
 
     }
     
@@ -229,7 +349,8 @@ int test_main(int, char* [])
                 "0102000000030000005839B4C876BEF33F83C0CAA145B616404F401361C333224062A1D634EF3824409CC420B072482A40EB73B515FB2B3040"
                 );
 
-            test_geometry_equals<linestring_type, false>
+            // LINESTRING Z in EWKB - Z coordinate ignored
+            test_geometry_equals<linestring_type, true>
                 (
                 linestring, 
                 "0102000080030000005839B4C876BEF33F83C0CAA145B616400000000000C058404F401361C333224062A1D634EF3824400000000000C058409CC420B072482A40EB73B515FB2B30400000000000C05840"
@@ -491,5 +612,8 @@ int test_main(int, char* [])
             );
     }
     
+    test_ewkb();
+    test_reader();
+
     return 0;
 }
@@ -0,0 +1,150 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/read_wkb.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/utility.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/wkb_view.hpp>
+
+
+typedef std::vector<boost::uint8_t> byte_vector;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+
+byte_vector to_wkb(std::string const& hex)
+{
+    byte_vector wkb;
+    BOOST_CHECK(bg::hex2wkb(hex, std::back_inserter(wkb)));
+    return wkb;
+}
+
+template <typename View>
+void test_invalid(byte_vector const& wkb, std::size_t size)
+{
+    bool thrown = false;
+    try
+    {
+        View view(&wkb[0], &wkb[0] + size);
+    }
+    catch(bg::read_wkb_exception const&)
+    {
+        thrown = true;
+    }
+    BOOST_CHECK(thrown);
+}
+
+// SRID=4326;MULTIPOLYGON Z(((0 0 1,0 4 1,4 4 1,4 0 1,0 0 1),(1 1 1,2 1 1,2 2 1,1 1 1)),
+// ((10 10 2,10 12 2,12 12 2,10 10 2))) with the second polygon in big endian
+std::string const multipolygon_hex =
+"01060000A0E6100000020000000103000080020000000500000000000000000000000000000000000000000000000000F03F"
+"00000000000000000000000000001040000000000000F03F00000000000010400000000000001040000000000000F03F0000"
+"0000000010400000000000000000000000000000F03F00000000000000000000000000000000000000000000F03F04000000"
+"000000000000F03F000000000000F03F000000000000F03F0000000000000040000000000000F03F000000000000F03F0000"
+"0000000000400000000000000040000000000000F03F000000000000F03F000000000000F03F000000000000F03F00800000"
+"0300000001000000044024000000000000402400000000000040000000000000004024000000000000402800000000000040"
+"0000000000000040280000000000004028000000000000400000000000000040240000000000004024000000000000400000"
+"0000000000";
+
+// MULTILINESTRING((0 0,3 4),(0 0,0 1,1 1)) with the second linestring in big endian
+std::string const multilinestring_hex =
+"0105000000020000000102000000020000000000000000000000000000000000000000000000000008400000000000001040"
+"0000000002000000030000000000000000000000000000000000000000000000003FF00000000000003FF00000000000003F"
+"F0000000000000";
+
+// POLYGON((0 0,2 0,2 2,0 2,0 0)) counterclockwise in big endian
+std::string const polygon_hex =
+"0000000003000000010000000500000000000000000000000000000000400000000000000000000000000000004000000000"
+"00000040000000000000000000000000000000400000000000000000000000000000000000000000000000";
+
+void test_multi_polygon()
+{
+    byte_vector const wkb = to_wkb(multipolygon_hex);
+
+    bg::wkb_multi_polygon_view<> view(&wkb[0], &wkb[0] + wkb.size());
+    BOOST_CHECK_EQUAL(boost::size(view), 2u);
+    BOOST_CHECK_EQUAL(bg::num_points(view), 13u);
+    BOOST_CHECK_CLOSE(bg::area(view), 17.5, 1e-10);
+    BOOST_CHECK_CLOSE(bg::perimeter(view), 16 + 2 + std::sqrt(2.0) + 4 + std::sqrt(8.0), 1e-10);
+
+    bg::model::box<point_type> box;
+    bg::envelope(view, box);
+    BOOST_CHECK(bg::equals(box, bg::model::box<point_type>(point_type(0, 0), point_type(12, 12))));
+
+    BOOST_CHECK(bg::within(point_type(0.5, 0.5), view));
+    BOOST_CHECK(! bg::within(point_type(1.5, 1.2), view));
+    BOOST_CHECK(bg::within(point_type(11, 11.5), view));
+
+    // the same as the parsed geometry
+    bg::model::multi_polygon<bg::model::polygon<point_type> > mpoly;
+    BOOST_CHECK(bg::read_wkb(wkb.begin(), wkb.end(), mpoly));
+    BOOST_CHECK_EQUAL(bg::area(view), bg::area(mpoly));
+
+    // parts iterated backward
+    bg::wkb_multi_polygon_view<>::const_iterator it = boost::end(view);
+    --it;
+    BOOST_CHECK_EQUAL(bg::area(*it), 2.0);
+    BOOST_CHECK_EQUAL(boost::end(view) - boost::begin(view), 2);
+
+    test_invalid<bg::wkb_multi_polygon_view<> >(wkb, wkb.size() - 1);
+    test_invalid<bg::wkb_multi_linestring_view<> >(wkb, wkb.size());
+}
+
+void test_linestrings()
+{
+    byte_vector const wkb = to_wkb(multilinestring_hex);
+
+    bg::wkb_multi_linestring_view<> view(&wkb[0], &wkb[0] + wkb.size());
+    BOOST_CHECK_CLOSE(bg::length(view), 7.0, 1e-10);
+
+    bg::wkb_linestring_view<> first = *boost::begin(view);
+    BOOST_CHECK_EQUAL(boost::size(first), 2u);
+    BOOST_CHECK_EQUAL(bg::get<1>(*(boost::begin(first) + 1)), 4.0);
+
+    // the second linestring alone, starting after its number in the multi
+    std::size_t const offset = 9 + (9 + 2 * 16);
+    bg::wkb_linestring_view<> second(&wkb[offset], &wkb[0] + wkb.size());
+    BOOST_CHECK_CLOSE(bg::length(second), 2.0, 1e-10);
+
+    test_invalid<bg::wkb_linestring_view<> >(wkb, wkb.size());
+}
+
+void test_polygon()
+{
+    byte_vector const wkb = to_wkb(polygon_hex);
+
+    bg::wkb_polygon_view<bg::cs::cartesian, false> view(&wkb[0], &wkb[0] + wkb.size());
+    BOOST_CHECK_EQUAL(bg::area(view), 4.0);
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(view), 0u);
+    BOOST_CHECK(bg::within(point_type(1, 1), view));
+
+    test_invalid<bg::wkb_polygon_view<> >(wkb, 20);
+}
+
+int test_main(int, char* [])
+{
+    test_multi_polygon();
+    test_linestrings();
+    test_polygon();
+
+    return 0;
+}
@@ -0,0 +1,978 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2019 Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_CLIP_TO_GRID_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_CLIP_TO_GRID_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/mpl/vector_c.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/expand/interface.hpp>
+#include <boost/geometry/algorithms/detail/overlay/clip_linestring.hpp>
+#include <boost/geometry/algorithms/detail/overlay/clip_polygon.hpp>
+#include <boost/geometry/algorithms/detail/ring_identifier.hpp>
+#include <boost/geometry/algorithms/detail/sections/sectionalize.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag_cast.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/linestring.hpp>
+#include <boost/geometry/geometries/multi_linestring.hpp>
+#include <boost/geometry/geometries/multi_polygon.hpp>
+#include <boost/geometry/geometries/polygon.hpp>
+#include <boost/geometry/policies/robustness/no_rescale_policy.hpp>
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategies/relate.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace clip_to_grid
+{
+
+/*!
+\brief Internal, the cells of a regular grid covering an extent
+\details Cell boundaries are calculated with one formula, so neighbouring
+    cells share exactly the same coordinates.
+*/
+template <typename Box>
+class grid
+{
+    typedef typename coordinate_type<Box>::type coordinate_type;
+    typedef typename select_most_precise
+        <
+            coordinate_type, double
+        >::type calc_type;
+
+public :
+    inline grid(Box const& extent, std::size_t columns, std::size_t rows)
+        : m_extent(extent)
+        , m_columns(columns)
+        , m_rows(rows)
+    {}
+
+    inline std::size_t columns() const { return m_columns; }
+    inline std::size_t rows() const { return m_rows; }
+
+    template <std::size_t Dimension>
+    inline coordinate_type line(std::size_t index) const
+    {
+        std::size_t const count = Dimension == 0 ? m_columns : m_rows;
+        if (index >= count)
+        {
+            return get<max_corner, Dimension>(m_extent);
+        }
+        calc_type const min = get<min_corner, Dimension>(m_extent);
+        calc_type const max = get<max_corner, Dimension>(m_extent);
+        return boost::numeric_cast<coordinate_type>
+            (min + (max - min) * calc_type(index) / calc_type(count));
+    }
+
+    inline Box cell(std::size_t column, std::size_t row) const
+    {
+        Box result;
+        set<min_corner, 0>(result, line<0>(column));
+        set<min_corner, 1>(result, line<1>(row));
+        set<max_corner, 0>(result, line<0>(column + 1));
+        set<max_corner, 1>(result, line<1>(row + 1));
+        return result;
+    }
+
+    //! Returns the range [first, last) of cells touching [low, high]
+    template <std::size_t Dimension, typename T>
+    inline bool cells(T const& low, T const& high,
+                      std::size_t& first, std::size_t& last) const
+    {
+        std::size_t const count = Dimension == 0 ? m_columns : m_rows;
+        calc_type const min = get<min_corner, Dimension>(m_extent);
+        calc_type const max = get<max_corner, Dimension>(m_extent);
+        if (count == 0 || calc_type(high) < min || calc_type(low) > max)
+        {
+            return false;
+        }
+
+        first = estimate(low, min, max, count);
+        while (first > 0 && low <= line<Dimension>(first))
+        {
+            first--;
+        }
+        while (first + 1 < count && low > line<Dimension>(first + 1))
+        {
+            first++;
+        }
+
+        last = estimate(high, min, max, count);
+        while (last + 1 < count && high >= line<Dimension>(last + 1))
+        {
+            last++;
+        }
+        while (last > first && high < line<Dimension>(last))
+        {
+            last--;
+        }
+        last++;
+        return true;
+    }
+
+private :
+    template <typename T>
+    static inline std::size_t estimate(T const& value,
+            calc_type const& min, calc_type const& max, std::size_t count)
+    {
+        calc_type const position = (calc_type(value) - min) / (max - min)
+                                 * calc_type(count);
+        return position <= 0 ? 0
+             : position >= calc_type(count) ? count - 1
+             : static_cast<std::size_t>(position);
+    }
+
+    Box m_extent;
+    std::size_t m_columns;
+    std::size_t m_rows;
+};
+
+
+// Cells not touched by the boundary are inside or outside areal geometries
+template <typename TagCast>
+struct untouched_cell
+{
+    template <typename Geometry, typename Box, typename GeometryOut>
+    static inline void apply(Geometry const& , Box const& , GeometryOut& ,
+                             int& )
+    {}
+};
+
+template <>
+struct untouched_cell<areal_tag>
+{
+    // The location is 0 if unknown, or the location of the previous cell
+    template <typename Geometry, typename Box, typename GeometryOut>
+    static inline void apply(Geometry const& geometry, Box const& cell,
+                             GeometryOut& result, int& location)
+    {
+        typedef typename point_type<Geometry>::type point_type;
+
+        if (location == 0)
+        {
+            point_type center;
+            set<0>(center, (get<min_corner, 0>(cell) + get<max_corner, 0>(cell)) / 2);
+            set<1>(center, (get<min_corner, 1>(cell) + get<max_corner, 1>(cell)) / 2);
+            location = detail::within::point_in_geometry(center, geometry);
+        }
+
+        if (location > 0)
+        {
+            typename boost::range_value<GeometryOut>::type polygon;
+            geometry::convert(cell, polygon);
+            range::push_back(result, polygon);
+        }
+    }
+};
+
+
+/*!
+\brief Internal, intersects one geometry with all cells of a grid
+\details Used for input which cannot be clipped from its sections. The
+    geometry is sectionalized once. The cells touched by the bounding box
+    of a section are intersected with the geometry, the other cells are
+    either completely inside or completely outside it, which is decided by
+    one point in geometry test per run of untouched cells in a row.
+*/
+struct clip_to_grid
+{
+    template <typename Geometry, typename Box, typename Cells, typename Strategy>
+    static inline void apply(Geometry const& geometry, Box const& extent,
+                             std::size_t columns, std::size_t rows,
+                             Cells& cells, Strategy const& strategy)
+    {
+        typedef typename point_type<Geometry>::type point_type;
+        typedef model::box<point_type> section_box_type;
+        typedef geometry::sections<section_box_type, 2> sections_type;
+        typedef boost::mpl::vector_c<std::size_t, 0, 1> dimensions;
+
+        grid<Box> const cell_grid(extent, columns, rows);
+
+        cells.clear();
+        cells.resize(columns * rows);
+
+        sections_type sections;
+        geometry::sectionalize<false, dimensions>(geometry,
+                detail::no_rescale_policy(), sections);
+        if (sections.empty())
+        {
+            return;
+        }
+
+        std::vector<bool> touched(columns * rows, false);
+        section_box_type envelope;
+        geometry::assign_inverse(envelope);
+        for (typename sections_type::const_iterator it = sections.begin();
+             it != sections.end(); ++it)
+        {
+            geometry::expand(envelope, it->bounding_box);
+
+            std::size_t first_column, last_column, first_row, last_row;
+            if (! cell_grid.template cells<0>(
+                        get<min_corner, 0>(it->bounding_box),
+                        get<max_corner, 0>(it->bounding_box),
+                        first_column, last_column)
+                || ! cell_grid.template cells<1>(
+                        get<min_corner, 1>(it->bounding_box),
+                        get<max_corner, 1>(it->bounding_box),
+                        first_row, last_row))
+            {
+                continue;
+            }
+
+            for (std::size_t row = first_row; row < last_row; row++)
+            {
+                for (std::size_t column = first_column; column < last_column; column++)
+                {
+                    touched[row * columns + column] = true;
+                }
+            }
+        }
+
+        // Cells outside the envelope are outside the geometry
+        std::size_t min_column, max_column, min_row, max_row;
+        if (! cell_grid.template cells<0>(get<min_corner, 0>(envelope),
+                                          get<max_corner, 0>(envelope),
+                                          min_column, max_column)
+            || ! cell_grid.template cells<1>(get<min_corner, 1>(envelope),
+                                             get<max_corner, 1>(envelope),
+                                             min_row, max_row))
+        {
+            return;
+        }
+
+        typedef typename tag_cast
+            <
+                typename tag<Geometry>::type, areal_tag
+            >::type tag_type;
+
+        // Untouched cells next to each other in a row are not separated
+        // by the boundary, they are all inside or all outside.
+        for (std::size_t row = min_row; row < max_row; row++)
+        {
+            int location = 0;
+            for (std::size_t column = min_column; column < max_column; column++)
+            {
+                std::size_t const index = row * columns + column;
+                Box const cell = cell_grid.cell(column, row);
+                if (touched[index])
+                {
+                    geometry::intersection(geometry, cell, cells[index], strategy);
+                    location = 0;
+                }
+                else
+                {
+                    untouched_cell<tag_type>::apply(geometry, cell,
+                                                    cells[index], location);
+                }
+            }
+        }
+    }
+};
+
+
+typedef std::vector<std::pair<std::size_t, std::size_t> > runs_type;
+
+// Collects the runs of consecutive segments, as indices of their first
+// and last point, of the sections of one ring or linestring
+template <typename Sections, typename Iterator>
+inline Iterator collect_runs(Sections const& sections,
+                             Iterator it, Iterator end, runs_type& runs)
+{
+    runs.clear();
+    ring_identifier const ring_id = sections[it->second].ring_id;
+    for ( ; it != end && sections[it->second].ring_id == ring_id; ++it)
+    {
+        std::size_t const first = sections[it->second].begin_index;
+        std::size_t const last = sections[it->second].end_index;
+        if (! runs.empty() && runs.back().second == first)
+        {
+            runs.back().second = last;
+        }
+        else
+        {
+            runs.push_back(std::make_pair(first, last));
+        }
+    }
+    return it;
+}
+
+// Counts the crossings of the sections [first, last) of a ring with a ray
+// from the point in positive x-direction. A section completely right of the
+// point crosses it an odd number of times if its first and last point are
+// on different sides, only the segments of the sections around the point
+// are visited. Returns -1 if the point is on the ring, else the parity.
+template <typename Point, typename Ring, typename Sections>
+inline int ring_parity(Point const& point, Ring const& ring,
+                       Sections const& sections,
+                       std::size_t first, std::size_t last)
+{
+    typedef typename coordinate_type<Point>::type coordinate_type;
+
+    coordinate_type const x = get<0>(point);
+    coordinate_type const y = get<1>(point);
+
+    int parity = 0;
+    for (std::size_t index = first; index < last; index++)
+    {
+        typename boost::range_value<Sections>::type const&
+            section = sections[index];
+        if (y < get<min_corner, 1>(section.bounding_box)
+            || y > get<max_corner, 1>(section.bounding_box)
+            || x > get<max_corner, 0>(section.bounding_box))
+        {
+            continue;
+        }
+
+        if (x < get<min_corner, 0>(section.bounding_box))
+        {
+            if ((get<1>(range::at(ring, section.begin_index)) > y)
+                != (get<1>(range::at(ring, section.end_index)) > y))
+            {
+                parity = 1 - parity;
+            }
+            continue;
+        }
+
+        for (signed_size_type i = section.begin_index; i < section.end_index; i++)
+        {
+            coordinate_type const x0 = get<0>(range::at(ring, i));
+            coordinate_type const y0 = get<1>(range::at(ring, i));
+            coordinate_type const x1 = get<0>(range::at(ring, i + 1));
+            coordinate_type const y1 = get<1>(range::at(ring, i + 1));
+            if ((y0 > y) != (y1 > y))
+            {
+                coordinate_type const xc = x0 + (y - y0) * (x1 - x0) / (y1 - y0);
+                if (xc == x)
+                {
+                    return -1;
+                }
+                if (xc > x)
+                {
+                    parity = 1 - parity;
+                }
+            }
+            else if (y0 == y && y1 == y
+                     && (std::min)(x0, x1) <= x && x <= (std::max)(x0, x1))
+            {
+                return -1;
+            }
+        }
+    }
+    return parity;
+}
+
+/*!
+\brief Internal, locates a point with respect to a multi polygon, using its
+    sections
+\details The sections of the rings are consecutive, a point is inside a
+    polygon if it is inside the exterior ring and not inside an interior
+    ring. Returns 1 if the point is inside, -1 if it is outside and 0 if it
+    is on the boundary.
+*/
+template <typename Point, typename MultiPolygon, typename Sections>
+inline int section_location(Point const& point,
+                            MultiPolygon const& multi_polygon,
+                            Sections const& sections)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+
+    bool inside = false;
+    signed_size_type multi_index = -1;
+    bool in_polygon = false;
+    std::size_t first = 0;
+    while (first < sections.size())
+    {
+        ring_identifier const ring_id = sections[first].ring_id;
+        std::size_t last = first + 1;
+        while (last < sections.size() && sections[last].ring_id == ring_id)
+        {
+            last++;
+        }
+
+        polygon_type const& polygon = range::at(multi_polygon, ring_id.multi_index);
+        int const parity = ring_id.ring_index < 0
+            ? ring_parity(point, geometry::exterior_ring(polygon),
+                          sections, first, last)
+            : ring_parity(point, range::at(geometry::interior_rings(polygon),
+                                           ring_id.ring_index),
+                          sections, first, last);
+        if (parity < 0)
+        {
+            return 0;
+        }
+
+        if (ring_id.multi_index != multi_index)
+        {
+            inside = inside || in_polygon;
+            multi_index = ring_id.multi_index;
+            in_polygon = false;
+        }
+        if (ring_id.ring_index < 0)
+        {
+            in_polygon = parity == 1;
+        }
+        else if (parity == 1)
+        {
+            in_polygon = false;
+        }
+        first = last;
+    }
+    return inside || in_polygon ? 1 : -1;
+}
+
+/*!
+\brief Internal, the sections of a geometry and the cells they touch
+\details Pairs of a cell index and a section index, sorted on cell, give
+    the sections touching a cell in the order of the geometry. The cells
+    are resized, and the range of cells around the envelope is kept.
+*/
+template <typename Geometry, typename Box>
+struct sectionalized_cells
+{
+    typedef typename point_type<Geometry>::type point_type;
+    typedef geometry::sections<model::box<point_type>, 2> sections_type;
+    typedef std::vector<std::pair<std::size_t, std::size_t> > pairs_type;
+    typedef typename pairs_type::const_iterator iterator;
+
+    template <typename Cells>
+    inline sectionalized_cells(Geometry const& geometry, Box const& extent,
+                               std::size_t columns, std::size_t rows,
+                               Cells& cells)
+        : cell_grid(extent, columns, rows)
+        , min_column(0), max_column(0), min_row(0), max_row(0)
+    {
+        typedef boost::mpl::vector_c<std::size_t, 0, 1> dimensions;
+
+        cells.clear();
+        cells.resize(columns * rows);
+
+        geometry::sectionalize<false, dimensions>(geometry,
+                detail::no_rescale_policy(), sections);
+        if (sections.empty())
+        {
+            return;
+        }
+
+        model::box<point_type> envelope;
+        geometry::assign_inverse(envelope);
+        for (std::size_t s = 0; s < sections.size(); s++)
+        {
+            model::box<point_type> const& box = sections[s].bounding_box;
+            geometry::expand(envelope, box);
+
+            std::size_t first_column, last_column, first_row, last_row;
+            if (cell_grid.template cells<0>(get<min_corner, 0>(box),
+                                            get<max_corner, 0>(box),
+                                            first_column, last_column)
+                && cell_grid.template cells<1>(get<min_corner, 1>(box),
+                                               get<max_corner, 1>(box),
+                                               first_row, last_row))
+            {
+                for (std::size_t row = first_row; row < last_row; row++)
+                {
+                    for (std::size_t column = first_column; column < last_column; column++)
+                    {
+                        touched.push_back(std::make_pair(row * columns + column, s));
+                    }
+                }
+            }
+        }
+        std::sort(touched.begin(), touched.end());
+
+        // Cells outside the envelope are outside the geometry
+        if (! cell_grid.template cells<0>(get<min_corner, 0>(envelope),
+                                          get<max_corner, 0>(envelope),
+                                          min_column, max_column)
+            || ! cell_grid.template cells<1>(get<min_corner, 1>(envelope),
+                                             get<max_corner, 1>(envelope),
+                                             min_row, max_row))
+        {
+            min_column = max_column = min_row = max_row = 0;
+        }
+    }
+
+    //! Gets the sections touching a cell, returns false if there are none
+    inline bool touching(std::size_t index, iterator& first, iterator& last) const
+    {
+        first = std::lower_bound(touched.begin(), touched.end(),
+                                 std::make_pair(index, std::size_t(0)));
+        last = first;
+        while (last != touched.end() && last->first == index)
+        {
+            ++last;
+        }
+        return first != last;
+    }
+
+    grid<Box> const cell_grid;
+    sections_type sections;
+    pairs_type touched;
+    std::size_t min_column, max_column, min_row, max_row;
+};
+
+
+// Clips the polygons of which sections touch the cell, from the runs of
+// their rings in these sections. Returns false if the clipper refuses the
+// input. Entered is false if no ring enters the cell, which is then
+// completely inside or outside the multi polygon.
+template
+<
+    typename MultiPolygon, typename Sections, typename Iterator,
+    typename Box, typename Polygons, typename Strategy
+>
+inline bool clip_areal_cell(MultiPolygon const& multi_polygon,
+                            Sections const& sections,
+                            Iterator first, Iterator last, Box const& cell,
+                            Polygons& polygons, Strategy const& strategy,
+                            bool& entered)
+{
+    typedef typename boost::range_value<MultiPolygon>::type polygon_type;
+    typedef typename ring_type<polygon_type>::type ring_type;
+    typedef detail::intersection::box_clipper
+        <
+            Box, ring_type, Strategy, detail::no_rescale_policy
+        > clipper_type;
+
+    detail::no_rescale_policy const robust_policy;
+    runs_type runs;
+
+    entered = false;
+    while (first != last)
+    {
+        signed_size_type const multi_index
+            = sections[first->second].ring_id.multi_index;
+        polygon_type const& polygon = range::at(multi_polygon, multi_index);
+
+        clipper_type clipper(cell, strategy, robust_policy);
+        bool outer_enters = false;
+        bool hole_enters = false;
+        while (first != last
+               && sections[first->second].ring_id.multi_index == multi_index)
+        {
+            signed_size_type const ring_index
+                = sections[first->second].ring_id.ring_index;
+            first = collect_runs(sections, first, last, runs);
+
+            bool enters = false;
+            if (ring_index < 0)
+            {
+                if (! clipper.add_ring_runs(geometry::exterior_ring(polygon),
+                                            runs, false, enters))
+                {
+                    return false;
+                }
+                outer_enters = enters;
+            }
+            else
+            {
+                if (! clipper.add_ring_runs(range::at(
+                            geometry::interior_rings(polygon), ring_index),
+                            runs, true, enters))
+                {
+                    return false;
+                }
+                hole_enters = hole_enters || enters;
+            }
+        }
+
+        // Rings not entering the cell cannot contain it if another ring of
+        // the polygon enters it, except the exterior ring
+        if (hole_enters && ! outer_enters)
+        {
+            clipper.set_inside_ring(false);
+        }
+        if (outer_enters || hole_enters)
+        {
+            entered = true;
+            if (! clipper.assemble(polygons))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+
+/*!
+\brief Internal, clips a multi polygon with all cells of a grid, from its
+    sections
+\details The multi polygon is sectionalized once and every cell is clipped
+    with the box clipper, walking only the segments of the sections touching
+    it. Cells not entered by the boundary are located, per run of cells in a
+    row, from the sections as well. Cells with degenerate input are
+    intersected with the general overlay.
+*/
+struct clip_areal_to_grid
+{
+    template
+    <
+        typename Geometry, typename Box, typename Cells, typename Strategy
+    >
+    static inline void apply(Geometry const& geometry, Box const& extent,
+                             std::size_t columns, std::size_t rows,
+                             Cells& cells, Strategy const& strategy)
+    {
+        typedef typename point_type<Geometry>::type point_type;
+        typedef model::multi_polygon<model::polygon<point_type> > multi_polygon_type;
+        typedef typename boost::range_value<multi_polygon_type>::type polygon_type;
+        typedef typename boost::range_value
+            <
+                typename boost::range_value<Cells>::type
+            >::type polygon_out_type;
+
+        // The box clipper needs clockwise closed rings
+        multi_polygon_type multi_polygon;
+        geometry::convert(geometry, multi_polygon);
+
+        sectionalized_cells<multi_polygon_type, Box> const
+            grid_sections(multi_polygon, extent, columns, rows, cells);
+
+        std::vector<polygon_type> polygons;
+        for (std::size_t row = grid_sections.min_row; row < grid_sections.max_row; row++)
+        {
+            int location = 0;
+            for (std::size_t column = grid_sections.min_column;
+                 column < grid_sections.max_column; column++)
+            {
+                std::size_t const index = row * columns + column;
+                Box const cell = grid_sections.cell_grid.cell(column, row);
+
+                typename sectionalized_cells<multi_polygon_type, Box>::iterator
+                    first, last;
+                bool entered = false;
+                if (grid_sections.touching(index, first, last))
+                {
+                    polygons.clear();
+                    if (! clip_areal_cell(multi_polygon, grid_sections.sections,
+                                          first, last, cell, polygons,
+                                          strategy, entered))
+                    {
+                        geometry::intersection(geometry, cell, cells[index],
+                                               strategy);
+                        location = 0;
+                        continue;
+                    }
+
+                    for (std::size_t i = 0; i < polygons.size(); i++)
+                    {
+                        polygon_out_type polygon;
+                        geometry::convert(polygons[i], polygon);
+                        range::push_back(cells[index], polygon);
+                    }
+                    if (entered)
+                    {
+                        location = 0;
+                        continue;
+                    }
+                }
+
+                // Untouched cells next to each other in a row are not
+                // separated by the boundary, they are all inside or outside
+                if (location == 0)
+                {
+                    point_type center;
+                    set<0>(center, (get<min_corner, 0>(cell) + get<max_corner, 0>(cell)) / 2);
+                    set<1>(center, (get<min_corner, 1>(cell) + get<max_corner, 1>(cell)) / 2);
+                    location = section_location(center, multi_polygon,
+                                                grid_sections.sections);
+                    if (location == 0)
+                    {
+                        geometry::intersection(geometry, cell, cells[index],
+                                               strategy);
+                        continue;
+                    }
+                }
+                if (location > 0)
+                {
+                    polygon_out_type polygon;
+                    geometry::convert(cell, polygon);
+                    range::push_back(cells[index], polygon);
+                }
+            }
+        }
+    }
+};
+
+
+/*!
+\brief Internal, clips a multi linestring with all cells of a grid, from its
+    sections
+\details Every cell clips only the runs of segments of the sections
+    touching it.
+*/
+struct clip_linear_to_grid
+{
+    template
+    <
+        typename Geometry, typename Box, typename Cells, typename Strategy
+    >
+    static inline void apply(Geometry const& geometry, Box const& extent,
+                             std::size_t columns, std::size_t rows,
+                             Cells& cells, Strategy const& )
+    {
+        typedef typename point_type<Geometry>::type point_type;
+        typedef model::multi_linestring<model::linestring<point_type> > multi_linestring_type;
+        typedef typename boost::range_value<multi_linestring_type>::type linestring_type;
+        typedef typename boost::range_value<Cells>::type multi_out_type;
+        typedef typename boost::range_value<multi_out_type>::type linestring_out_type;
+        typedef typename boost::range_const_iterator<linestring_type>::type point_iterator;
+
+        multi_linestring_type multi_linestring;
+        geometry::convert(geometry, multi_linestring);
+
+        sectionalized_cells<multi_linestring_type, Box> const
+            grid_sections(multi_linestring, extent, columns, rows, cells);
+
+        strategy::intersection::liang_barsky
+            <
+                Box, typename geometry::point_type<linestring_out_type>::type
+            > lb_strategy;
+        detail::no_rescale_policy const robust_policy;
+        runs_type runs;
+
+        for (std::size_t row = grid_sections.min_row; row < grid_sections.max_row; row++)
+        {
+            for (std::size_t column = grid_sections.min_column;
+                 column < grid_sections.max_column; column++)
+            {
+                std::size_t const index = row * columns + column;
+                typename sectionalized_cells<multi_linestring_type, Box>::iterator
+                    first, last;
+                if (! grid_sections.touching(index, first, last))
+                {
+                    continue;
+                }
+
+                Box const cell = grid_sections.cell_grid.cell(column, row);
+                while (first != last)
+                {
+                    linestring_type const& linestring = range::at(multi_linestring,
+                            grid_sections.sections[first->second].ring_id.multi_index);
+                    first = collect_runs(grid_sections.sections, first, last, runs);
+                    for (std::size_t r = 0; r < runs.size(); r++)
+                    {
+                        point_iterator const begin = boost::begin(linestring);
+                        detail::intersection::clip_range_with_box
+                            <
+                                linestring_out_type
+                            >(cell, boost::make_iterator_range(
+                                        begin + runs[r].first,
+                                        begin + runs[r].second + 1),
+                              robust_policy,
+                              range::back_inserter(cells[index]),
+                              lb_strategy);
+                    }
+                }
+            }
+        }
+    }
+};
+
+
+// Whether a geometry can be clipped from its sections
+template <typename Geometry>
+struct is_sectionalized_clippable
+{
+    static const bool value =
+        boost::is_same<typename cs_tag<Geometry>::type, cartesian_tag>::value
+        && boost::is_floating_point
+            <
+                typename coordinate_type<Geometry>::type
+            >::value;
+};
+
+
+}} // namespace detail::clip_to_grid
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template
+<
+    typename Geometry,
+    typename Tag = typename tag<Geometry>::type,
+    bool Sectionalized
+        = detail::clip_to_grid::is_sectionalized_clippable<Geometry>::value
+>
+struct clip_to_grid
+    : detail::clip_to_grid::clip_to_grid
+{};
+
+template <typename Ring>
+struct clip_to_grid<Ring, ring_tag, true>
+    : detail::clip_to_grid::clip_areal_to_grid
+{};
+
+template <typename Polygon>
+struct clip_to_grid<Polygon, polygon_tag, true>
+    : detail::clip_to_grid::clip_areal_to_grid
+{};
+
+template <typename MultiPolygon>
+struct clip_to_grid<MultiPolygon, multi_polygon_tag, true>
+    : detail::clip_to_grid::clip_areal_to_grid
+{};
+
+template <typename Linestring>
+struct clip_to_grid<Linestring, linestring_tag, true>
+    : detail::clip_to_grid::clip_linear_to_grid
+{};
+
+template <typename MultiLinestring>
+struct clip_to_grid<MultiLinestring, multi_linestring_tag, true>
+    : detail::clip_to_grid::clip_linear_to_grid
+{};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+namespace resolve_strategy
+{
+
+struct clip_to_grid
+{
+    template <typename Geometry, typename Box, typename Cells, typename Strategy>
+    static inline void apply(Geometry const& geometry, Box const& extent,
+                             std::size_t columns, std::size_t rows,
+                             Cells& cells, Strategy const& strategy)
+    {
+        dispatch::clip_to_grid<Geometry>::apply(geometry, extent,
+                columns, rows, cells, strategy);
+    }
+
+    template <typename Geometry, typename Box, typename Cells>
+    static inline void apply(Geometry const& geometry, Box const& extent,
+                             std::size_t columns, std::size_t rows,
+                             Cells& cells, default_strategy)
+    {
+        typedef typename strategy::relate::services::default_strategy
+            <
+                Geometry, Box
+            >::type strategy_type;
+
+        dispatch::clip_to_grid<Geometry>::apply(geometry, extent,
+                columns, rows, cells, strategy_type());
+    }
+};
+
+} // namespace resolve_strategy
+
+
+/*!
+\brief Intersects a geometry with all cells of a regular grid
+\ingroup intersection
+\details The extent is divided into columns x rows cells of equal size,
+    as the tiles of one zoom level. The result of cell (column, row) is
+    stored at index row * columns + column, columns counted from the
+    minimum x, rows from the minimum y. The geometry is sectionalized
+    once for all cells. Cartesian polygons and linestrings are clipped per
+    cell from the segments of the sections touching it, cells not touched
+    by the boundary are inside or outside as a whole. This is much faster
+    than calling intersection for every cell.
+\tparam Geometry \tparam_geometry
+\tparam Box \tparam_box
+\tparam Cells vector-like range of multi geometries, e.g. std::vector of
+    multi-polygons (for areal input) or multi-linestrings (for linear input)
+\tparam Strategy \tparam_strategy{Intersection}
+\param geometry \param_geometry
+\param extent the box covered by the grid
+\param columns the number of cells in x-direction
+\param rows the number of cells in y-direction
+\param cells the output, resized to columns * rows
+\param strategy \param_strategy{intersection}
+
+\qbk{distinguish,with strategy}
+*/
+template
+<
+    typename Geometry, typename Box, typename Cells, typename Strategy
+>
+inline void clip_to_grid(Geometry const& geometry, Box const& extent,
+                         std::size_t columns, std::size_t rows,
+                         Cells& cells, Strategy const& strategy)
+{
+    concepts::check<Geometry const>();
+    concepts::check<Box const>();
+    concepts::check<typename boost::range_value<Cells>::type>();
+
+    resolve_strategy::clip_to_grid::apply(geometry, extent, columns, rows,
+                                          cells, strategy);
+}
+
+
+/*!
+\brief Intersects a geometry with all cells of a regular grid
+\ingroup intersection
+\details The extent is divided into columns x rows cells of equal size,
+    as the tiles of one zoom level. The result of cell (column, row) is
+    stored at index row * columns + column, columns counted from the
+    minimum x, rows from the minimum y. The geometry is sectionalized
+    once for all cells. Cartesian polygons and linestrings are clipped per
+    cell from the segments of the sections touching it, cells not touched
+    by the boundary are inside or outside as a whole. This is much faster
+    than calling intersection for every cell.
+\tparam Geometry \tparam_geometry
+\tparam Box \tparam_box
+\tparam Cells vector-like range of multi geometries, e.g. std::vector of
+    multi-polygons (for areal input) or multi-linestrings (for linear input)
+\param geometry \param_geometry
+\param extent the box covered by the grid
+\param columns the number of cells in x-direction
+\param rows the number of cells in y-direction
+\param cells the output, resized to columns * rows
+*/
+template <typename Geometry, typename Box, typename Cells>
+inline void clip_to_grid(Geometry const& geometry, Box const& extent,
+                         std::size_t columns, std::size_t rows,
+                         Cells& cells)
+{
+    geometry::clip_to_grid(geometry, extent, columns, rows, cells,
+                           default_strategy());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_CLIP_TO_GRID_HPP
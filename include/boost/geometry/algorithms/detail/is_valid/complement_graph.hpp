@@ -1,6 +1,6 @@
 // Boost.Geometry (aka GGL, Generic Geometry Library)
 
-// Copyright (c) 2014, 2018, Oracle and/or its affiliates.
+// Copyright (c) 2014, 2018, 2019, Oracle and/or its affiliates.
 
 // Contributed and/or modified by Menelaos Karavelas, on behalf of Oracle
 // Contributed and/or modified by Adam Wulkiewicz, on behalf of Oracle
@@ -11,10 +11,8 @@
 #ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_COMPLEMENT_GRAPH_HPP
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_COMPLEMENT_GRAPH_HPP
 
+#include <algorithm>
 #include <cstddef>
-
-#include <set>
-#include <stack>
 #include <utility>
 #include <vector>
 
@@ -32,190 +30,159 @@ namespace detail { namespace is_valid
 {
 
 
-template <typename TurnPoint>
-class complement_graph_vertex
-{
-public:
-    complement_graph_vertex(std::size_t id)
-        : m_id(id)
-        , m_turn_point(NULL)
-    {}
-
-    complement_graph_vertex(TurnPoint const* turn_point,
-                            std::size_t expected_id)
-        : m_id(expected_id)
-        , m_turn_point(turn_point)
-    {}
-
-    inline std::size_t id() const { return m_id; }
-
-    inline bool operator<(complement_graph_vertex const& other) const
-    {
-        if ( m_turn_point != NULL && other.m_turn_point != NULL )
-        {
-            return geometry::less
-                <
-                    TurnPoint
-                >()(*m_turn_point, *other.m_turn_point);
-        }
-        if ( m_turn_point == NULL && other.m_turn_point == NULL )
-        {
-            return m_id < other.m_id;
-        }
-        return m_turn_point == NULL;
-    }
-
-private:
-    // the value of m_turn_point determines the type of the vertex
-    // non-NULL: vertex corresponds to an IP
-    // NULL    : vertex corresponds to a hole or outer space, and the id
-    //           is the ring id of the corresponding ring of the polygon
-    std::size_t m_id;
-    TurnPoint const* m_turn_point;
-};
-
-
-
-
+// The complement graph of a polygon has a vertex for each ring and for
+// each distinct turn point, and an edge between a ring and each turn
+// point on it. The interior of the polygon is connected if and only if
+// this graph has no cycles.
+// The edges are collected in a flat vector. Equal turn points are merged
+// by sorting, duplicate edges are removed, and cycles are detected with
+// a union-find structure while adding the edges.
 template <typename TurnPoint>
 class complement_graph
 {
-private:
-    typedef complement_graph_vertex<TurnPoint> vertex;
-    typedef std::set<vertex> vertex_container;
-
 public:
-    typedef typename vertex_container::const_iterator vertex_handle;
+    typedef std::size_t vertex_handle;
 
 private:
-    struct vertex_handle_less
+    typedef std::pair<vertex_handle, vertex_handle> edge;
+
+    struct turn_point_less
     {
-        inline bool operator()(vertex_handle v1, vertex_handle v2) const
+        explicit turn_point_less(std::vector<TurnPoint const*> const& points)
+            : m_points(points)
+        {}
+
+        inline bool operator()(std::size_t i, std::size_t j) const
         {
-            return v1->id() < v2->id();
+            return geometry::less<TurnPoint>()(*m_points[i], *m_points[j]);
         }
-    };
 
-    typedef std::set<vertex_handle, vertex_handle_less> neighbor_container;
+        std::vector<TurnPoint const*> const& m_points;
+    };
 
-    class has_cycles_dfs_data
+    class disjoint_sets
     {
     public:
-        has_cycles_dfs_data(std::size_t num_nodes)
-            : m_visited(num_nodes, false)
-            , m_parent_id(num_nodes, -1)
-        {}
-
-        inline signed_size_type parent_id(vertex_handle v) const
+        explicit disjoint_sets(std::size_t count)
+            : m_parent(count)
         {
-            return m_parent_id[v->id()];
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                m_parent[i] = i;
+            }
         }
 
-        inline void set_parent_id(vertex_handle v, signed_size_type id)
+        inline std::size_t find(std::size_t v)
         {
-            m_parent_id[v->id()] = id;
+            while (m_parent[v] != v)
+            {
+                // path halving
+                m_parent[v] = m_parent[m_parent[v]];
+                v = m_parent[v];
+            }
+            return v;
         }
 
-        inline bool visited(vertex_handle v) const
+        // returns false if both were already in the same set
+        inline bool unite(std::size_t v1, std::size_t v2)
         {
-            return m_visited[v->id()];
+            std::size_t const r1 = find(v1);
+            std::size_t const r2 = find(v2);
+            if (r1 == r2)
+            {
+                return false;
+            }
+            m_parent[r1] = r2;
+            return true;
         }
 
-        inline void set_visited(vertex_handle v, bool value)
-        {
-            m_visited[v->id()] = value;
-        }
     private:
-        std::vector<bool> m_visited;
-        std::vector<signed_size_type> m_parent_id;
+        std::vector<std::size_t> m_parent;
     };
 
-
-    inline bool has_cycles(vertex_handle start_vertex,
-                           has_cycles_dfs_data& data) const
+    // maps the vertex of each added turn point to the vertex of the
+    // first equal turn point
+    inline std::vector<vertex_handle> merged_turn_vertices() const
     {
-        std::stack<vertex_handle> stack;
-        stack.push(start_vertex);
+        std::size_t const count = m_turn_points.size();
 
-        while ( !stack.empty() )
+        std::vector<std::size_t> order(count);
+        for (std::size_t i = 0; i < count; ++i)
         {
-            vertex_handle v = stack.top();
-            stack.pop();
+            order[i] = i;
+        }
+        turn_point_less const less(m_turn_points);
+        std::sort(order.begin(), order.end(), less);
 
-            data.set_visited(v, true);
-            for (typename neighbor_container::const_iterator nit
-                     = m_neighbors[v->id()].begin();
-                 nit != m_neighbors[v->id()].end(); ++nit)
-            {
-                if ( static_cast<signed_size_type>((*nit)->id()) != data.parent_id(v) )
-                {
-                    if ( data.visited(*nit) )
-                    {
-                        return true;
-                    }
-                    else
-                    {
-                        data.set_parent_id(*nit, static_cast<signed_size_type>(v->id()));
-                        stack.push(*nit);
-                    }
-                }
-            }
+        std::vector<vertex_handle> merged(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            merged[order[i]] = i > 0 && ! less(order[i - 1], order[i])
+                             ? merged[order[i - 1]]
+                             : m_num_rings + order[i];
         }
-        return false;
+        return merged;
     }
 
 public:
     // num_rings: total number of rings, including the exterior ring
     complement_graph(std::size_t num_rings)
         : m_num_rings(num_rings)
-        , m_num_turns(0)
-        , m_vertices()
-        , m_neighbors(num_rings)
     {}
 
-    // inserts a ring vertex in the graph and returns its handle
+    // returns the handle of a ring vertex
     // ring id's are zero-based (so the first interior ring has id 1)
     inline vertex_handle add_vertex(signed_size_type id)
     {
-        return m_vertices.insert(vertex(static_cast<std::size_t>(id))).first;
+        BOOST_GEOMETRY_ASSERT( id >= 0
+                            && static_cast<std::size_t>(id) < m_num_rings );
+        return static_cast<vertex_handle>(id);
     }
 
-    // inserts an IP in the graph and returns its id
+    // inserts an IP in the graph and returns its handle, equal IPs are
+    // merged when the graph is checked
     inline vertex_handle add_vertex(TurnPoint const& turn_point)
     {
-        std::pair<vertex_handle, bool> res
-            = m_vertices.insert(vertex(boost::addressof(turn_point),
-                                       m_num_rings + m_num_turns)
-                                );
-
-        if ( res.second )
-        {
-            // a new element is inserted
-            m_neighbors.push_back(neighbor_container());
-            ++m_num_turns;
-        }
-        return res.first;
+        m_turn_points.push_back(boost::addressof(turn_point));
+        return m_num_rings + m_turn_points.size() - 1;
     }
 
     inline void add_edge(vertex_handle v1, vertex_handle v2)
     {
-        BOOST_GEOMETRY_ASSERT( v1 != m_vertices.end() );
-        BOOST_GEOMETRY_ASSERT( v2 != m_vertices.end() );
-        m_neighbors[v1->id()].insert(v2);
-        m_neighbors[v2->id()].insert(v1);
+        m_edges.push_back(edge(v1, v2));
     }
 
     inline bool has_cycles() const
     {
-        // initialize all vertices as non-visited and with no parent set
-        // this is done by the constructor of has_cycles_dfs_data
-        has_cycles_dfs_data data(m_num_rings + m_num_turns);
+        std::vector<vertex_handle> const merged = merged_turn_vertices();
+
+        std::vector<edge> edges(m_edges);
+        for (typename std::vector<edge>::iterator it = edges.begin();
+             it != edges.end(); ++it)
+        {
+            if (it->first >= m_num_rings)
+            {
+                it->first = merged[it->first - m_num_rings];
+            }
+            if (it->second >= m_num_rings)
+            {
+                it->second = merged[it->second - m_num_rings];
+            }
+            if (it->second < it->first)
+            {
+                std::swap(it->first, it->second);
+            }
+        }
+
+        // the graph is simple, parallel edges are one edge
+        std::sort(edges.begin(), edges.end());
+        edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
 
-        // for each non-visited vertex, start a DFS from that vertex
-        for (vertex_handle it = m_vertices.begin();
-             it != m_vertices.end(); ++it)
+        disjoint_sets sets(m_num_rings + m_turn_points.size());
+        for (typename std::vector<edge>::const_iterator it = edges.begin();
+             it != edges.end(); ++it)
         {
-            if ( !data.visited(it) && has_cycles(it, data) )
+            if (! sets.unite(it->first, it->second))
             {
                 return true;
             }
@@ -230,9 +197,9 @@ public:
 #endif // BOOST_GEOMETRY_TEST_DEBUG
 
 private:
-    std::size_t m_num_rings, m_num_turns;
-    vertex_container m_vertices;
-    std::vector<neighbor_container> m_neighbors;
+    std::size_t m_num_rings;
+    std::vector<TurnPoint const*> m_turn_points;
+    std::vector<edge> m_edges;
 };
 
 
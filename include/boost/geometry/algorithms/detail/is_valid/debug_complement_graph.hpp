@@ -1,6 +1,6 @@
 // Boost.Geometry (aka GGL, Generic Geometry Library)
 
-// Copyright (c) 2014, 2018, Oracle and/or its affiliates.
+// Copyright (c) 2014, 2018, 2019, Oracle and/or its affiliates.
 
 // Contributed and/or modified by Menelaos Karavelas, on behalf of Oracle
 // Contributed and/or modified by Adam Wulkiewicz, on behalf of Oracle
@@ -30,32 +30,15 @@ inline void
 debug_print_complement_graph(OutputStream& os,
                              complement_graph<TurnPoint> const& graph)
 {
-    typedef typename complement_graph<TurnPoint>::vertex_handle vertex_handle;
-
     os << "num rings: " << graph.m_num_rings << std::endl;
-    os << "vertex ids: {";
-    for (vertex_handle it = graph.m_vertices.begin();
-         it != graph.m_vertices.end(); ++it)
-    {
-        os << " " << it->id();
-    }
-    os << " }" << std::endl;        
-
-    for (vertex_handle it = graph.m_vertices.begin();
-         it != graph.m_vertices.end(); ++it)
+    os << "num turn points: " << graph.m_turn_points.size() << std::endl;
+    os << "edges: {";
+    for (std::size_t i = 0; i < graph.m_edges.size(); ++i)
     {
-        os << "neighbors of " << it->id() << ": {";
-        for (typename complement_graph
-                 <
-                     TurnPoint
-                 >::neighbor_container::const_iterator
-                 nit = graph.m_neighbors[it->id()].begin();
-             nit != graph.m_neighbors[it->id()].end(); ++nit)
-        {
-            os << " " << (*nit)->id();
-        }
-        os << "}" << std::endl;        
+        os << " (" << graph.m_edges[i].first
+           << "," << graph.m_edges[i].second << ")";
     }
+    os << " }" << std::endl;
 }
 #else
 template <typename OutputStream, typename TurnPoint>
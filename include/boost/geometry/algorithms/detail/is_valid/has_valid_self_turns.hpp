@@ -17,6 +17,7 @@
 #include <boost/range.hpp>
 
 #include <boost/geometry/algorithms/detail/is_valid/is_acceptable_turn.hpp>
+#include <boost/geometry/algorithms/detail/is_valid/workspace.hpp>
 #include <boost/geometry/algorithms/detail/overlay/get_turn_info.hpp>
 #include <boost/geometry/algorithms/detail/overlay/turn_info.hpp>
 #include <boost/geometry/algorithms/detail/overlay/self_turn_points.hpp>
@@ -107,8 +108,11 @@ public:
     template <typename VisitPolicy, typename Strategy>
     static inline bool apply(Geometry const& geometry, VisitPolicy& visitor, Strategy const& strategy)
     {
-        std::vector<turn_type> turns;
-        return apply(geometry, turns, visitor, strategy);
+        turns_container
+            <
+                turn_type, VisitPolicy, std::vector<turn_type>
+            > container(visitor);
+        return apply(geometry, container.turns, visitor, strategy);
     }
 };
 
@@ -14,10 +14,13 @@
 #include <sstream>
 #include <string>
 
+#include <boost/range.hpp>
 #include <boost/variant/apply_visitor.hpp>
 #include <boost/variant/static_visitor.hpp>
 #include <boost/variant/variant_fwd.hpp>
 
+#include <boost/geometry/algorithms/detail/is_valid/workspace.hpp>
+#include <boost/geometry/algorithms/detail/overlay/overlay_context.hpp>
 #include <boost/geometry/algorithms/dispatch/is_valid.hpp>
 #include <boost/geometry/core/cs.hpp>
 #include <boost/geometry/geometries/concepts/check.hpp>
@@ -267,6 +270,69 @@ inline bool is_valid(Geometry const& geometry, std::string& message)
 }
 
 
+/*!
+\brief Checks the validity (in the OGC sense) of all geometries of a range
+\ingroup is_valid
+\details The geometries are checked one after another, the containers
+    needed by the checks (e.g. the turns) are allocated once and reused for
+    all geometries of the range. For every geometry an enumeration value
+    indicating that it is valid or not is written to the output iterator.
+\tparam Range Any type fulfilling a Range Concept with geometries as values
+\tparam OutputIterator output iterator with validity_failure_type as value
+\tparam Strategy \tparam_strategy{Is_valid}
+\param geometries range of geometries
+\param out output iterator
+\param strategy \param_strategy{is_valid}
+\return The output iterator past the last written value
+
+\qbk{distinguish,with strategy}
+*/
+template <typename Range, typename OutputIterator, typename Strategy>
+inline OutputIterator is_valid_batch(Range const& geometries,
+                                     OutputIterator out,
+                                     Strategy const& strategy)
+{
+    typedef typename boost::range_value<Range>::type geometry_type;
+    typedef detail::is_valid::workspace_policy
+        <
+            failure_type_policy<>
+        > workspace_policy_type;
+
+    overlay_context context;
+
+    for (typename boost::range_iterator<Range const>::type
+            it = boost::begin(geometries); it != boost::end(geometries); ++it)
+    {
+        failure_type_policy<> visitor;
+        workspace_policy_type policy(visitor, context);
+        resolve_variant::is_valid<geometry_type>::apply(*it, policy, strategy);
+        *out++ = visitor.failure();
+    }
+
+    return out;
+}
+
+/*!
+\brief Checks the validity (in the OGC sense) of all geometries of a range
+\ingroup is_valid
+\details The geometries are checked one after another, the containers
+    needed by the checks (e.g. the turns) are allocated once and reused for
+    all geometries of the range. For every geometry an enumeration value
+    indicating that it is valid or not is written to the output iterator.
+\tparam Range Any type fulfilling a Range Concept with geometries as values
+\tparam OutputIterator output iterator with validity_failure_type as value
+\param geometries range of geometries
+\param out output iterator
+\return The output iterator past the last written value
+*/
+template <typename Range, typename OutputIterator>
+inline OutputIterator is_valid_batch(Range const& geometries,
+                                     OutputIterator out)
+{
+    return is_valid_batch(geometries, out, default_strategy());
+}
+
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_INTERFACE_HPP
@@ -309,7 +309,14 @@ public:
 
         typedef has_valid_self_turns<MultiPolygon> has_valid_turns;
 
-        std::deque<typename has_valid_turns::turn_type> turns;
+        turns_container
+            <
+                typename has_valid_turns::turn_type, VisitPolicy
+            > container(visitor);
+        typename turns_container
+            <
+                typename has_valid_turns::turn_type, VisitPolicy
+            >::turns_type& turns = container.turns;
         bool has_invalid_turns =
             ! has_valid_turns::apply(multipolygon, turns, visitor, strategy);
         debug_print_turns(turns.begin(), turns.end());
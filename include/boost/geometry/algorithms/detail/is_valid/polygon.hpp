@@ -55,6 +55,7 @@
 #include <boost/geometry/algorithms/detail/is_valid/has_valid_self_turns.hpp>
 #include <boost/geometry/algorithms/detail/is_valid/is_acceptable_turn.hpp>
 #include <boost/geometry/algorithms/detail/is_valid/ring.hpp>
+#include <boost/geometry/algorithms/detail/is_valid/workspace.hpp>
 
 #include <boost/geometry/algorithms/detail/is_valid/debug_print_turns.hpp>
 #include <boost/geometry/algorithms/detail/is_valid/debug_validity_phase.hpp>
@@ -455,7 +456,14 @@ public:
 
         typedef has_valid_self_turns<Polygon> has_valid_turns;
 
-        std::deque<typename has_valid_turns::turn_type> turns;
+        turns_container
+            <
+                typename has_valid_turns::turn_type, VisitPolicy
+            > container(visitor);
+        typename turns_container
+            <
+                typename has_valid_turns::turn_type, VisitPolicy
+            >::turns_type& turns = container.turns;
         bool has_invalid_turns
             = ! has_valid_turns::apply(polygon, turns, visitor, strategy);
         debug_print_turns(turns.begin(), turns.end());
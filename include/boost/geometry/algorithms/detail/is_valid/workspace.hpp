@@ -0,0 +1,105 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Licensed under the Boost Software License version 1.0.
+// http://www.boost.org/users/license.html
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_WORKSPACE_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_WORKSPACE_HPP
+
+#include <deque>
+#include <vector>
+
+#include <boost/geometry/algorithms/detail/overlay/overlay_context.hpp>
+#include <boost/geometry/algorithms/validity_failure_type.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace is_valid
+{
+
+
+// visit policy keeping the turns containers in an overlay context, so
+// they are reused when many geometries are validated one after another
+template <typename VisitPolicy>
+class workspace_policy
+{
+public:
+    workspace_policy(VisitPolicy& policy, overlay_context& context)
+        : m_policy(policy)
+        , m_context(context)
+    {}
+
+    template <validity_failure_type Failure>
+    inline bool apply()
+    {
+        return m_policy.template apply<Failure>();
+    }
+
+    template <validity_failure_type Failure, typename Data>
+    inline bool apply(Data const& data)
+    {
+        return m_policy.template apply<Failure>(data);
+    }
+
+    template <validity_failure_type Failure, typename Data1, typename Data2>
+    inline bool apply(Data1 const& data1, Data2 const& data2)
+    {
+        return m_policy.template apply<Failure>(data1, data2);
+    }
+
+    inline overlay_context& context() const
+    {
+        return m_context;
+    }
+
+private:
+    VisitPolicy& m_policy;
+    overlay_context& m_context;
+};
+
+
+// the turns of one validity check, taken from the workspace if any
+template
+<
+    typename Turn,
+    typename VisitPolicy,
+    typename Turns = std::deque<Turn>
+>
+struct turns_container
+{
+    typedef Turns turns_type;
+
+    explicit turns_container(VisitPolicy const& )
+    {}
+
+    turns_type turns;
+};
+
+template <typename Turn, typename VisitPolicy, typename Turns>
+struct turns_container<Turn, workspace_policy<VisitPolicy>, Turns>
+{
+    typedef std::vector<Turn> turns_type;
+
+    explicit turns_container(workspace_policy<VisitPolicy> const& policy)
+        : turns(policy.context().template get<turns_type>())
+    {
+        turns.clear();
+    }
+
+    turns_type& turns;
+};
+
+
+}} // namespace detail::is_valid
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_IS_VALID_WORKSPACE_HPP
@@ -0,0 +1,859 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2019 Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_CLIP_POLYGON_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_CLIP_POLYGON_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/range.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/detail/recalculate.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/policies/robustness/robust_point_type.hpp>
+#include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace intersection
+{
+
+/*!
+\brief Internal, clips the rings of a polygon with a box
+\details Clips clockwise closed rings of cartesian polygons with a box, in
+    the way of Weiler-Atherton for a convex clip window. Every ring is cut
+    into pieces inside the box (Liang-Barsky per segment). The pieces of
+    all rings are then connected by walking clockwise along the box border
+    from the exit point of a piece to the nearest entry point of a piece.
+    Rings completely inside the box are kept, holes are assigned to the
+    ring containing them.
+    The clipper refuses (returns false) for degenerate input: vertices on
+    one of the lines of the box, also after applying the robust policy,
+    ambiguous connections or holes which cannot be assigned. The caller
+    then uses the general overlay.
+    Rings are located with the point in geometry strategy of the
+    intersection strategy.
+*/
+template <typename Box, typename RingOut, typename Strategy, typename RobustPolicy>
+class box_clipper
+{
+    typedef typename point_type<RingOut>::type point_type;
+    typedef typename geometry::robust_point_type
+        <
+            point_type, RobustPolicy
+        >::type robust_point_type;
+    typedef typename select_most_precise
+        <
+            typename coordinate_type<point_type>::type,
+            typename coordinate_type<Box>::type,
+            double
+        >::type calc_type;
+
+    enum edge_type { edge_left = 0, edge_top = 1, edge_right = 2, edge_bottom = 3 };
+
+    struct piece
+    {
+        std::vector<point_type> points;
+        calc_type entry_position;
+        calc_type exit_position;
+        bool visited;
+
+        piece()
+            : entry_position(0)
+            , exit_position(0)
+            , visited(false)
+        {}
+    };
+
+public :
+    inline box_clipper(Box const& box, Strategy const& strategy,
+                       RobustPolicy const& robust_policy)
+        : m_min_x(get<min_corner, 0>(box))
+        , m_min_y(get<min_corner, 1>(box))
+        , m_max_x(get<max_corner, 0>(box))
+        , m_max_y(get<max_corner, 1>(box))
+        , m_strategy(strategy)
+        , m_robust_policy(robust_policy)
+        , m_outer_contains_box(false)
+        , m_box_in_hole(false)
+        , m_degenerate(false)
+    {
+        geometry::recalculate(m_robust_min, make_point(m_min_x, m_min_y),
+                              robust_policy);
+        geometry::recalculate(m_robust_max, make_point(m_max_x, m_max_y),
+                              robust_policy);
+    }
+
+    //! Clips the exterior ring, returns false if the input is degenerate
+    template <typename Ring>
+    inline bool add_exterior_ring(Ring const& ring)
+    {
+        std::size_t const piece_count = m_pieces.size();
+        int const location = add_ring(ring, false);
+        if (location == location_degenerate)
+        {
+            return false;
+        }
+        if (location == location_outside && m_pieces.size() == piece_count)
+        {
+            m_outer_contains_box = box_center_in_ring(ring) > 0;
+        }
+        return true;
+    }
+
+    //! Clips an interior ring, returns false if the input is degenerate
+    template <typename Ring>
+    inline bool add_interior_ring(Ring const& ring)
+    {
+        std::size_t const piece_count = m_pieces.size();
+        int const location = add_ring(ring, true);
+        if (location == location_degenerate)
+        {
+            return false;
+        }
+        if (location == location_outside && m_pieces.size() == piece_count
+            && box_center_in_ring(ring) > 0)
+        {
+            m_box_in_hole = true;
+        }
+        return true;
+    }
+
+    /*!
+    \brief Clips runs of segments of a ring, returns false if the input is
+        degenerate
+    \details A run is a pair of indices of its first and last point. The
+        runs start and end outside the box, the segments between them do
+        not intersect the box, as the sections of a ring not touching the
+        box. Rings completely walked are clipped as in add_exterior_ring
+        and add_interior_ring, without locating the box if they are outside
+        it. The rings containing the box are indicated by the caller.
+    */
+    template <typename Ring, typename Runs>
+    inline bool add_ring_runs(Ring const& ring, Runs const& runs,
+                              bool is_hole, bool& enters)
+    {
+        std::size_t const size = boost::size(ring);
+        enters = false;
+        if (size < 4 || boost::empty(runs))
+        {
+            return false;
+        }
+
+        // The ring is closed, the last point is not visited separately
+        std::size_t const count = size - 1;
+        std::size_t const run_count = boost::size(runs);
+        if (run_count == 1
+            && range::front(runs).first == 0
+            && range::front(runs).second == count)
+        {
+            int const location = add_ring(ring, is_hole);
+            enters = location == location_inside
+                  || location == location_crossing;
+            return location != location_degenerate;
+        }
+
+        for (std::size_t r = 0; r < run_count; r++)
+        {
+            for (std::size_t i = range::at(runs, r).first;
+                 i <= range::at(runs, r).second; i++)
+            {
+                if (on_box_line(get<0>(range::at(ring, i)),
+                                get<1>(range::at(ring, i))))
+                {
+                    return false;
+                }
+            }
+        }
+
+        // A run ending at the closing point continues with the first run
+        // if that starts at the first point
+        std::size_t first_run = 0;
+        std::size_t last_run = run_count;
+        if (run_count > 1
+            && range::front(runs).first == 0
+            && range::back(runs).second == count)
+        {
+            enters = walk(ring, range::back(runs).first,
+                          count - range::back(runs).first
+                              + range::front(runs).second,
+                          count);
+            first_run = 1;
+            last_run = run_count - 1;
+        }
+
+        for (std::size_t r = first_run; r < last_run; r++)
+        {
+            std::size_t const first = range::at(runs, r).first;
+            if (walk(ring, first, range::at(runs, r).second - first, count))
+            {
+                enters = true;
+            }
+        }
+        return true;
+    }
+
+    //! Indicates that the box is inside the exterior ring, or in a hole
+    inline void set_inside_ring(bool is_hole)
+    {
+        (is_hole ? m_box_in_hole : m_outer_contains_box) = true;
+    }
+
+    //! Assembles the clipped rings, returns false if the input is degenerate
+    template <typename Polygons>
+    inline bool assemble(Polygons& polygons)
+    {
+        typedef typename boost::range_value<Polygons>::type polygon_type;
+
+        if (m_box_in_hole)
+        {
+            return true;
+        }
+
+        std::vector<RingOut> outers;
+        if (m_pieces.empty())
+        {
+            if (m_outer_contains_box)
+            {
+                outers.resize(1);
+                add_box(outers.back());
+                close_ring(outers.back());
+            }
+        }
+        else if (m_degenerate || ! connect_pieces(outers))
+        {
+            return false;
+        }
+        outers.insert(outers.end(), m_inside_rings.begin(), m_inside_rings.end());
+
+        if (outers.empty())
+        {
+            return m_holes.empty();
+        }
+
+        std::size_t const first = boost::size(polygons);
+        for (std::size_t i = 0; i < outers.size(); i++)
+        {
+            polygon_type polygon;
+            geometry::exterior_ring(polygon) = outers[i];
+            range::push_back(polygons, polygon);
+        }
+
+        for (std::size_t h = 0; h < m_holes.size(); h++)
+        {
+            std::size_t index = 0;
+            if (outers.size() > 1)
+            {
+                bool found = false;
+                for (std::size_t i = 0; i < outers.size() && ! found; i++)
+                {
+                    int const where = detail::within::point_in_geometry(
+                            range::front(m_holes[h]), outers[i],
+                            m_strategy.template get_point_in_geometry_strategy
+                                <
+                                    point_type, RingOut
+                                >());
+                    if (where == 0)
+                    {
+                        return false;
+                    }
+                    if (where > 0)
+                    {
+                        index = i;
+                        found = true;
+                    }
+                }
+                if (! found)
+                {
+                    return false;
+                }
+            }
+
+            range::push_back(geometry::interior_rings(
+                                range::at(polygons, first + index)),
+                             m_holes[h]);
+        }
+        return true;
+    }
+
+private :
+
+    enum { location_degenerate = 0, location_inside = 1, location_outside = 2,
+           location_crossing = 3 };
+
+    inline bool on_box_line(calc_type const& x, calc_type const& y) const
+    {
+        if (x == m_min_x || x == m_max_x || y == m_min_y || y == m_max_y)
+        {
+            return true;
+        }
+        if (BOOST_GEOMETRY_CONDITION(! RobustPolicy::enabled))
+        {
+            return false;
+        }
+
+        // The overlay would see the vertex on the box line after rescaling
+        robust_point_type robust;
+        geometry::recalculate(robust, make_point(x, y), m_robust_policy);
+        return get<0>(robust) == get<0>(m_robust_min)
+            || get<0>(robust) == get<0>(m_robust_max)
+            || get<1>(robust) == get<1>(m_robust_min)
+            || get<1>(robust) == get<1>(m_robust_max);
+    }
+
+    inline bool inside(calc_type const& x, calc_type const& y) const
+    {
+        return x > m_min_x && x < m_max_x && y > m_min_y && y < m_max_y;
+    }
+
+    // Position along the border, clockwise starting at the minimum corner
+    inline calc_type position(edge_type edge, calc_type const& x, calc_type const& y) const
+    {
+        calc_type const w = m_max_x - m_min_x;
+        calc_type const h = m_max_y - m_min_y;
+        switch (edge)
+        {
+            case edge_left : return y - m_min_y;
+            case edge_top : return h + (x - m_min_x);
+            case edge_right : return h + w + (m_max_y - y);
+            default : return h + h + w + (m_max_x - x);
+        }
+    }
+
+    inline point_type make_point(calc_type const& x, calc_type const& y) const
+    {
+        point_type p;
+        set<0>(p, x);
+        set<1>(p, y);
+        return p;
+    }
+
+    // Clips one segment (Liang-Barsky), keeping which edges are crossed
+    static inline bool check_edge(calc_type const& p, calc_type const& q,
+                                  calc_type& t1, calc_type& t2,
+                                  edge_type edge, edge_type& edge1, edge_type& edge2)
+    {
+        if (p < 0)
+        {
+            calc_type const r = q / p;
+            if (r > t2)
+            {
+                return false;
+            }
+            if (r > t1)
+            {
+                t1 = r;
+                edge1 = edge;
+            }
+        }
+        else if (p > 0)
+        {
+            calc_type const r = q / p;
+            if (r < t1)
+            {
+                return false;
+            }
+            if (r < t2)
+            {
+                t2 = r;
+                edge2 = edge;
+            }
+        }
+        else if (q < 0)
+        {
+            return false;
+        }
+        return true;
+    }
+
+    inline point_type point_on_edge(edge_type edge,
+            calc_type const& x0, calc_type const& y0,
+            calc_type const& dx, calc_type const& dy,
+            calc_type const& t, calc_type& border_position)
+    {
+        calc_type x = x0 + t * dx;
+        calc_type y = y0 + t * dy;
+
+        // Snap on the edge, and keep the other coordinate within the box
+        switch (edge)
+        {
+            case edge_left : x = m_min_x; break;
+            case edge_right : x = m_max_x; break;
+            case edge_top : y = m_max_y; break;
+            default : y = m_min_y; break;
+        }
+        x = (std::min)((std::max)(x, m_min_x), m_max_x);
+        y = (std::min)((std::max)(y, m_min_y), m_max_y);
+
+        if ((x == m_min_x || x == m_max_x) && (y == m_min_y || y == m_max_y))
+        {
+            // Crossing a corner, its position along the border is ambiguous
+            m_degenerate = true;
+        }
+
+        border_position = position(edge, x, y);
+        return make_point(x, y);
+    }
+
+    template <typename Ring>
+    inline int add_ring(Ring const& ring, bool is_hole)
+    {
+        std::size_t const size = boost::size(ring);
+        if (size < 4)
+        {
+            return location_degenerate;
+        }
+
+        // The ring is closed, the last point is not visited separately
+        std::size_t const count = size - 1;
+        std::size_t start = count;
+        std::size_t inside_count = 0;
+        for (std::size_t i = 0; i < count; i++)
+        {
+            calc_type const x = get<0>(range::at(ring, i));
+            calc_type const y = get<1>(range::at(ring, i));
+            if (on_box_line(x, y))
+            {
+                return location_degenerate;
+            }
+            if (inside(x, y))
+            {
+                inside_count++;
+            }
+            else if (start == count)
+            {
+                start = i;
+            }
+        }
+
+        if (inside_count == count)
+        {
+            RingOut copy;
+            geometry::convert(ring, copy);
+            (is_hole ? m_holes : m_inside_rings).push_back(copy);
+            return location_inside;
+        }
+
+        return walk(ring, start, count, count)
+            ? location_crossing : location_outside;
+    }
+
+    // Walks along segments of a ring, starting and ending outside the box,
+    // returns true if the box is entered
+    template <typename Ring>
+    inline bool walk(Ring const& ring, std::size_t start,
+                     std::size_t segment_count, std::size_t count)
+    {
+        bool is_inside = false;
+        bool crossing = false;
+        for (std::size_t k = 0; k < segment_count; k++)
+        {
+            std::size_t const i = (start + k) % count;
+            std::size_t const j = (i + 1) % count;
+            calc_type const x0 = get<0>(range::at(ring, i));
+            calc_type const y0 = get<1>(range::at(ring, i));
+            calc_type const x1 = get<0>(range::at(ring, j));
+            calc_type const y1 = get<1>(range::at(ring, j));
+
+            bool const next_inside = inside(x1, y1);
+
+            if (is_inside && next_inside)
+            {
+                m_pieces.back().points.push_back(make_point(x1, y1));
+                continue;
+            }
+
+            calc_type const dx = x1 - x0;
+            calc_type const dy = y1 - y0;
+            calc_type t1 = 0;
+            calc_type t2 = 1;
+            edge_type edge1 = edge_left;
+            edge_type edge2 = edge_left;
+
+            bool const visible
+                = check_edge(-dx, x0 - m_min_x, t1, t2, edge_left, edge1, edge2)
+                && check_edge(dx, m_max_x - x0, t1, t2, edge_right, edge1, edge2)
+                && check_edge(-dy, y0 - m_min_y, t1, t2, edge_bottom, edge1, edge2)
+                && check_edge(dy, m_max_y - y0, t1, t2, edge_top, edge1, edge2);
+
+            if (! is_inside)
+            {
+                if (! visible || ! (t1 < t2))
+                {
+                    // Outside, or touching the box in one point
+                    continue;
+                }
+
+                // Enter the box
+                crossing = true;
+                m_pieces.push_back(piece());
+                piece& current = m_pieces.back();
+                current.points.push_back(point_on_edge(edge1, x0, y0, dx, dy,
+                                                       t1, current.entry_position));
+                if (next_inside)
+                {
+                    current.points.push_back(make_point(x1, y1));
+                    is_inside = true;
+                    continue;
+                }
+            }
+
+            // Leave the box
+            piece& current = m_pieces.back();
+            current.points.push_back(point_on_edge(edge2, x0, y0, dx, dy,
+                                                   t2, current.exit_position));
+            is_inside = false;
+        }
+
+        return crossing;
+    }
+
+    template <typename Ring>
+    inline int box_center_in_ring(Ring const& ring) const
+    {
+        point_type const center = make_point((m_min_x + m_max_x) / 2,
+                                             (m_min_y + m_max_y) / 2);
+        return detail::within::point_in_geometry(center, ring,
+                m_strategy.template get_point_in_geometry_strategy
+                    <
+                        point_type, Ring
+                    >());
+    }
+
+    // Adds the box corners strictly between two positions along the border
+    inline void add_corners(RingOut& ring, calc_type const& from,
+                            calc_type const& to, bool wrap) const
+    {
+        calc_type const w = m_max_x - m_min_x;
+        calc_type const h = m_max_y - m_min_y;
+        calc_type const corner_positions[3] = { h, h + w, h + h + w };
+        point_type const corners[3] =
+            {
+                make_point(m_min_x, m_max_y),
+                make_point(m_max_x, m_max_y),
+                make_point(m_max_x, m_min_y)
+            };
+
+        for (int i = 0; i < 3; i++)
+        {
+            if (corner_positions[i] > from && (wrap || corner_positions[i] < to))
+            {
+                range::push_back(ring, corners[i]);
+            }
+        }
+        if (wrap)
+        {
+            // The minimum corner is at the start (and end) of the border
+            range::push_back(ring, make_point(m_min_x, m_min_y));
+            for (int i = 0; i < 3; i++)
+            {
+                if (corner_positions[i] < to)
+                {
+                    range::push_back(ring, corners[i]);
+                }
+            }
+        }
+    }
+
+    inline void add_box(RingOut& ring) const
+    {
+        range::push_back(ring, make_point(m_min_x, m_min_y));
+        range::push_back(ring, make_point(m_min_x, m_max_y));
+        range::push_back(ring, make_point(m_max_x, m_max_y));
+        range::push_back(ring, make_point(m_max_x, m_min_y));
+    }
+
+    static inline void close_ring(RingOut& ring)
+    {
+        point_type const first = range::front(ring);
+        range::push_back(ring, first);
+    }
+
+    inline bool connect_pieces(std::vector<RingOut>& outers)
+    {
+        // Sort piece indices on their entry position along the border
+        std::vector<std::pair<calc_type, std::size_t> > entries;
+        entries.reserve(m_pieces.size());
+        for (std::size_t i = 0; i < m_pieces.size(); i++)
+        {
+            entries.push_back(std::make_pair(m_pieces[i].entry_position, i));
+        }
+        std::sort(entries.begin(), entries.end());
+
+        for (std::size_t i = 1; i < entries.size(); i++)
+        {
+            if (entries[i].first == entries[i - 1].first)
+            {
+                return false;
+            }
+        }
+
+        for (std::size_t start = 0; start < m_pieces.size(); start++)
+        {
+            if (m_pieces[start].visited)
+            {
+                continue;
+            }
+
+            outers.resize(outers.size() + 1);
+            RingOut& ring = outers.back();
+
+            std::size_t current = start;
+            for (;;)
+            {
+                piece& p = m_pieces[current];
+                if (p.visited)
+                {
+                    // A connection to a piece of another ring
+                    return false;
+                }
+                p.visited = true;
+                for (std::size_t i = 0; i < p.points.size(); i++)
+                {
+                    range::push_back(ring, p.points[i]);
+                }
+
+                // Find the next entry, walking clockwise along the border
+                typename std::vector<std::pair<calc_type, std::size_t> >::const_iterator
+                    it = std::upper_bound(entries.begin(), entries.end(),
+                            std::make_pair(p.exit_position, m_pieces.size()));
+                bool const wrap = it == entries.end();
+                if (wrap)
+                {
+                    it = entries.begin();
+                }
+                if (it->first == p.exit_position)
+                {
+                    return false;
+                }
+
+                add_corners(ring, p.exit_position, it->first, wrap);
+
+                current = it->second;
+                if (current == start)
+                {
+                    break;
+                }
+            }
+
+            close_ring(ring);
+        }
+        return true;
+    }
+
+    calc_type m_min_x, m_min_y, m_max_x, m_max_y;
+    robust_point_type m_robust_min, m_robust_max;
+    Strategy const& m_strategy;
+    RobustPolicy const& m_robust_policy;
+    std::vector<piece> m_pieces;
+    std::vector<RingOut> m_inside_rings;
+    std::vector<RingOut> m_holes;
+    bool m_outer_contains_box;
+    bool m_box_in_hole;
+    bool m_degenerate;
+};
+
+
+// Whether an areal geometry can be clipped with the box clipper
+template <typename Areal, typename Box, typename GeometryOut>
+struct is_box_clippable
+{
+    static const bool value =
+        ! boost::is_same<typename tag<Areal>::type, box_tag>::value
+        && boost::is_same<typename cs_tag<Areal>::type, cartesian_tag>::value
+        && boost::is_same<typename cs_tag<Box>::type, cartesian_tag>::value
+        && boost::is_floating_point
+            <
+                typename coordinate_type<GeometryOut>::type
+            >::value
+        && boost::is_same<typename tag<GeometryOut>::type, polygon_tag>::value
+        && geometry::point_order<Areal>::value == clockwise
+        && geometry::point_order<GeometryOut>::value == clockwise
+        && geometry::closure<Areal>::value == closed
+        && geometry::closure<GeometryOut>::value == closed;
+};
+
+
+template <typename Tag>
+struct clip_areal_with_box_dispatch
+{};
+
+template <>
+struct clip_areal_with_box_dispatch<ring_tag>
+{
+    template
+    <
+        typename Ring, typename Box, typename Polygons,
+        typename Strategy, typename RobustPolicy
+    >
+    static inline bool apply(Ring const& ring, Box const& box, Polygons& polygons,
+                             Strategy const& strategy,
+                             RobustPolicy const& robust_policy)
+    {
+        typedef typename boost::range_value<Polygons>::type polygon_type;
+        typedef typename ring_type<polygon_type>::type ring_out_type;
+
+        box_clipper<Box, ring_out_type, Strategy, RobustPolicy>
+            clipper(box, strategy, robust_policy);
+        return clipper.add_exterior_ring(ring)
+            && clipper.assemble(polygons);
+    }
+};
+
+template <>
+struct clip_areal_with_box_dispatch<polygon_tag>
+{
+    template
+    <
+        typename Polygon, typename Box, typename Polygons,
+        typename Strategy, typename RobustPolicy
+    >
+    static inline bool apply(Polygon const& polygon, Box const& box, Polygons& polygons,
+                             Strategy const& strategy,
+                             RobustPolicy const& robust_policy)
+    {
+        typedef typename boost::range_value<Polygons>::type polygon_type;
+        typedef typename ring_type<polygon_type>::type ring_out_type;
+
+        box_clipper<Box, ring_out_type, Strategy, RobustPolicy>
+            clipper(box, strategy, robust_policy);
+        if (! clipper.add_exterior_ring(geometry::exterior_ring(polygon)))
+        {
+            return false;
+        }
+
+        typename interior_return_type<Polygon const>::type
+            rings = geometry::interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            if (! clipper.add_interior_ring(*it))
+            {
+                return false;
+            }
+        }
+
+        return clipper.assemble(polygons);
+    }
+};
+
+template <>
+struct clip_areal_with_box_dispatch<multi_polygon_tag>
+{
+    template
+    <
+        typename MultiPolygon, typename Box, typename Polygons,
+        typename Strategy, typename RobustPolicy
+    >
+    static inline bool apply(MultiPolygon const& multi_polygon, Box const& box,
+                             Polygons& polygons, Strategy const& strategy,
+                             RobustPolicy const& robust_policy)
+    {
+        for (typename boost::range_iterator<MultiPolygon const>::type
+                it = boost::begin(multi_polygon);
+             it != boost::end(multi_polygon); ++it)
+        {
+            if (! clip_areal_with_box_dispatch<polygon_tag>::apply(*it, box,
+                        polygons, strategy, robust_policy))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+
+/*!
+\brief Internal, intersects an areal geometry with a box
+\details Uses the box clipper for clockwise closed cartesian polygons, and
+    the general overlay for other input or if the clipper refuses it. A box
+    without area gives no output, as in the general overlay.
+*/
+template
+<
+    typename Areal, typename Box, typename GeometryOut,
+    typename Overlay,
+    bool Clippable = is_box_clippable<Areal, Box, GeometryOut>::value
+>
+struct clip_areal_with_box
+{
+    template <typename RobustPolicy, typename OutputIterator, typename Strategy>
+    static inline OutputIterator apply(Areal const& areal, Box const& box,
+            RobustPolicy const& robust_policy,
+            OutputIterator out, Strategy const& strategy)
+    {
+        return Overlay::apply(areal, box, robust_policy, out, strategy);
+    }
+};
+
+template <typename Areal, typename Box, typename GeometryOut, typename Overlay>
+struct clip_areal_with_box<Areal, Box, GeometryOut, Overlay, true>
+{
+    template <typename RobustPolicy, typename OutputIterator, typename Strategy>
+    static inline OutputIterator apply(Areal const& areal, Box const& box,
+            RobustPolicy const& robust_policy,
+            OutputIterator out, Strategy const& strategy)
+    {
+        if (! (get<min_corner, 0>(box) < get<max_corner, 0>(box)
+               && get<min_corner, 1>(box) < get<max_corner, 1>(box)))
+        {
+            return out;
+        }
+
+        std::vector<GeometryOut> polygons;
+        if (! clip_areal_with_box_dispatch
+                <
+                    typename tag<Areal>::type
+                >::apply(areal, box, polygons, strategy, robust_policy))
+        {
+            return Overlay::apply(areal, box, robust_policy, out, strategy);
+        }
+
+        for (typename std::vector<GeometryOut>::const_iterator
+                it = polygons.begin(); it != polygons.end(); ++it)
+        {
+            *out++ = *it;
+        }
+        return out;
+    }
+};
+
+
+}} // namespace detail::intersection
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_CLIP_POLYGON_HPP
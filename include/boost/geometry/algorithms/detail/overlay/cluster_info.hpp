@@ -10,8 +10,7 @@
 #define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_CLUSTER_INFO_HPP
 
 
-#include <set>
-#include <boost/geometry/algorithms/detail/signed_size_type.hpp>
+#include <boost/geometry/algorithms/detail/overlay/turn_index_set.hpp>
 
 
 namespace boost { namespace geometry
@@ -24,7 +23,7 @@ namespace detail { namespace overlay
 
 struct cluster_info
 {
-    std::set<signed_size_type> turn_indices;
+    turn_index_set turn_indices;
 
     //! Number of open spaces (e.g. 2 for touch)
     std::size_t open_count;
@@ -17,8 +17,6 @@
 
 #include <cstddef>
 #include <algorithm>
-#include <map>
-#include <set>
 #include <vector>
 
 #ifdef BOOST_GEOMETRY_DEBUG_ENRICH
@@ -277,13 +275,45 @@ inline void enrich_adapt(Operations& operations, Turns& turns)
         boost::end(operations), predicate), boost::end(operations));
 }
 
-template <typename Turns, typename MappedVector>
-inline void create_map(Turns const& turns, MappedVector& mapped_vector)
+template <typename Indexed>
+inline ring_identifier ring_id_of(Indexed const& indexed)
+{
+    return ring_identifier(indexed.subject->seg_id.source_index,
+                           indexed.subject->seg_id.multi_index,
+                           indexed.subject->seg_id.ring_index);
+}
+
+// Sorts indexed operations on ring, and within a ring on turn index,
+// which is the order of insertion into a map of vectors per ring
+struct less_by_ring_and_turn
+{
+    template <typename Indexed>
+    inline bool operator()(Indexed const& left, Indexed const& right) const
+    {
+        ring_identifier const left_ring = ring_id_of(left);
+        ring_identifier const right_ring = ring_id_of(right);
+        if (left_ring != right_ring)
+        {
+            return left_ring < right_ring;
+        }
+        return left.turn_index != right.turn_index
+            ? left.turn_index < right.turn_index
+            : left.operation_index < right.operation_index;
+    }
+};
+
+// Collects the operations of all rings into one flat vector, grouped per
+// ring. This avoids a map-node and a vector allocation per ring.
+template <typename Turns, typename IndexedOperations>
+inline void create_ring_operations(Turns const& turns,
+                                   IndexedOperations& operations)
 {
     typedef typename boost::range_value<Turns>::type turn_type;
     typedef typename turn_type::container_type container_type;
-    typedef typename MappedVector::mapped_type mapped_type;
-    typedef typename boost::range_value<mapped_type>::type indexed_type;
+    typedef typename boost::range_value<IndexedOperations>::type indexed_type;
+
+    operations.clear();
+    operations.reserve(2 * boost::size(turns));
 
     std::size_t index = 0;
     for (typename boost::range_iterator<Turns const>::type
@@ -306,19 +336,27 @@ inline void create_map(Turns const& turns, MappedVector& mapped_vector)
             op_it != boost::end(turn.operations);
             ++op_it, ++op_index)
         {
-            ring_identifier const ring_id
-                (
-                    op_it->seg_id.source_index,
-                    op_it->seg_id.multi_index,
-                    op_it->seg_id.ring_index
-                );
-            mapped_vector[ring_id].push_back
+            operations.push_back
                 (
                     indexed_type(index, op_index, *op_it,
                         it->operations[1 - op_index].seg_id)
                 );
         }
     }
+
+    std::sort(operations.begin(), operations.end(), less_by_ring_and_turn());
+}
+
+// Returns the iterator after the last operation on the ring of the first
+template <typename Iterator>
+inline Iterator end_of_ring(Iterator first, Iterator last)
+{
+    ring_identifier const ring_id = ring_id_of(*first);
+    Iterator it = first;
+    for (++it; it != last && ring_id_of(*it) == ring_id; ++it)
+    {
+    }
+    return it;
 }
 
 template <typename Point1, typename Point2>
@@ -379,11 +417,14 @@ inline void calculate_remaining_distance(Turns& turns)
 \tparam Turns type of intersection container
             (e.g. vector of "intersection/turn point"'s)
 \tparam Clusters type of cluster container
+\tparam Operations vector of indexed turn operations
 \tparam Geometry1 \tparam_geometry
 \tparam Geometry2 \tparam_geometry
 \tparam SideStrategy side strategy type
 \param turns container containing intersection points
 \param clusters container containing clusters
+\param operations container used to sort the operations per ring, its
+    contents is replaced
 \param geometry1 \param_geometry
 \param geometry2 \param_geometry
 \param robust_policy policy to handle robustness issues
@@ -395,12 +436,14 @@ template
     overlay_type OverlayType,
     typename Turns,
     typename Clusters,
+    typename Operations,
     typename Geometry1, typename Geometry2,
     typename RobustPolicy,
     typename SideStrategy
 >
 inline void enrich_intersection_points(Turns& turns,
     Clusters& clusters,
+    Operations& operations,
     Geometry1 const& geometry1, Geometry2 const& geometry2,
     RobustPolicy const& robust_policy,
     SideStrategy const& strategy)
@@ -414,17 +457,10 @@ inline void enrich_intersection_points(Turns& turns,
     static const bool is_dissolve = OverlayType == overlay_dissolve;
 
     typedef typename boost::range_value<Turns>::type turn_type;
-    typedef typename turn_type::turn_operation_type op_type;
-    typedef detail::overlay::indexed_turn_operation
-        <
-            op_type
-        > indexed_turn_operation;
 
-    typedef std::map
-        <
-            ring_identifier,
-            std::vector<indexed_turn_operation>
-        > mapped_vector_type;
+    typedef Operations operation_vector_type;
+    typedef typename operation_vector_type::iterator operation_iterator;
+    typedef boost::iterator_range<operation_iterator> ring_operations_type;
 
     bool has_cc = false;
     bool const has_colocations
@@ -482,44 +518,52 @@ inline void enrich_intersection_points(Turns& turns,
             >::apply(turns, clusters, geometry1, geometry2);
     }
 
-    // Create a map of vectors of indexed operation-types to be able
-    // to sort intersection points PER RING
-    mapped_vector_type mapped_vector;
+    // Fill the vector of indexed operation-types, grouped per ring, to be
+    // able to sort intersection points PER RING
+    detail::overlay::create_ring_operations(turns, operations);
 
-    detail::overlay::create_map(turns, mapped_vector);
-
-    // No const-iterator; contents of mapped copy is temporary,
-    // and changed by enrich
-    for (typename mapped_vector_type::iterator mit
-        = mapped_vector.begin();
-        mit != mapped_vector.end();
-        ++mit)
+    // Contents of operations is temporary, and changed by enrich
+    for (operation_iterator it = operations.begin(); it != operations.end(); )
     {
+        operation_iterator const ring_end
+            = detail::overlay::end_of_ring(it, operations.end());
+        ring_operations_type ring_operations(it, ring_end);
+
 #ifdef BOOST_GEOMETRY_DEBUG_ENRICH
     std::cout << "ENRICH-sort Ring "
-        << mit->first << std::endl;
+        << detail::overlay::ring_id_of(*it) << std::endl;
 #endif
         detail::overlay::enrich_sort<Reverse1, Reverse2>(
-                    mit->second, turns,
+                    ring_operations, turns,
                     geometry1, geometry2,
                     robust_policy, strategy);
+        it = ring_end;
     }
 
-    for (typename mapped_vector_type::iterator mit
-        = mapped_vector.begin();
-        mit != mapped_vector.end();
-        ++mit)
+    // Dissolve might remove operations, they are copied to be erasable
+    operation_vector_type dissolve_operations;
+
+    for (operation_iterator it = operations.begin(); it != operations.end(); )
     {
+        operation_iterator const ring_end
+            = detail::overlay::end_of_ring(it, operations.end());
+
 #ifdef BOOST_GEOMETRY_DEBUG_ENRICH
     std::cout << "ENRICH-assign Ring "
-        << mit->first << std::endl;
+        << detail::overlay::ring_id_of(*it) << std::endl;
 #endif
         if (is_dissolve)
         {
-            detail::overlay::enrich_adapt(mit->second, turns);
+            dissolve_operations.assign(it, ring_end);
+            detail::overlay::enrich_adapt(dissolve_operations, turns);
+            detail::overlay::enrich_assign(dissolve_operations, turns, false);
         }
-
-        detail::overlay::enrich_assign(mit->second, turns, ! is_dissolve);
+        else
+        {
+            ring_operations_type ring_operations(it, ring_end);
+            detail::overlay::enrich_assign(ring_operations, turns, true);
+        }
+        it = ring_end;
     }
 
     if (has_colocations)
@@ -548,6 +592,50 @@ inline void enrich_intersection_points(Turns& turns,
 
 }
 
+
+/*!
+\brief All intersection points are enriched with successor information
+\ingroup overlay
+\tparam Turns type of intersection container
+            (e.g. vector of "intersection/turn point"'s)
+\tparam Clusters type of cluster container
+\tparam Geometry1 \tparam_geometry
+\tparam Geometry2 \tparam_geometry
+\tparam SideStrategy side strategy type
+\param turns container containing intersection points
+\param clusters container containing clusters
+\param geometry1 \param_geometry
+\param geometry2 \param_geometry
+\param robust_policy policy to handle robustness issues
+\param strategy strategy
+ */
+template
+<
+    bool Reverse1, bool Reverse2,
+    overlay_type OverlayType,
+    typename Turns,
+    typename Clusters,
+    typename Geometry1, typename Geometry2,
+    typename RobustPolicy,
+    typename SideStrategy
+>
+inline void enrich_intersection_points(Turns& turns,
+    Clusters& clusters,
+    Geometry1 const& geometry1, Geometry2 const& geometry2,
+    RobustPolicy const& robust_policy,
+    SideStrategy const& strategy)
+{
+    typedef typename boost::range_value<Turns>::type turn_type;
+    typedef detail::overlay::indexed_turn_operation
+        <
+            typename turn_type::turn_operation_type
+        > indexed_turn_operation;
+
+    std::vector<indexed_turn_operation> operations;
+    enrich_intersection_points<Reverse1, Reverse2, OverlayType>(turns,
+        clusters, operations, geometry1, geometry2, robust_policy, strategy);
+}
+
 }} // namespace boost::geometry
 
 #endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_ENRICH_HPP
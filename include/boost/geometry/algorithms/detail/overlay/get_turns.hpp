@@ -3,8 +3,8 @@
 // Copyright (c) 2007-2012 Barend Gehrels, Amsterdam, the Netherlands.
 // Copyright (c) 2014-2017 Adam Wulkiewicz, Lodz, Poland.
 
-// This file was modified by Oracle on 2014, 2016, 2017, 2018.
-// Modifications copyright (c) 2014-2018 Oracle and/or its affiliates.
+// This file was modified by Oracle on 2014, 2016, 2017, 2018, 2019.
+// Modifications copyright (c) 2014-2019 Oracle and/or its affiliates.
 
 // Contributed and/or modified by Adam Wulkiewicz, on behalf of Oracle
 
@@ -319,8 +319,14 @@ public :
             return true;
         }
 
-        cview_type1 cview1(range_by_section(geometry1, sec1));
-        cview_type2 cview2(range_by_section(geometry2, sec2));
+        // Rings of views may be returned by value, keep them alive
+        typename ring_return_type<Geometry1 const>::type
+            range1 = range_by_section(geometry1, sec1);
+        typename ring_return_type<Geometry2 const>::type
+            range2 = range_by_section(geometry2, sec2);
+
+        cview_type1 cview1(range1);
+        cview_type2 cview2(range2);
         view_type1 view1(cview1);
         view_type2 view2(cview2);
 
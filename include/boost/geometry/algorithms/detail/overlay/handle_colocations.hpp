@@ -342,7 +342,7 @@ inline void remove_clusters(Turns& turns, Clusters& clusters)
         typename Clusters::iterator current_it = it;
         ++it;
 
-        std::set<signed_size_type> const& turn_indices
+        turn_index_set const& turn_indices
                 = current_it->second.turn_indices;
         if (turn_indices.size() == 1)
         {
@@ -353,6 +353,21 @@ inline void remove_clusters(Turns& turns, Clusters& clusters)
     }
 }
 
+template <typename Turns>
+struct is_discarded_turn
+{
+    explicit is_discarded_turn(Turns const& turns)
+        : m_turns(turns)
+    {}
+
+    inline bool operator()(signed_size_type turn_index) const
+    {
+        return m_turns[turn_index].discarded;
+    }
+
+    Turns const& m_turns;
+};
+
 template <typename Turns, typename Clusters>
 inline void cleanup_clusters(Turns& turns, Clusters& clusters)
 {
@@ -360,20 +375,7 @@ inline void cleanup_clusters(Turns& turns, Clusters& clusters)
     for (typename Clusters::iterator mit = clusters.begin();
          mit != clusters.end(); ++mit)
     {
-        cluster_info& cinfo = mit->second;
-        std::set<signed_size_type>& ids = cinfo.turn_indices;
-        for (std::set<signed_size_type>::iterator sit = ids.begin();
-             sit != ids.end(); /* no increment */)
-        {
-            std::set<signed_size_type>::iterator current_it = sit;
-            ++sit;
-
-            signed_size_type const turn_index = *current_it;
-            if (turns[turn_index].discarded)
-            {
-                ids.erase(current_it);
-            }
-        }
+        mit->second.turn_indices.erase_if(is_discarded_turn<Turns>(turns));
     }
 
     remove_clusters(turns, clusters);
@@ -446,16 +448,16 @@ template
 >
 inline void discard_interior_exterior_turns(Turns& turns, Clusters& clusters)
 {
-    typedef std::set<signed_size_type>::const_iterator set_iterator;
+    typedef turn_index_set::const_iterator set_iterator;
     typedef typename boost::range_value<Turns>::type turn_type;
 
-    std::set<signed_size_type> ids_to_remove;
+    turn_index_set ids_to_remove;
 
     for (typename Clusters::iterator cit = clusters.begin();
          cit != clusters.end(); ++cit)
     {
         cluster_info& cinfo = cit->second;
-        std::set<signed_size_type>& ids = cinfo.turn_indices;
+        turn_index_set& ids = cinfo.turn_indices;
 
         ids_to_remove.clear();
 
@@ -512,14 +514,14 @@ template
 >
 inline void set_colocation(Turns& turns, Clusters const& clusters)
 {
-    typedef std::set<signed_size_type>::const_iterator set_iterator;
+    typedef turn_index_set::const_iterator set_iterator;
     typedef typename boost::range_value<Turns>::type turn_type;
 
     for (typename Clusters::const_iterator cit = clusters.begin();
          cit != clusters.end(); ++cit)
     {
         cluster_info const& cinfo = cit->second;
-        std::set<signed_size_type> const& ids = cinfo.turn_indices;
+        turn_index_set const& ids = cinfo.turn_indices;
 
         bool both_target = false;
         for (set_iterator it = ids.begin(); it != ids.end(); ++it)
@@ -567,7 +569,7 @@ inline void check_colocation(bool& has_blocked,
 
     cluster_info const& cinfo = mit->second;
 
-    for (std::set<signed_size_type>::const_iterator it
+    for (turn_index_set::const_iterator it
          = cinfo.turn_indices.begin();
          it != cinfo.turn_indices.end(); ++it)
     {
@@ -767,7 +769,7 @@ inline void gather_cluster_properties(Clusters& clusters, Turns& turns,
          mit != clusters.end(); ++mit)
     {
         cluster_info& cinfo = mit->second;
-        std::set<signed_size_type> const& ids = cinfo.turn_indices;
+        turn_index_set const& ids = cinfo.turn_indices;
         if (ids.empty())
         {
             continue;
@@ -777,7 +779,7 @@ inline void gather_cluster_properties(Clusters& clusters, Turns& turns,
         point_type turn_point; // should be all the same for all turns in cluster
 
         bool first = true;
-        for (std::set<signed_size_type>::const_iterator sit = ids.begin();
+        for (turn_index_set::const_iterator sit = ids.begin();
              sit != ids.end(); ++sit)
         {
             signed_size_type turn_index = *sit;
@@ -116,7 +116,7 @@ private :
         }
 
         cluster_info const& cinfo = cit->second;
-        for (std::set<signed_size_type>::const_iterator it
+        for (turn_index_set::const_iterator it
              = cinfo.turn_indices.begin();
              it != cinfo.turn_indices.end(); ++it)
         {
@@ -151,7 +151,7 @@ private :
                                                        geometry0, geometry1))
                 {
                     // Discard all turns in cluster
-                    for (std::set<signed_size_type>::const_iterator sit
+                    for (turn_index_set::const_iterator sit
                          = cinfo.turn_indices.begin();
                          sit != cinfo.turn_indices.end(); ++sit)
                     {
@@ -30,6 +30,7 @@
 #include <boost/geometry/algorithms/convert.hpp>
 #include <boost/geometry/algorithms/detail/point_on_border.hpp>
 #include <boost/geometry/algorithms/detail/overlay/clip_linestring.hpp>
+#include <boost/geometry/algorithms/detail/overlay/clip_polygon.hpp>
 #include <boost/geometry/algorithms/detail/overlay/follow.hpp>
 #include <boost/geometry/algorithms/detail/overlay/get_intersection_points.hpp>
 #include <boost/geometry/algorithms/detail/overlay/overlay.hpp>
@@ -728,7 +729,7 @@ struct intersection_insert
 {};
 
 
-// Any areal type with box:
+// Any areal type with box, intersections are clipped if possible:
 template
 <
     typename Geometry, typename Box,
@@ -745,8 +746,21 @@ struct intersection_insert
         Reverse1, Reverse2, ReverseOut,
         TagIn, box_tag, TagOut,
         areal_tag, areal_tag, areal_tag
-    > : detail::overlay::overlay
-        <Geometry, Box, Reverse1, Reverse2, ReverseOut, GeometryOut, OverlayType>
+    > : detail::intersection::clip_areal_with_box
+        <
+            Geometry, Box, GeometryOut,
+            detail::overlay::overlay
+                <
+                    Geometry, Box, Reverse1, Reverse2, ReverseOut,
+                    GeometryOut, OverlayType
+                >,
+            OverlayType == overlay_intersection
+                && ! Reverse1 && ! ReverseOut
+                && detail::intersection::is_box_clippable
+                    <
+                        Geometry, Box, GeometryOut
+                    >::value
+        >
 {};
 
 
@@ -30,6 +30,7 @@
 #include <boost/geometry/algorithms/detail/overlay/get_turns.hpp>
 #include <boost/geometry/algorithms/detail/overlay/is_self_turn.hpp>
 #include <boost/geometry/algorithms/detail/overlay/needs_self_turns.hpp>
+#include <boost/geometry/algorithms/detail/overlay/overlay_context.hpp>
 #include <boost/geometry/algorithms/detail/overlay/overlay_type.hpp>
 #include <boost/geometry/algorithms/detail/overlay/traverse.hpp>
 #include <boost/geometry/algorithms/detail/overlay/traversal_info.hpp>
@@ -289,7 +290,13 @@ struct overlay
             point_type,
             typename geometry::segment_ratio_type<point_type, RobustPolicy>::type
         > turn_info;
-        typedef std::deque<turn_info> turn_container_type;
+        typedef detail::overlay::overlay_containers
+            <
+                turn_info,
+                indexed_turn_operation<typename turn_info::turn_operation_type>,
+                Strategy
+            > containers_type;
+        typedef typename containers_type::turns_type turn_container_type;
 
         typedef std::deque
             <
@@ -303,7 +310,10 @@ struct overlay
                 cluster_info
             > cluster_type;
 
-        turn_container_type turns;
+        // Turns and enrichment containers, constructed per call or taken
+        // from the overlay context
+        containers_type containers(strategy);
+        turn_container_type& turns = containers.turns;
 
 #ifdef BOOST_GEOMETRY_DEBUG_ASSEMBLE
 std::cout << "get turns" << std::endl;
@@ -339,7 +349,7 @@ std::cout << "enrich" << std::endl;
         std::map<ring_identifier, ring_turn_info> turn_info_per_ring;
 
         geometry::enrich_intersection_points<Reverse1, Reverse2, OverlayType>(turns,
-                clusters, geometry1, geometry2,
+                clusters, containers.operations, geometry1, geometry2,
                     robust_policy,
                     side_strategy);
 
@@ -0,0 +1,203 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2019 Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_OVERLAY_CONTEXT_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_OVERLAY_CONTEXT_HPP
+
+
+#include <cstddef>
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace overlay
+{
+
+// The address of the static member is unique per type, and used as a key
+template <typename Container>
+struct context_key
+{
+    static char const id;
+};
+
+template <typename Container>
+char const context_key<Container>::id = 0;
+
+}} // namespace detail::overlay
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Workspace keeping the temporary containers of overlay operations
+\ingroup overlay
+\details The turns and enrichment containers of intersection, union_,
+    difference and sym_difference are taken from the context instead of
+    being constructed for each call. They are cleared, but not freed,
+    between calls, so repeated overlays of small geometries do not
+    allocate once the containers have grown. The context is passed with
+    the strategy, see overlay_context_strategy.
+\note A context may be used by one call at a time; use one context per thread.
+*/
+class overlay_context : boost::noncopyable
+{
+public :
+    inline overlay_context()
+    {}
+
+    inline ~overlay_context()
+    {
+        release();
+    }
+
+    //! Frees all containers and the memory they hold
+    inline void release()
+    {
+        for (std::size_t i = 0; i < m_slots.size(); i++)
+        {
+            delete m_slots[i].second;
+        }
+        m_slots.clear();
+    }
+
+    //! Returns the container of the specified type, created on first use.
+    //! Its contents are as left by the previous call.
+    template <typename Container>
+    inline Container& get()
+    {
+        void const* const key = &detail::overlay::context_key<Container>::id;
+        for (std::size_t i = 0; i < m_slots.size(); i++)
+        {
+            if (m_slots[i].first == key)
+            {
+                return static_cast<holder<Container>*>(m_slots[i].second)->value;
+            }
+        }
+
+        holder<Container>* created = new holder<Container>();
+        m_slots.push_back(std::make_pair(key, created));
+        return created->value;
+    }
+
+private :
+    struct holder_base
+    {
+        virtual ~holder_base() {}
+    };
+
+    template <typename Container>
+    struct holder : holder_base
+    {
+        Container value;
+    };
+
+    std::vector<std::pair<void const*, holder_base*> > m_slots;
+};
+
+
+/*!
+\brief Intersection strategy carrying an overlay context
+\ingroup overlay
+\details Behaves as the wrapped strategy. Passed to intersection, union_,
+    difference or sym_difference, the overlay takes its temporary
+    containers from the context.
+\tparam Strategy \tparam_strategy{Intersection}
+*/
+template <typename Strategy>
+class overlay_context_strategy : public Strategy
+{
+public :
+    explicit inline overlay_context_strategy(overlay_context& context,
+            Strategy const& strategy = Strategy())
+        : Strategy(strategy)
+        , m_context(&context)
+    {}
+
+    inline overlay_context& context() const
+    {
+        return *m_context;
+    }
+
+private :
+    overlay_context* m_context;
+};
+
+
+/*!
+\brief Combines an intersection strategy with an overlay context
+\ingroup overlay
+\param context the overlay context
+\param strategy \param_strategy{intersection}
+\return the strategy carrying the context
+*/
+template <typename Strategy>
+inline overlay_context_strategy<Strategy>
+with_overlay_context(overlay_context& context, Strategy const& strategy)
+{
+    return overlay_context_strategy<Strategy>(context, strategy);
+}
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace overlay
+{
+
+/*!
+\brief Internal, the turns and enrichment containers of one overlay call
+\details By default they are constructed per call. If the strategy carries
+    an overlay context, vectors are taken from the context and cleared,
+    keeping their capacity.
+*/
+template <typename Turn, typename Operation, typename Strategy>
+struct overlay_containers
+{
+    typedef std::deque<Turn> turns_type;
+    typedef std::vector<Operation> operations_type;
+
+    explicit inline overlay_containers(Strategy const& )
+    {}
+
+    turns_type turns;
+    operations_type operations;
+};
+
+template <typename Turn, typename Operation, typename Strategy>
+struct overlay_containers<Turn, Operation, overlay_context_strategy<Strategy> >
+{
+    typedef std::vector<Turn> turns_type;
+    typedef std::vector<Operation> operations_type;
+
+    explicit inline overlay_containers(
+            overlay_context_strategy<Strategy> const& strategy)
+        : turns(strategy.context().template get<turns_type>())
+        , operations(strategy.context().template get<operations_type>())
+    {
+        turns.clear();
+        operations.clear();
+    }
+
+    turns_type& turns;
+    operations_type& operations;
+};
+
+
+}} // namespace detail::overlay
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_OVERLAY_CONTEXT_HPP
@@ -201,9 +201,9 @@ public :
         BOOST_ASSERT(mit != m_clusters.end());
 
         cluster_info const& cinfo = mit->second;
-        std::set<signed_size_type> const& ids = cinfo.turn_indices;
+        turn_index_set const& ids = cinfo.turn_indices;
 
-        for (typename std::set<signed_size_type>::const_iterator it = ids.begin();
+        for (turn_index_set::const_iterator it = ids.begin();
              it != ids.end(); ++it)
         {
             signed_size_type const turn_index = *it;
@@ -788,10 +788,10 @@ public :
     // second turn points further.
     inline bool select_turn_from_cluster_linked(signed_size_type& turn_index,
             int& op_index,
-            std::set<signed_size_type> const& ids,
+            turn_index_set const& ids,
             segment_identifier const& previous_seg_id) const
     {
-        typedef typename std::set<signed_size_type>::const_iterator sit_type;
+        typedef turn_index_set::const_iterator sit_type;
 
         std::vector<linked_turn_op_info> possibilities;
         std::vector<linked_turn_op_info> blocked;
@@ -921,10 +921,10 @@ public :
 
     inline bool fill_sbs(sbs_type& sbs,
                          signed_size_type turn_index,
-                         std::set<signed_size_type> const& ids,
+                         turn_index_set const& ids,
                          segment_identifier const& previous_seg_id) const
     {
-        for (typename std::set<signed_size_type>::const_iterator sit = ids.begin();
+        for (turn_index_set::const_iterator sit = ids.begin();
              sit != ids.end(); ++sit)
         {
             signed_size_type cluster_turn_index = *sit;
@@ -969,7 +969,7 @@ public :
         BOOST_ASSERT(mit != m_clusters.end());
 
         cluster_info const& cinfo = mit->second;
-        std::set<signed_size_type> const& ids = cinfo.turn_indices;
+        turn_index_set const& ids = cinfo.turn_indices;
 
         if (select_turn_from_cluster_linked(turn_index, op_index, ids, previous_seg_id))
         {
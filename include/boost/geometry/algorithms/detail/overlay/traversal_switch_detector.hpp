@@ -72,7 +72,7 @@ struct traversal_switch_detector
 
     typedef typename boost::range_value<Turns>::type turn_type;
     typedef typename turn_type::turn_operation_type turn_operation_type;
-    typedef std::set<signed_size_type> set_type;
+    typedef turn_index_set set_type;
 
     // Per ring, first turns are collected (in turn_indices), and later
     // a region_id is assigned
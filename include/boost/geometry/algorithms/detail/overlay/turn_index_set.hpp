@@ -0,0 +1,109 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2019 Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_TURN_INDEX_SET_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_TURN_INDEX_SET_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/geometry/algorithms/detail/signed_size_type.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace overlay
+{
+
+
+/*!
+\brief Set of turn indices, stored as a sorted vector
+\details Clusters and regions contain only a few turns. A sorted vector
+    has the same interface as the std::set it replaces, but needs
+    one allocation instead of one per element, and is iterated
+    contiguously.
+\note As for a vector, erasing invalidates iterators after the erased value
+*/
+class turn_index_set
+{
+    typedef std::vector<signed_size_type> container_type;
+
+public :
+    typedef signed_size_type value_type;
+    typedef container_type::size_type size_type;
+    typedef container_type::const_iterator const_iterator;
+    typedef const_iterator iterator;
+
+    inline const_iterator begin() const { return m_indices.begin(); }
+    inline const_iterator end() const { return m_indices.end(); }
+    inline size_type size() const { return m_indices.size(); }
+    inline bool empty() const { return m_indices.empty(); }
+    inline void clear() { m_indices.clear(); }
+
+    inline std::pair<iterator, bool> insert(signed_size_type index)
+    {
+        container_type::iterator it = std::lower_bound(m_indices.begin(),
+                                                       m_indices.end(), index);
+        if (it != m_indices.end() && *it == index)
+        {
+            return std::make_pair(const_iterator(it), false);
+        }
+        it = m_indices.insert(it, index);
+        return std::make_pair(const_iterator(it), true);
+    }
+
+    inline const_iterator find(signed_size_type index) const
+    {
+        const_iterator it = std::lower_bound(begin(), end(), index);
+        return it != end() && *it == index ? it : end();
+    }
+
+    inline size_type count(signed_size_type index) const
+    {
+        return find(index) == end() ? 0 : 1;
+    }
+
+    inline size_type erase(signed_size_type index)
+    {
+        container_type::iterator it = std::lower_bound(m_indices.begin(),
+                                                       m_indices.end(), index);
+        if (it == m_indices.end() || *it != index)
+        {
+            return 0;
+        }
+        m_indices.erase(it);
+        return 1;
+    }
+
+    //! Removes all indices for which the predicate returns true
+    template <typename Predicate>
+    inline void erase_if(Predicate const& predicate)
+    {
+        m_indices.erase(std::remove_if(m_indices.begin(), m_indices.end(),
+                                       predicate),
+                        m_indices.end());
+    }
+
+private :
+    container_type m_indices;
+};
+
+
+}} // namespace detail::overlay
+#endif //DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_OVERLAY_TURN_INDEX_SET_HPP
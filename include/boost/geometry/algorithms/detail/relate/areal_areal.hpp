@@ -27,7 +27,9 @@
 #include <boost/geometry/algorithms/detail/relate/point_geometry.hpp>
 #include <boost/geometry/algorithms/detail/relate/turns.hpp>
 #include <boost/geometry/algorithms/detail/relate/boundary_checker.hpp>
+#include <boost/geometry/algorithms/detail/relate/envelope_check.hpp>
 #include <boost/geometry/algorithms/detail/relate/follow_helpers.hpp>
+#include <boost/geometry/algorithms/detail/relate/point_in_areal_index.hpp>
 
 namespace boost { namespace geometry
 {
@@ -35,9 +37,7 @@ namespace boost { namespace geometry
 #ifndef DOXYGEN_NO_DETAIL
 namespace detail { namespace relate {
     
-// WARNING!
-// TODO: In the worst case calling this Pred in a loop for MultiPolygon/MultiPolygon may take O(NM)
-// Use the rtree in this case!
+// For a MultiPolygon the points are located using the rtree of point_in_areal_index
 
 // may be used to set EI and EB for an Areal geometry for which no turns were generated
 template
@@ -52,10 +52,10 @@ class no_turns_aa_pred
 public:
     no_turns_aa_pred(OtherAreal const& other_areal,
                      Result & res,
-                     PointInArealStrategy const& point_in_areal_strategy)
+                     PointInArealStrategy const& point_in_areal_strategy,
+                     bool disjoint = false)
         : m_result(res)
-        , m_point_in_areal_strategy(point_in_areal_strategy)
-        , m_other_areal(other_areal)
+        , m_other_areal_index(other_areal, point_in_areal_strategy, disjoint)
         , m_flags(0)
     {
         // check which relations must be analysed
@@ -77,8 +77,6 @@ public:
     template <typename Areal>
     bool operator()(Areal const& areal)
     {
-        using detail::within::point_in_geometry;
-
         // if those flags are set nothing will change
         if ( m_flags == 3 )
         {
@@ -96,11 +94,7 @@ public:
         }
 
         // check if the areal is inside the other_areal
-        // TODO: This is O(N)
-        // Run in a loop O(NM) - optimize!
-        int const pig = point_in_geometry(pt,
-                                          m_other_areal,
-                                          m_point_in_areal_strategy);
+        int const pig = m_other_areal_index.apply(pt);
         //BOOST_GEOMETRY_ASSERT( pig != 0 );
         
         // inside
@@ -130,11 +124,7 @@ public:
                     continue; // ignore
                 }
 
-                // TODO: O(N)
-                // Optimize!
-                int const hpig = point_in_geometry(range::front(range_ref),
-                                                   m_other_areal,
-                                                   m_point_in_areal_strategy);
+                int const hpig = m_other_areal_index.apply(range::front(range_ref));
 
                 // hole outside
                 if ( hpig < 0 )
@@ -168,11 +158,7 @@ public:
                     continue; // ignore
                 }
 
-                // TODO: O(N)
-                // Optimize!
-                int const hpig = point_in_geometry(range::front(range_ref),
-                                                   m_other_areal,
-                                                   m_point_in_areal_strategy);
+                int const hpig = m_other_areal_index.apply(range::front(range_ref));
 
                 // hole inside
                 if ( hpig > 0 )
@@ -191,8 +177,7 @@ public:
 
 private:
     Result & m_result;
-    PointInArealStrategy const& m_point_in_areal_strategy;
-    OtherAreal const& m_other_areal;
+    point_in_areal_index<OtherAreal, PointInArealStrategy> m_other_areal_index;
     int m_flags;
 };
 
@@ -219,6 +204,12 @@ struct areal_areal
         // The result should be FFFFFFFFF
         relate::set<exterior, exterior, result_dimension<Geometry2>::value>(result);// FFFFFFFFd, d in [1,9] or T
 
+        if ( BOOST_GEOMETRY_CONDITION(result.interrupt) )
+            return;
+
+        // decide as much as possible using the envelopes
+        envelope_check<Geometry1, Geometry2> const envelopes(geometry1, geometry2, intersection_strategy);
+        envelopes.template apply<false>(result);
         if ( BOOST_GEOMETRY_CONDITION(result.interrupt) )
             return;
 
@@ -226,11 +217,14 @@ struct areal_areal
         typedef typename turns::get_turns<Geometry1, Geometry2>::turn_info turn_type;
         std::vector<turn_type> turns;
 
-        interrupt_policy_areal_areal<Result> interrupt_policy(geometry1, geometry2, result);
+        if ( ! envelopes.disjoint() )
+        {
+            interrupt_policy_areal_areal<Result> interrupt_policy(geometry1, geometry2, result);
 
-        turns::get_turns<Geometry1, Geometry2>::apply(turns, geometry1, geometry2, interrupt_policy, intersection_strategy);
-        if ( BOOST_GEOMETRY_CONDITION(result.interrupt) )
-            return;
+            turns::get_turns<Geometry1, Geometry2>::apply(turns, geometry1, geometry2, interrupt_policy, intersection_strategy);
+            if ( BOOST_GEOMETRY_CONDITION(result.interrupt) )
+                return;
+        }
 
         typedef typename IntersectionStrategy::template point_in_geometry_strategy
             <
@@ -246,13 +240,13 @@ struct areal_areal
             = intersection_strategy.template get_point_in_geometry_strategy<Geometry2, Geometry1>();
 
         no_turns_aa_pred<Geometry2, Result, point_in_areal_strategy12_type, false>
-            pred1(geometry2, result, point_in_areal_strategy12);
+            pred1(geometry2, result, point_in_areal_strategy12, envelopes.disjoint());
         for_each_disjoint_geometry_if<0, Geometry1>::apply(turns.begin(), turns.end(), geometry1, pred1);
         if ( BOOST_GEOMETRY_CONDITION(result.interrupt) )
             return;
 
         no_turns_aa_pred<Geometry1, Result, point_in_areal_strategy21_type, true>
-            pred2(geometry1, result, point_in_areal_strategy21);
+            pred2(geometry1, result, point_in_areal_strategy21, envelopes.disjoint());
         for_each_disjoint_geometry_if<1, Geometry2>::apply(turns.begin(), turns.end(), geometry2, pred2);
         if ( BOOST_GEOMETRY_CONDITION(result.interrupt) )
             return;
@@ -630,7 +624,7 @@ struct areal_areal
             , other_geometry(other_geom)
             , interrupt(result.interrupt) // just in case, could be false as well
             , m_result(result)
-            , m_point_in_areal_strategy(point_in_areal_strategy)
+            , m_other_geometry_index(other_geom, point_in_areal_strategy)
             , m_flags(0)
         {
             // check which relations must be analysed
@@ -675,12 +669,7 @@ struct areal_areal
             // if the range is an interior ring we may use other IPs generated for this single geometry
             // to know which other single geometries should be checked
 
-            // TODO: optimize! e.g. use spatial index
-            // O(N) - running it in a loop gives O(NM)
-            using detail::within::point_in_geometry;
-            int const pig = point_in_geometry(range::front(range_ref),
-                                              other_geometry,
-                                              m_point_in_areal_strategy);
+            int const pig = m_other_geometry_index.apply(range::front(range_ref));
 
             //BOOST_GEOMETRY_ASSERT(pig != 0);
             if ( pig > 0 )
@@ -769,7 +758,7 @@ struct areal_areal
 
     private:
         Result & m_result;
-        PointInArealStrategy const& m_point_in_areal_strategy;
+        point_in_areal_index<OtherGeometry, PointInArealStrategy> m_other_geometry_index;
         int m_flags;
     };
 
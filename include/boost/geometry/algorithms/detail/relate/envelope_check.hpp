@@ -0,0 +1,137 @@
+// Boost.Geometry
+
+// Copyright (c) 2019 Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_ENVELOPE_CHECK_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_ENVELOPE_CHECK_HPP
+
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+#include <boost/geometry/algorithms/detail/envelope/interface.hpp>
+#include <boost/geometry/algorithms/detail/relate/result.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/core/topological_dimension.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/strategies/cartesian/box_in_box.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace relate {
+
+// Relations of the envelopes of two linear or areal geometries, known
+// before the turns are calculated.
+// If a part of one geometry lies outside the envelope of the other one,
+// its interior intersects the exterior of the other geometry. This decides
+// e.g. within or covered_by without calculating turns. If the envelopes
+// are disjoint, there are no turns and all components lie outside.
+// Only cartesian envelopes are exact, in other coordinate systems the
+// envelopes of segments are calculated and nothing is assumed.
+template
+<
+    typename Geometry1,
+    typename Geometry2,
+    bool IsCartesian = boost::is_same
+        <
+            typename geometry::cs_tag<Geometry1>::type, cartesian_tag
+        >::value
+>
+class envelope_check
+{
+public:
+    template <typename IntersectionStrategy>
+    envelope_check(Geometry1 const& , Geometry2 const& ,
+                   IntersectionStrategy const& )
+    {}
+
+    bool disjoint() const
+    {
+        return false;
+    }
+
+    template <bool TransposeResult, typename Result>
+    void apply(Result & ) const
+    {}
+};
+
+template <typename Geometry1, typename Geometry2>
+class envelope_check<Geometry1, Geometry2, true>
+{
+    typedef model::box<typename geometry::point_type<Geometry1>::type> box1_type;
+    typedef model::box<typename geometry::point_type<Geometry2>::type> box2_type;
+
+    static const char interior1 = '0' + topological_dimension<Geometry1>::value;
+    static const char interior2 = '0' + topological_dimension<Geometry2>::value;
+
+public:
+    template <typename IntersectionStrategy>
+    envelope_check(Geometry1 const& geometry1, Geometry2 const& geometry2,
+                   IntersectionStrategy const& intersection_strategy)
+        : m_valid(! geometry::is_empty(geometry1) && ! geometry::is_empty(geometry2))
+        , m_disjoint(false)
+        , m_covered12(true)
+        , m_covered21(true)
+    {
+        if ( ! m_valid )
+        {
+            return;
+        }
+
+        box1_type box1;
+        box2_type box2;
+        geometry::envelope(geometry1, box1, intersection_strategy.get_envelope_strategy());
+        geometry::envelope(geometry2, box2, intersection_strategy.get_envelope_strategy());
+
+        m_disjoint = detail::disjoint::disjoint_box_box(box1, box2,
+                        intersection_strategy.get_disjoint_box_box_strategy());
+        m_covered12 = strategy::within::box_in_box
+            <
+                box1_type, box2_type, strategy::within::box_covered_by_range
+            >::apply(box1, box2);
+        m_covered21 = strategy::within::box_in_box
+            <
+                box2_type, box1_type, strategy::within::box_covered_by_range
+            >::apply(box2, box1);
+    }
+
+    bool disjoint() const
+    {
+        return m_disjoint;
+    }
+
+    // sets IE and EI if one envelope is not covered by the other one
+    template <bool TransposeResult, typename Result>
+    void apply(Result & result) const
+    {
+        if ( ! m_covered12 )
+        {
+            update<interior, exterior, interior1, TransposeResult>(result);
+        }
+        if ( ! m_covered21 )
+        {
+            update<exterior, interior, interior2, TransposeResult>(result);
+        }
+    }
+
+private:
+    bool m_valid;
+    bool m_disjoint;
+    bool m_covered12;
+    bool m_covered21;
+};
+
+}} // namespace detail::relate
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_ENVELOPE_CHECK_HPP
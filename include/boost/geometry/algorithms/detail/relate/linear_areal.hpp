@@ -31,7 +31,9 @@
 #include <boost/geometry/algorithms/detail/relate/point_geometry.hpp>
 #include <boost/geometry/algorithms/detail/relate/turns.hpp>
 #include <boost/geometry/algorithms/detail/relate/boundary_checker.hpp>
+#include <boost/geometry/algorithms/detail/relate/envelope_check.hpp>
 #include <boost/geometry/algorithms/detail/relate/follow_helpers.hpp>
+#include <boost/geometry/algorithms/detail/relate/point_in_areal_index.hpp>
 
 #include <boost/geometry/views/detail/normalized_view.hpp>
 
@@ -41,9 +43,7 @@ namespace boost { namespace geometry
 #ifndef DOXYGEN_NO_DETAIL
 namespace detail { namespace relate {
 
-// WARNING!
-// TODO: In the worst case calling this Pred in a loop for MultiLinestring/MultiPolygon may take O(NM)
-// Use the rtree in this case!
+// For a MultiPolygon the points are located using the rtree of point_in_areal_index
 
 // may be used to set IE and BE for a Linear geometry for which no turns were generated
 template
@@ -60,10 +60,10 @@ public:
     no_turns_la_linestring_pred(Geometry2 const& geometry2,
                                 Result & res,
                                 PointInArealStrategy const& point_in_areal_strategy,
-                                BoundaryChecker const& boundary_checker)
-        : m_geometry2(geometry2)
+                                BoundaryChecker const& boundary_checker,
+                                bool disjoint = false)
+        : m_geometry2_index(geometry2, point_in_areal_strategy, disjoint)
         , m_result(res)
-        , m_point_in_areal_strategy(point_in_areal_strategy)
         , m_boundary_checker(boundary_checker)
         , m_interrupt_flags(0)
     {
@@ -107,9 +107,7 @@ public:
             return false;
         }
 
-        int const pig = detail::within::point_in_geometry(range::front(linestring),
-                                                          m_geometry2,
-                                                          m_point_in_areal_strategy);
+        int const pig = m_geometry2_index.apply(range::front(linestring));
         //BOOST_GEOMETRY_ASSERT_MSG(pig != 0, "There should be no IPs");
 
         if ( pig > 0 )
@@ -147,9 +145,8 @@ public:
     }
 
 private:
-    Geometry2 const& m_geometry2;
+    point_in_areal_index<Geometry2, PointInArealStrategy> m_geometry2_index;
     Result & m_result;
-    PointInArealStrategy const& m_point_in_areal_strategy;
     BoundaryChecker const& m_boundary_checker;
     unsigned m_interrupt_flags;
 };
@@ -247,6 +244,12 @@ struct linear_areal
         // The result should be FFFFFFFFF
         relate::set<exterior, exterior, result_dimension<Geometry2>::value, TransposeResult>(result);// FFFFFFFFd, d in [1,9] or T
 
+        if ( BOOST_GEOMETRY_CONDITION( result.interrupt ) )
+            return;
+
+        // decide as much as possible using the envelopes
+        envelope_check<Geometry1, Geometry2> const envelopes(geometry1, geometry2, intersection_strategy);
+        envelopes.template apply<TransposeResult>(result);
         if ( BOOST_GEOMETRY_CONDITION( result.interrupt ) )
             return;
 
@@ -256,9 +259,12 @@ struct linear_areal
 
         interrupt_policy_linear_areal<Geometry2, Result> interrupt_policy(geometry2, result);
 
-        turns::get_turns<Geometry1, Geometry2>::apply(turns, geometry1, geometry2, interrupt_policy, intersection_strategy);
-        if ( BOOST_GEOMETRY_CONDITION( result.interrupt ) )
-            return;
+        if ( ! envelopes.disjoint() )
+        {
+            turns::get_turns<Geometry1, Geometry2>::apply(turns, geometry1, geometry2, interrupt_policy, intersection_strategy);
+            if ( BOOST_GEOMETRY_CONDITION( result.interrupt ) )
+                return;
+        }
 
         typedef typename IntersectionStrategy::template point_in_geometry_strategy<Geometry1, Geometry2>::type within_strategy_type;
         within_strategy_type const within_strategy = intersection_strategy.template get_point_in_geometry_strategy<Geometry1, Geometry2>();
@@ -282,7 +288,8 @@ struct linear_areal
             > pred1(geometry2,
                     result,
                     within_strategy,
-                    boundary_checker1);
+                    boundary_checker1,
+                    envelopes.disjoint());
         for_each_disjoint_geometry_if<0, Geometry1>::apply(turns.begin(), turns.end(), geometry1, pred1);
         if ( BOOST_GEOMETRY_CONDITION( result.interrupt ) )
             return;
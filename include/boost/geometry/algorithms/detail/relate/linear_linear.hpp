@@ -31,6 +31,7 @@
 #include <boost/geometry/algorithms/detail/relate/result.hpp>
 #include <boost/geometry/algorithms/detail/relate/turns.hpp>
 #include <boost/geometry/algorithms/detail/relate/boundary_checker.hpp>
+#include <boost/geometry/algorithms/detail/relate/envelope_check.hpp>
 #include <boost/geometry/algorithms/detail/relate/follow_helpers.hpp>
 
 namespace boost { namespace geometry
@@ -136,17 +137,25 @@ struct linear_linear
         typedef typename turns::get_turns<Geometry1, Geometry2>::turn_info turn_type;
         std::vector<turn_type> turns;
 
-        interrupt_policy_linear_linear<Result> interrupt_policy(result);
+        // there are no turns if the envelopes are disjoint
+        // IE and EI are not set using the envelopes, point-like linestrings
+        // have an interior of dimension 0
+        envelope_check<Geometry1, Geometry2> const envelopes(geometry1, geometry2, intersection_strategy);
 
-        turns::get_turns
-            <
-                Geometry1,
-                Geometry2,
-                detail::get_turns::get_turn_info_type<Geometry1, Geometry2, turns::assign_policy<true> >
-            >::apply(turns, geometry1, geometry2, interrupt_policy, intersection_strategy);
+        if ( ! envelopes.disjoint() )
+        {
+            interrupt_policy_linear_linear<Result> interrupt_policy(result);
 
-        if ( BOOST_GEOMETRY_CONDITION( result.interrupt ) )
-            return;
+            turns::get_turns
+                <
+                    Geometry1,
+                    Geometry2,
+                    detail::get_turns::get_turn_info_type<Geometry1, Geometry2, turns::assign_policy<true> >
+                >::apply(turns, geometry1, geometry2, interrupt_policy, intersection_strategy);
+
+            if ( BOOST_GEOMETRY_CONDITION( result.interrupt ) )
+                return;
+        }
 
         typedef boundary_checker
             <
@@ -0,0 +1,170 @@
+// Boost.Geometry
+
+// Copyright (c) 2019 Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_POINT_IN_AREAL_INDEX_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_POINT_IN_AREAL_INDEX_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+#include <boost/core/noncopyable.hpp>
+#include <boost/range.hpp>
+#include <boost/scoped_ptr.hpp>
+
+#include <boost/geometry/algorithms/detail/envelope/interface.hpp>
+#include <boost/geometry/algorithms/detail/expand_by_epsilon.hpp>
+#include <boost/geometry/algorithms/detail/within/point_in_geometry.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/util/range.hpp>
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace relate {
+
+// Locates points in an areal geometry, used for the components of the
+// other geometry for which no turns were generated.
+// For a single polygon this is point_in_geometry. If the envelopes of
+// the geometries are known to be disjoint, all points are outside.
+template
+<
+    typename Areal,
+    typename PointInArealStrategy,
+    typename Tag = typename geometry::tag<Areal>::type
+>
+class point_in_areal_index
+{
+public:
+    point_in_areal_index(Areal const& areal,
+                         PointInArealStrategy const& point_in_areal_strategy,
+                         bool disjoint = false)
+        : m_areal(areal)
+        , m_point_in_areal_strategy(point_in_areal_strategy)
+        , m_disjoint(disjoint)
+    {}
+
+    template <typename Point>
+    int apply(Point const& point)
+    {
+        if ( m_disjoint )
+        {
+            return -1;
+        }
+
+        return detail::within::point_in_geometry(point, m_areal,
+                                                 m_point_in_areal_strategy);
+    }
+
+private:
+    Areal const& m_areal;
+    PointInArealStrategy const& m_point_in_areal_strategy;
+    bool m_disjoint;
+};
+
+// For a MultiPolygon calling point_in_geometry for many points is O(NM).
+// From the second point on, the envelopes of the polygons are stored in
+// an rtree, and only the polygons whose envelopes contain the point are
+// checked.
+template <typename Areal, typename PointInArealStrategy>
+class point_in_areal_index<Areal, PointInArealStrategy, multi_polygon_tag>
+    : boost::noncopyable
+{
+    typedef typename geometry::point_type<Areal>::type point_type;
+    typedef model::box<point_type> box_type;
+    typedef std::pair<box_type, std::size_t> box_pair_type;
+    typedef index::rtree<box_pair_type, index::rstar<4> > rtree_type;
+
+public:
+    point_in_areal_index(Areal const& areal,
+                         PointInArealStrategy const& point_in_areal_strategy,
+                         bool disjoint = false)
+        : m_areal(areal)
+        , m_point_in_areal_strategy(point_in_areal_strategy)
+        , m_disjoint(disjoint)
+        , m_calls(0)
+    {}
+
+    template <typename Point>
+    int apply(Point const& point)
+    {
+        if ( m_disjoint )
+        {
+            return -1;
+        }
+
+        // One point is located faster without the index
+        if ( m_calls++ == 0 )
+        {
+            return detail::within::point_in_geometry(point, m_areal,
+                                                     m_point_in_areal_strategy);
+        }
+
+        if ( ! m_rtree )
+        {
+            create_rtree();
+        }
+
+        m_found.clear();
+        m_rtree->query(index::intersects(point), std::back_inserter(m_found));
+
+        for ( typename std::vector<box_pair_type>::const_iterator
+                it = m_found.begin() ; it != m_found.end() ; ++it )
+        {
+            int const pip = detail::within::point_in_geometry(point,
+                                range::at(m_areal, it->second),
+                                m_point_in_areal_strategy);
+
+            // inside or on the boundary
+            if ( pip >= 0 )
+            {
+                return pip;
+            }
+        }
+
+        return -1; // for valid multipolygons
+    }
+
+private:
+    void create_rtree()
+    {
+        typename PointInArealStrategy::envelope_strategy_type const
+            envelope_strategy = m_point_in_areal_strategy.get_envelope_strategy();
+
+        std::size_t const count = boost::size(m_areal);
+        std::vector<box_pair_type> boxes(count);
+        for ( std::size_t i = 0 ; i < count ; ++i )
+        {
+            geometry::envelope(range::at(m_areal, i), boxes[i].first,
+                               envelope_strategy);
+            geometry::detail::expand_by_epsilon(boxes[i].first);
+            boxes[i].second = i;
+        }
+
+        m_rtree.reset(new rtree_type(boxes.begin(), boxes.end()));
+    }
+
+    Areal const& m_areal;
+    PointInArealStrategy const& m_point_in_areal_strategy;
+    bool m_disjoint;
+    std::size_t m_calls;
+    boost::scoped_ptr<rtree_type> m_rtree;
+    std::vector<box_pair_type> m_found;
+};
+
+}} // namespace detail::relate
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_DETAIL_RELATE_POINT_IN_AREAL_INDEX_HPP
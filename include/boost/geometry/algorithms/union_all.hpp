@@ -0,0 +1,255 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2019 Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_ALGORITHMS_UNION_ALL_HPP
+#define BOOST_GEOMETRY_ALGORITHMS_UNION_ALL_HPP
+
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/clear.hpp>
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/detail/disjoint/box_box.hpp>
+#include <boost/geometry/algorithms/detail/envelope/interface.hpp>
+#include <boost/geometry/algorithms/detail/expand/interface.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/strategies/default_strategy.hpp>
+#include <boost/geometry/strategies/relate.hpp>
+#include <boost/geometry/util/range.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace union_all
+{
+
+/*!
+\brief Internal, cascaded union of a range of areal geometries
+\details The envelopes of the input geometries are packed into an rtree.
+    Its leaf order is used to pair spatially close geometries, which are
+    then merged bottom-up, level by level, so every vertex takes part in
+    O(log(N)) overlays instead of O(N) for a sequential accumulation.
+    Pairs with disjoint envelopes are concatenated without an overlay.
+*/
+template <typename MultiPolygon>
+struct cascaded_union
+{
+    typedef typename point_type<MultiPolygon>::type point_type;
+    typedef model::box<point_type> box_type;
+
+    template <typename Range, typename Strategy>
+    static inline void apply(Range const& geometries,
+                             MultiPolygon& multi_polygon,
+                             Strategy const& strategy)
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator_type;
+        typedef std::pair<box_type, std::size_t> box_pair_type;
+
+        geometry::clear(multi_polygon);
+
+        std::size_t const count = boost::size(geometries);
+        if (count == 0)
+        {
+            return;
+        }
+
+        std::vector<box_pair_type> boxes;
+        boxes.reserve(count);
+        std::size_t index = 0;
+        for (iterator_type it = boost::begin(geometries);
+             it != boost::end(geometries); ++it, ++index)
+        {
+            box_type box;
+            geometry::envelope(*it, box, strategy.get_envelope_strategy());
+            boxes.push_back(std::make_pair(box, index));
+        }
+
+        // The packing constructor sorts the values spatially (STR),
+        // iterating the tree visits them leaf by leaf
+        typedef index::rtree<box_pair_type, index::rstar<16> > rtree_type;
+        rtree_type const rtree(boxes.begin(), boxes.end());
+
+        std::vector<MultiPolygon> parts(count);
+        std::vector<box_type> envelopes;
+        envelopes.reserve(count);
+        std::size_t part_index = 0;
+        for (typename rtree_type::const_iterator it = rtree.begin();
+             it != rtree.end(); ++it, ++part_index)
+        {
+            geometry::convert(range::at(geometries, it->second),
+                              parts[part_index]);
+            envelopes.push_back(it->first);
+        }
+
+        MultiPolygon merged;
+        for (std::size_t level_count = count; level_count > 1; )
+        {
+            std::size_t const pairs = level_count / 2;
+            for (std::size_t i = 0; i < pairs; i++)
+            {
+                merge(parts[2 * i], envelopes[2 * i],
+                      parts[2 * i + 1], envelopes[2 * i + 1],
+                      merged, strategy);
+
+                using std::swap;
+                swap(parts[i], merged);
+                envelopes[i] = envelopes[2 * i];
+                geometry::expand(envelopes[i], envelopes[2 * i + 1]);
+            }
+
+            if (level_count % 2 == 1)
+            {
+                using std::swap;
+                swap(parts[pairs], parts[level_count - 1]);
+                envelopes[pairs] = envelopes[level_count - 1];
+            }
+
+            level_count = pairs + level_count % 2;
+        }
+
+        using std::swap;
+        swap(multi_polygon, parts.front());
+    }
+
+private :
+    template <typename Strategy>
+    static inline void merge(MultiPolygon& geometry1, box_type const& box1,
+                             MultiPolygon& geometry2, box_type const& box2,
+                             MultiPolygon& result,
+                             Strategy const& strategy)
+    {
+        geometry::clear(result);
+
+        if (detail::disjoint::disjoint_box_box(box1, box2,
+                strategy.get_disjoint_box_box_strategy()))
+        {
+            // No point of one part can touch the other part,
+            // the union is the concatenation of both
+            using std::swap;
+            swap(result, geometry1);
+            for (typename boost::range_iterator<MultiPolygon>::type
+                    it = boost::begin(geometry2);
+                 it != boost::end(geometry2); ++it)
+            {
+                range::push_back(result, *it);
+            }
+            return;
+        }
+
+        geometry::union_(geometry1, geometry2, result, strategy);
+    }
+};
+
+
+}} // namespace detail::union_all
+#endif // DOXYGEN_NO_DETAIL
+
+
+namespace resolve_strategy
+{
+
+struct union_all
+{
+    template <typename Range, typename MultiPolygon, typename Strategy>
+    static inline void apply(Range const& geometries,
+                             MultiPolygon& multi_polygon,
+                             Strategy const& strategy)
+    {
+        detail::union_all::cascaded_union
+            <
+                MultiPolygon
+            >::apply(geometries, multi_polygon, strategy);
+    }
+
+    template <typename Range, typename MultiPolygon>
+    static inline void apply(Range const& geometries,
+                             MultiPolygon& multi_polygon,
+                             default_strategy)
+    {
+        typedef typename strategy::relate::services::default_strategy
+            <
+                MultiPolygon,
+                MultiPolygon
+            >::type strategy_type;
+
+        detail::union_all::cascaded_union
+            <
+                MultiPolygon
+            >::apply(geometries, multi_polygon, strategy_type());
+    }
+};
+
+} // namespace resolve_strategy
+
+
+/*!
+\brief Combines all areal geometries of a range into one multi-polygon
+\ingroup union
+\details Calculates the spatial set theoretic union of all geometries of
+    the range. The geometries are merged pairwise in a balanced, spatially
+    ordered way, which is much faster than calling union_ in a loop and
+    accumulating the result.
+\tparam Range range of polygons or multi-polygons
+\tparam MultiPolygon \tparam_geometry{MultiPolygon}
+\tparam Strategy \tparam_strategy{Union_}
+\param geometries the range of geometries to combine
+\param multi_polygon the output multi-polygon, it is cleared first
+\param strategy \param_strategy{union_}
+
+\qbk{distinguish,with strategy}
+*/
+template <typename Range, typename MultiPolygon, typename Strategy>
+inline void union_all(Range const& geometries,
+                      MultiPolygon& multi_polygon,
+                      Strategy const& strategy)
+{
+    concepts::check<typename boost::range_value<Range>::type const>();
+    concepts::check<MultiPolygon>();
+
+    resolve_strategy::union_all::apply(geometries, multi_polygon, strategy);
+}
+
+
+/*!
+\brief Combines all areal geometries of a range into one multi-polygon
+\ingroup union
+\details Calculates the spatial set theoretic union of all geometries of
+    the range. The geometries are merged pairwise in a balanced, spatially
+    ordered way, which is much faster than calling union_ in a loop and
+    accumulating the result.
+\tparam Range range of polygons or multi-polygons
+\tparam MultiPolygon \tparam_geometry{MultiPolygon}
+\param geometries the range of geometries to combine
+\param multi_polygon the output multi-polygon, it is cleared first
+*/
+template <typename Range, typename MultiPolygon>
+inline void union_all(Range const& geometries, MultiPolygon& multi_polygon)
+{
+    geometry::union_all(geometries, multi_polygon, default_strategy());
+}
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_ALGORITHMS_UNION_ALL_HPP
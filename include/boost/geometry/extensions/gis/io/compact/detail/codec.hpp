@@ -0,0 +1,253 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GIS_IO_COMPACT_DETAIL_CODEC_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GIS_IO_COMPACT_DETAIL_CODEC_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exception.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Compact format exception
+\ingroup core
+\details Thrown when a coordinate can't be quantized or when the bytes
+    read are not a valid geometry of the requested type
+*/
+class compact_exception : public geometry::exception
+{
+public:
+    explicit compact_exception(std::string const& message)
+        : m_message(message)
+    {}
+
+    virtual ~compact_exception() throw() {}
+
+    virtual char const* what() const throw()
+    {
+        return m_message.c_str();
+    }
+
+private:
+    std::string m_message;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace compact
+{
+
+/*
+Layout of a geometry, all integers are varints:
+    type            1 byte, compact_type
+    flags           1 byte, dimension in the low 4 bits, compact_flag
+    [precision]     zigzag, if quantized
+    [envelope]      zigzag minimum of each dimension, then zigzag
+                    differences between maximum and minimum
+    body            counts of rings, parts and points followed by the
+                    zigzag differences of the coordinates with the
+                    previous point of the same range
+The coordinates are converted to doubles and either quantized to integers
+with a decimal precision or, without loss, stored as the bits of the doubles.
+*/
+struct compact_type
+{
+    enum enum_t
+    {
+        point = 1,
+        linestring = 2,
+        polygon = 3,
+        multi_point = 4,
+        multi_linestring = 5,
+        multi_polygon = 6,
+        ring = 8,
+        box = 9,
+        segment = 10
+    };
+};
+
+struct compact_flag
+{
+    static const boost::uint8_t dimension_mask = 0x0f;
+    static const boost::uint8_t envelope = 0x10;
+    static const boost::uint8_t quantized = 0x20;
+};
+
+static const std::size_t max_dimension = 4;
+static const int max_precision = 15;
+
+template <typename Tag> struct type_of {};
+template <> struct type_of<point_tag> { static const compact_type::enum_t value = compact_type::point; };
+template <> struct type_of<linestring_tag> { static const compact_type::enum_t value = compact_type::linestring; };
+template <> struct type_of<polygon_tag> { static const compact_type::enum_t value = compact_type::polygon; };
+template <> struct type_of<multi_point_tag> { static const compact_type::enum_t value = compact_type::multi_point; };
+template <> struct type_of<multi_linestring_tag> { static const compact_type::enum_t value = compact_type::multi_linestring; };
+template <> struct type_of<multi_polygon_tag> { static const compact_type::enum_t value = compact_type::multi_polygon; };
+template <> struct type_of<ring_tag> { static const compact_type::enum_t value = compact_type::ring; };
+template <> struct type_of<box_tag> { static const compact_type::enum_t value = compact_type::box; };
+template <> struct type_of<segment_tag> { static const compact_type::enum_t value = compact_type::segment; };
+
+template <typename Geometry>
+struct stored_dimension
+{
+    static const std::size_t value = geometry::dimension<Geometry>::value;
+    BOOST_STATIC_ASSERT(value >= 1 && value <= max_dimension);
+};
+
+// Coordinates are stored as doubles, other types than double, float and
+// integers of at most 53 bits, e.g. 64-bit integers, long double or
+// multiprecision numbers, would not be restored exactly
+template <typename T>
+struct is_exact_as_double
+{
+    static const bool value = boost::is_same<T, double>::value
+        || boost::is_same<T, float>::value
+        || (boost::is_integral<T>::value
+            && std::numeric_limits<T>::digits <= 53);
+};
+
+/*!
+\brief Internal, converts coordinates to the integers stored
+\details Quantized coordinates are rounded to the decimal precision,
+    the other ones are the bits of the double, so consecutive close
+    values have small differences. Doubles are restored exactly, so are
+    the coordinate types accepted by is_exact_as_double
+*/
+class coordinate_codec
+{
+public:
+    coordinate_codec()
+        : m_quantized(false)
+        , m_precision(0)
+        , m_factor(1)
+    {}
+
+    explicit coordinate_codec(int precision)
+        : m_quantized(true)
+        , m_precision(precision)
+        , m_factor(1)
+    {
+        if (precision < -max_precision || precision > max_precision)
+        {
+            throw compact_exception("Precision out of range");
+        }
+        for (int i = 0; i < precision || i < -precision; i++)
+        {
+            m_factor *= 10;
+        }
+    }
+
+    bool quantized() const { return m_quantized; }
+    int precision() const { return m_precision; }
+
+    boost::int64_t encode(double value) const
+    {
+        if (! m_quantized)
+        {
+            boost::int64_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        // the factor is exact, dividing by it is more precise than
+        // multiplying by its inverse
+        double const scaled = std::floor((m_precision >= 0
+                                          ? value * m_factor
+                                          : value / m_factor) + 0.5);
+        if (! (scaled > -9.0e18 && scaled < 9.0e18))
+        {
+            throw compact_exception("Coordinate can't be quantized");
+        }
+        return static_cast<boost::int64_t>(scaled);
+    }
+
+    double decode(boost::int64_t value) const
+    {
+        if (! m_quantized)
+        {
+            double result;
+            std::memcpy(&result, &value, sizeof(result));
+            return result;
+        }
+
+        return m_precision >= 0
+             ? static_cast<double>(value) / m_factor
+             : static_cast<double>(value) * m_factor;
+    }
+
+private:
+    bool m_quantized;
+    int m_precision;
+    double m_factor;
+};
+
+// Differences wrap around, so the bits of any doubles are restored
+inline boost::int64_t difference(boost::int64_t value, boost::int64_t previous)
+{
+    return static_cast<boost::int64_t>(boost::uint64_t(value) - boost::uint64_t(previous));
+}
+
+inline boost::int64_t sum(boost::int64_t previous, boost::int64_t difference)
+{
+    return static_cast<boost::int64_t>(boost::uint64_t(previous) + boost::uint64_t(difference));
+}
+
+template
+<
+    typename Point,
+    std::size_t I = 0,
+    std::size_t N = geometry::dimension<Point>::value
+>
+struct coordinates
+{
+    static inline void get(Point const& point, double* values)
+    {
+        values[I] = static_cast<double>(geometry::get<I>(point));
+        coordinates<Point, I + 1, N>::get(point, values);
+    }
+
+    // Coordinates not stored are 0
+    static inline void set(double const* values, std::size_t count, Point& point)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+        geometry::set<I>(point, static_cast<coordinate_type>(I < count ? values[I] : 0));
+        coordinates<Point, I + 1, N>::set(values, count, point);
+    }
+};
+
+template <typename Point, std::size_t N>
+struct coordinates<Point, N, N>
+{
+    static inline void get(Point const& , double* ) {}
+    static inline void set(double const* , std::size_t , Point& ) {}
+};
+
+}} // namespace detail::compact
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GIS_IO_COMPACT_DETAIL_CODEC_HPP
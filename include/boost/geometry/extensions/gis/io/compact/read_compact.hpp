@@ -0,0 +1,621 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GIS_IO_COMPACT_READ_COMPACT_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GIS_IO_COMPACT_READ_COMPACT_HPP
+
+#include <cstddef>
+#include <iterator>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/util/range.hpp>
+#include <boost/geometry/views/detail/indexed_point_view.hpp>
+
+#include <boost/geometry/extensions/gis/io/compact/detail/codec.hpp>
+#include <boost/geometry/extensions/gis/io/detail/varint.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace compact
+{
+
+struct header
+{
+    header()
+        : type(0)
+        , dimension(0)
+        , has_envelope(false)
+    {}
+
+    int type;
+    std::size_t dimension;
+    bool has_envelope;
+    coordinate_codec codec;
+};
+
+template <typename Iterator>
+inline bool read_value(Iterator& it, Iterator end, boost::int64_t& value)
+{
+    boost::uint64_t stored;
+    if (! varint::read(it, end, stored))
+    {
+        return false;
+    }
+    value = varint::zigzag_decode(stored);
+    return true;
+}
+
+// Reads the header, the iterator is left before the envelope
+template <typename Iterator>
+inline bool read_header(Iterator& it, Iterator end, header& result)
+{
+    if (it == end)
+    {
+        return false;
+    }
+    result.type = static_cast<boost::uint8_t>(*it);
+    ++it;
+    if (it == end)
+    {
+        return false;
+    }
+    boost::uint8_t const flags = static_cast<boost::uint8_t>(*it);
+    ++it;
+
+    result.dimension = flags & compact_flag::dimension_mask;
+    result.has_envelope = (flags & compact_flag::envelope) != 0;
+    if (result.dimension < 1 || result.dimension > max_dimension)
+    {
+        return false;
+    }
+
+    if ((flags & compact_flag::quantized) != 0)
+    {
+        boost::int64_t precision;
+        if (! read_value(it, end, precision)
+            || precision < -max_precision || precision > max_precision)
+        {
+            return false;
+        }
+        result.codec = coordinate_codec(static_cast<int>(precision));
+    }
+    else
+    {
+        result.codec = coordinate_codec();
+    }
+    return true;
+}
+
+template <typename Iterator>
+inline bool skip_envelope(Iterator& it, Iterator end, header const& h)
+{
+    for (std::size_t i = 0; h.has_envelope && i < 2 * h.dimension; i++)
+    {
+        if (! varint::skip(it, end))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Reads the counts and the coordinates of the body
+template <typename Iterator>
+class body_decoder
+{
+public:
+    body_decoder(Iterator& it, Iterator end, header const& h)
+        : m_it(it)
+        , m_end(end)
+        , m_header(h)
+    {
+        reset();
+    }
+
+    // Each point takes at least one byte per dimension, a corrupted
+    // count can't make a container allocate more than that
+    bool count(std::size_t& n, std::size_t min_size)
+    {
+        boost::uint64_t value;
+        if (! varint::read(m_it, m_end, value))
+        {
+            return false;
+        }
+        typedef typename std::iterator_traits<Iterator>::difference_type difference_type;
+        difference_type const bytes = std::distance(m_it, m_end);
+        if (bytes < 0 || std::size_t(bytes) / min_size < value)
+        {
+            return false;
+        }
+        n = static_cast<std::size_t>(value);
+        return true;
+    }
+
+    bool count_points(std::size_t& n)
+    {
+        return count(n, m_header.dimension);
+    }
+
+    void reset()
+    {
+        for (std::size_t i = 0; i < max_dimension; i++)
+        {
+            m_previous[i] = 0;
+        }
+    }
+
+    template <typename Point>
+    bool point(Point& point)
+    {
+        double values[max_dimension];
+        for (std::size_t i = 0; i < m_header.dimension; i++)
+        {
+            boost::int64_t delta;
+            if (! read_value(m_it, m_end, delta))
+            {
+                return false;
+            }
+            m_previous[i] = sum(m_previous[i], delta);
+            values[i] = m_header.codec.decode(m_previous[i]);
+        }
+        coordinates<Point>::set(values, m_header.dimension, point);
+        return true;
+    }
+
+    bool skip_points(std::size_t n)
+    {
+        for (std::size_t i = 0; i < n * m_header.dimension; i++)
+        {
+            if (! varint::skip(m_it, m_end))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    Iterator& m_it;
+    Iterator m_end;
+    header const& m_header;
+    boost::int64_t m_previous[max_dimension];
+};
+
+struct range_decoder
+{
+    // Points are read in place, the memory of the range is reused
+    template <typename Range, typename Decoder>
+    static inline bool apply(Range& range, Decoder& decoder)
+    {
+        std::size_t n = 0;
+        if (! decoder.count_points(n))
+        {
+            return false;
+        }
+        range::resize(range, n);
+        decoder.reset();
+        for (typename boost::range_iterator<Range>::type
+                it = boost::begin(range); it != boost::end(range); ++it)
+        {
+            if (! decoder.point(*it))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename Decoder>
+    static inline bool skip(Decoder& decoder)
+    {
+        std::size_t n = 0;
+        return decoder.count_points(n) && decoder.skip_points(n);
+    }
+};
+
+struct polygon_decoder
+{
+    template <typename Polygon, typename Decoder>
+    static inline bool apply(Polygon& polygon, Decoder& decoder)
+    {
+        std::size_t n = 0;
+        if (! decoder.count(n, 1))
+        {
+            return false;
+        }
+        if (n == 0)
+        {
+            range::clear(exterior_ring(polygon));
+            range::clear(interior_rings(polygon));
+            return true;
+        }
+        if (! range_decoder::apply(exterior_ring(polygon), decoder))
+        {
+            return false;
+        }
+
+        typename interior_return_type<Polygon>::type
+            rings = interior_rings(polygon);
+        range::resize(rings, n - 1);
+        for (typename detail::interior_iterator<Polygon>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            if (! range_decoder::apply(*it, decoder))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename Decoder>
+    static inline bool skip(Decoder& decoder)
+    {
+        std::size_t n = 0;
+        if (! decoder.count(n, 1))
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < n; i++)
+        {
+            if (! range_decoder::skip(decoder))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+template <typename PartDecoder>
+struct multi_decoder
+{
+    template <typename MultiGeometry, typename Decoder>
+    static inline bool apply(MultiGeometry& multi, Decoder& decoder)
+    {
+        std::size_t n = 0;
+        if (! decoder.count(n, 1))
+        {
+            return false;
+        }
+        range::resize(multi, n);
+        for (typename boost::range_iterator<MultiGeometry>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            if (! PartDecoder::apply(*it, decoder))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename Decoder>
+    static inline bool skip(Decoder& decoder)
+    {
+        std::size_t n = 0;
+        if (! decoder.count(n, 1))
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < n; i++)
+        {
+            if (! PartDecoder::skip(decoder))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+struct indexed_decoder
+{
+    template <typename Geometry, typename Decoder>
+    static inline bool apply(Geometry& geometry, Decoder& decoder)
+    {
+        detail::indexed_point_view<Geometry, 0> first(geometry);
+        detail::indexed_point_view<Geometry, 1> second(geometry);
+        decoder.reset();
+        return decoder.point(first) && decoder.point(second);
+    }
+
+    template <typename Decoder>
+    static inline bool skip(Decoder& decoder)
+    {
+        return decoder.skip_points(2);
+    }
+};
+
+// Skips the body of a geometry of any type
+template <typename Decoder>
+inline bool skip_body(int type, Decoder& decoder)
+{
+    switch (type)
+    {
+    case compact_type::point :
+        return decoder.skip_points(1);
+    case compact_type::linestring :
+    case compact_type::ring :
+    case compact_type::multi_point :
+        return range_decoder::skip(decoder);
+    case compact_type::polygon :
+        return polygon_decoder::skip(decoder);
+    case compact_type::multi_linestring :
+        return multi_decoder<range_decoder>::skip(decoder);
+    case compact_type::multi_polygon :
+        return multi_decoder<polygon_decoder>::skip(decoder);
+    case compact_type::box :
+    case compact_type::segment :
+        return indexed_decoder::skip(decoder);
+    }
+    return false;
+}
+
+template <typename Iterator, typename Box>
+inline bool read_envelope(Iterator& it, Iterator end, header const& h, Box& box)
+{
+    if (! h.has_envelope)
+    {
+        return false;
+    }
+
+    boost::int64_t min[max_dimension];
+    double values[2][max_dimension];
+    for (std::size_t i = 0; i < h.dimension; i++)
+    {
+        if (! read_value(it, end, min[i]))
+        {
+            return false;
+        }
+        values[0][i] = h.codec.decode(min[i]);
+    }
+    for (std::size_t i = 0; i < h.dimension; i++)
+    {
+        boost::int64_t delta;
+        if (! read_value(it, end, delta))
+        {
+            return false;
+        }
+        values[1][i] = h.codec.decode(sum(min[i], delta));
+    }
+
+    detail::indexed_point_view<Box, 0> min_corner(box);
+    detail::indexed_point_view<Box, 1> max_corner(box);
+    coordinates<detail::indexed_point_view<Box, 0> >::set(values[0], h.dimension, min_corner);
+    coordinates<detail::indexed_point_view<Box, 1> >::set(values[1], h.dimension, max_corner);
+    return true;
+}
+
+}} // namespace detail::compact
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct read_compact
+{};
+
+template <typename Point>
+struct read_compact<Point, point_tag>
+{
+    template <typename Decoder>
+    static inline bool apply(Point& point, Decoder& decoder)
+    {
+        decoder.reset();
+        return decoder.point(point);
+    }
+};
+
+template <typename Geometry>
+struct read_compact<Geometry, linestring_tag>
+    : detail::compact::range_decoder
+{};
+
+template <typename Geometry>
+struct read_compact<Geometry, ring_tag>
+    : detail::compact::range_decoder
+{};
+
+template <typename Geometry>
+struct read_compact<Geometry, multi_point_tag>
+    : detail::compact::range_decoder
+{};
+
+template <typename Geometry>
+struct read_compact<Geometry, polygon_tag>
+    : detail::compact::polygon_decoder
+{};
+
+template <typename Geometry>
+struct read_compact<Geometry, multi_linestring_tag>
+    : detail::compact::multi_decoder<detail::compact::range_decoder>
+{};
+
+template <typename Geometry>
+struct read_compact<Geometry, multi_polygon_tag>
+    : detail::compact::multi_decoder<detail::compact::polygon_decoder>
+{};
+
+template <typename Geometry>
+struct read_compact<Geometry, box_tag>
+    : detail::compact::indexed_decoder
+{};
+
+template <typename Geometry>
+struct read_compact<Geometry, segment_tag>
+    : detail::compact::indexed_decoder
+{};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace compact
+{
+
+// Reads a geometry, the iterator is moved after it
+template <typename Iterator, typename Geometry>
+inline bool read(Iterator& it, Iterator end, Geometry& geometry)
+{
+    header h;
+    if (! read_header(it, end, h)
+        || h.type != type_of<typename tag<Geometry>::type>::value
+        || ! skip_envelope(it, end, h))
+    {
+        return false;
+    }
+
+    body_decoder<Iterator> decoder(it, end, h);
+    return dispatch::read_compact<Geometry>::apply(geometry, decoder);
+}
+
+}} // namespace detail::compact
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Reads a geometry written by write_compact
+\details The memory of the geometry is reused. Coordinates which are not
+    stored are set to 0, stored coordinates which the geometry doesn't
+    have are skipped.
+\ingroup compact
+\tparam Iterator iterator of bytes
+\tparam Geometry \tparam_geometry
+\param begin iterator positioned at the geometry
+\param end end of the bytes
+\param geometry \param_geometry
+\return false if the bytes are not a geometry of the same type
+*/
+template <typename Iterator, typename Geometry>
+inline bool read_compact(Iterator begin, Iterator end, Geometry& geometry)
+{
+    concepts::check<Geometry>();
+
+    return detail::compact::read(begin, end, geometry);
+}
+
+/*!
+\brief Reads the envelope stored in the header of a geometry written by
+    write_compact, without decoding the geometry
+\ingroup compact
+\return false if the envelope is not stored, e.g. if the geometry is empty
+*/
+template <typename Iterator, typename Box>
+inline bool read_compact_envelope(Iterator it, Iterator end, Box& box)
+{
+    detail::compact::header h;
+    return detail::compact::read_header(it, end, h)
+        && detail::compact::read_envelope(it, end, h, box);
+}
+
+/*!
+\brief Reads consecutive geometries written by write_compact
+\details Each call of next() reads one geometry, the same geometry may be
+    passed to all calls so its memory is reused. The envelope of the next
+    geometry can be read first, so a geometry not needed can be skipped
+    without storing it.
+\ingroup compact
+*/
+class compact_reader
+{
+public:
+    compact_reader(boost::uint8_t const* first, boost::uint8_t const* last)
+        : m_first(first)
+        , m_it(first)
+        , m_last(last)
+    {}
+
+    //! Returns true if there are no more geometries
+    bool done() const
+    {
+        return m_it == m_last;
+    }
+
+    /*!
+    \brief Reads the next geometry
+    \return false if there are no more geometries
+    \note compact_exception is thrown if the bytes are not a geometry
+        of the requested type
+    */
+    template <typename Geometry>
+    bool next(Geometry& geometry)
+    {
+        concepts::check<Geometry>();
+
+        if (m_it == m_last)
+        {
+            return false;
+        }
+        if (! detail::compact::read(m_it, m_last, geometry))
+        {
+            throw compact_exception("Invalid compact geometry");
+        }
+        return true;
+    }
+
+    //! Reads the envelope of the next geometry, false if it is not stored
+    template <typename Box>
+    bool envelope(Box& box) const
+    {
+        return read_compact_envelope(m_it, m_last, box);
+    }
+
+    //! Skips the next geometry, whatever its type
+    void skip()
+    {
+        namespace dc = detail::compact;
+
+        dc::header h;
+        if (! dc::read_header(m_it, m_last, h)
+            || ! dc::skip_envelope(m_it, m_last, h))
+        {
+            throw compact_exception("Invalid compact geometry");
+        }
+        dc::body_decoder<boost::uint8_t const*> decoder(m_it, m_last, h);
+        if (! dc::skip_body(h.type, decoder))
+        {
+            throw compact_exception("Invalid compact geometry");
+        }
+    }
+
+    //! Offset of the next geometry in the buffer
+    std::size_t offset() const
+    {
+        return static_cast<std::size_t>(m_it - m_first);
+    }
+
+private:
+    boost::uint8_t const* m_first;
+    boost::uint8_t const* m_it;
+    boost::uint8_t const* m_last;
+};
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GIS_IO_COMPACT_READ_COMPACT_HPP
@@ -0,0 +1,372 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GIS_IO_COMPACT_WRITE_COMPACT_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GIS_IO_COMPACT_WRITE_COMPACT_HPP
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/views/detail/indexed_point_view.hpp>
+
+#include <boost/geometry/extensions/gis/io/compact/detail/codec.hpp>
+#include <boost/geometry/extensions/gis/io/detail/varint.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Options of the compact binary format
+\details By default the coordinates are stored without loss. If quantized
+    is set they are rounded to precision decimal digits, which may be
+    negative, e.g. 2 for centimeters of coordinates in meters. The
+    envelope of each geometry is stored by default so readers can filter
+    geometries without decoding them.
+*/
+struct compact_options
+{
+    compact_options()
+        : quantized(false)
+        , precision(0)
+        , envelope(true)
+    {}
+
+    explicit compact_options(int precision_, bool envelope_ = true)
+        : quantized(true)
+        , precision(precision_)
+        , envelope(envelope_)
+    {}
+
+    bool quantized;
+    int precision;
+    bool envelope;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace compact
+{
+
+// Writes the counts and the differences of the coordinates
+template <typename OutputIterator, std::size_t Dimension>
+class body_encoder
+{
+public:
+    body_encoder(OutputIterator out, coordinate_codec const& codec)
+        : m_out(out)
+        , m_codec(codec)
+    {
+        reset();
+    }
+
+    void count(std::size_t n)
+    {
+        m_out = varint::write(n, m_out);
+    }
+
+    // Called at the start of each range
+    void reset()
+    {
+        for (std::size_t i = 0; i < Dimension; i++)
+        {
+            m_previous[i] = 0;
+        }
+    }
+
+    template <typename Point>
+    void point(Point const& point)
+    {
+        double values[Dimension];
+        coordinates<Point>::get(point, values);
+        for (std::size_t i = 0; i < Dimension; i++)
+        {
+            boost::int64_t const value = m_codec.encode(values[i]);
+            m_out = varint::write(varint::zigzag_encode(
+                        difference(value, m_previous[i])), m_out);
+            m_previous[i] = value;
+        }
+    }
+
+    OutputIterator out() const { return m_out; }
+
+private:
+    OutputIterator m_out;
+    coordinate_codec const& m_codec;
+    boost::int64_t m_previous[Dimension];
+};
+
+// Minimum and maximum of the coordinates, visiting the same points
+template <std::size_t Dimension>
+class envelope_collector
+{
+public:
+    envelope_collector()
+        : m_empty(true)
+    {}
+
+    void count(std::size_t ) {}
+    void reset() {}
+
+    template <typename Point>
+    void point(Point const& point)
+    {
+        double values[Dimension];
+        coordinates<Point>::get(point, values);
+        for (std::size_t i = 0; i < Dimension; i++)
+        {
+            if (m_empty || values[i] < m_min[i]) { m_min[i] = values[i]; }
+            if (m_empty || values[i] > m_max[i]) { m_max[i] = values[i]; }
+        }
+        m_empty = false;
+    }
+
+    bool empty() const { return m_empty; }
+
+    template <typename OutputIterator>
+    OutputIterator write(OutputIterator out, coordinate_codec const& codec) const
+    {
+        boost::int64_t min[Dimension];
+        for (std::size_t i = 0; i < Dimension; i++)
+        {
+            min[i] = codec.encode(m_min[i]);
+            out = varint::write(varint::zigzag_encode(min[i]), out);
+        }
+        for (std::size_t i = 0; i < Dimension; i++)
+        {
+            out = varint::write(varint::zigzag_encode(
+                    difference(codec.encode(m_max[i]), min[i])), out);
+        }
+        return out;
+    }
+
+private:
+    bool m_empty;
+    double m_min[Dimension];
+    double m_max[Dimension];
+};
+
+struct range_encoder
+{
+    template <typename Range, typename Visitor>
+    static inline void apply(Range const& range, Visitor& visitor)
+    {
+        visitor.count(boost::size(range));
+        visitor.reset();
+        for (typename boost::range_iterator<Range const>::type
+                it = boost::begin(range); it != boost::end(range); ++it)
+        {
+            visitor.point(*it);
+        }
+    }
+};
+
+struct polygon_encoder
+{
+    template <typename Polygon, typename Visitor>
+    static inline void apply(Polygon const& polygon, Visitor& visitor)
+    {
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+
+        visitor.count(1 + boost::size(rings));
+        range_encoder::apply(exterior_ring(polygon), visitor);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            range_encoder::apply(*it, visitor);
+        }
+    }
+};
+
+template <typename PartEncoder>
+struct multi_encoder
+{
+    template <typename MultiGeometry, typename Visitor>
+    static inline void apply(MultiGeometry const& multi, Visitor& visitor)
+    {
+        visitor.count(boost::size(multi));
+        for (typename boost::range_iterator<MultiGeometry const>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            PartEncoder::apply(*it, visitor);
+        }
+    }
+};
+
+// The second point is stored as a difference with the first one
+struct indexed_encoder
+{
+    template <typename Geometry, typename Visitor>
+    static inline void apply(Geometry const& geometry, Visitor& visitor)
+    {
+        visitor.reset();
+        visitor.point(detail::indexed_point_view<Geometry const, 0>(geometry));
+        visitor.point(detail::indexed_point_view<Geometry const, 1>(geometry));
+    }
+};
+
+}} // namespace detail::compact
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct write_compact
+{};
+
+template <typename Point>
+struct write_compact<Point, point_tag>
+{
+    template <typename Visitor>
+    static inline void apply(Point const& point, Visitor& visitor)
+    {
+        visitor.reset();
+        visitor.point(point);
+    }
+};
+
+template <typename Geometry>
+struct write_compact<Geometry, linestring_tag>
+    : detail::compact::range_encoder
+{};
+
+template <typename Geometry>
+struct write_compact<Geometry, ring_tag>
+    : detail::compact::range_encoder
+{};
+
+// The points of a multi point are one range
+template <typename Geometry>
+struct write_compact<Geometry, multi_point_tag>
+    : detail::compact::range_encoder
+{};
+
+template <typename Geometry>
+struct write_compact<Geometry, polygon_tag>
+    : detail::compact::polygon_encoder
+{};
+
+template <typename Geometry>
+struct write_compact<Geometry, multi_linestring_tag>
+    : detail::compact::multi_encoder<detail::compact::range_encoder>
+{};
+
+template <typename Geometry>
+struct write_compact<Geometry, multi_polygon_tag>
+    : detail::compact::multi_encoder<detail::compact::polygon_encoder>
+{};
+
+template <typename Geometry>
+struct write_compact<Geometry, box_tag>
+    : detail::compact::indexed_encoder
+{};
+
+template <typename Geometry>
+struct write_compact<Geometry, segment_tag>
+    : detail::compact::indexed_encoder
+{};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Writes a geometry in the compact binary format
+\details The coordinates of each range are stored as zigzag varint
+    differences with the previous point, optionally quantized, after a
+    header containing the type, the dimension and the envelope. Geometries
+    written consecutively, e.g. to a std::vector through a back_inserter,
+    are read back by compact_reader.
+\ingroup compact
+\tparam Geometry \tparam_geometry
+\tparam OutputIterator output iterator of bytes
+\param geometry \param_geometry
+\param out output iterator to which the bytes are written
+\param options quantization and envelope options
+\return the output iterator after the last byte written
+\note compact_exception is thrown if a quantized coordinate doesn't
+    fit in 64 bits
+\note The coordinates are converted to double, coordinate types which
+    can't be converted exactly, e.g. 64-bit integers or long double,
+    are rejected at compile time
+*/
+template <typename Geometry, typename OutputIterator>
+inline OutputIterator write_compact(Geometry const& geometry, OutputIterator out,
+                                    compact_options const& options = compact_options())
+{
+    namespace dc = detail::compact;
+
+    concepts::check<Geometry const>();
+
+    static const std::size_t dimension = dc::stored_dimension<Geometry>::value;
+    typedef typename coordinate_type<Geometry>::type coordinate_type;
+    BOOST_MPL_ASSERT_MSG
+        (
+            dc::is_exact_as_double<coordinate_type>::value,
+            NOT_IMPLEMENTED_FOR_COORDINATES_NOT_EXACT_AS_DOUBLE,
+            (coordinate_type)
+        );
+    typedef dispatch::write_compact<Geometry> writer;
+
+    dc::coordinate_codec const codec = options.quantized
+        ? dc::coordinate_codec(options.precision)
+        : dc::coordinate_codec();
+
+    dc::envelope_collector<dimension> envelope;
+    if (options.envelope)
+    {
+        writer::apply(geometry, envelope);
+    }
+
+    boost::uint8_t flags = static_cast<boost::uint8_t>(dimension);
+    if (! envelope.empty())
+    {
+        flags |= dc::compact_flag::envelope;
+    }
+    if (codec.quantized())
+    {
+        flags |= dc::compact_flag::quantized;
+    }
+
+    *out++ = static_cast<boost::uint8_t>(dc::type_of<typename tag<Geometry>::type>::value);
+    *out++ = flags;
+    if (codec.quantized())
+    {
+        out = detail::varint::write(detail::varint::zigzag_encode(codec.precision()), out);
+    }
+    if (! envelope.empty())
+    {
+        out = envelope.write(out, codec);
+    }
+
+    dc::body_encoder<OutputIterator, dimension> encoder(out, codec);
+    writer::apply(geometry, encoder);
+    return encoder.out();
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GIS_IO_COMPACT_WRITE_COMPACT_HPP
@@ -0,0 +1,81 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GIS_IO_DETAIL_VARINT_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GIS_IO_DETAIL_VARINT_HPP
+
+#include <boost/cstdint.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace varint
+{
+
+// Maps signed integers to unsigned ones, small absolute values to small
+// values: 0 -> 0, -1 -> 1, 1 -> 2, -2 -> 3...
+inline boost::uint64_t zigzag_encode(boost::int64_t value)
+{
+    return (boost::uint64_t(value) << 1) ^ boost::uint64_t(value >> 63);
+}
+
+inline boost::int64_t zigzag_decode(boost::uint64_t value)
+{
+    return boost::int64_t(value >> 1) ^ -boost::int64_t(value & 1);
+}
+
+// Little endian base 128, 7 bits per byte, the high bit is set
+// if more bytes follow
+template <typename OutputIterator>
+inline OutputIterator write(boost::uint64_t value, OutputIterator out)
+{
+    while (value >= 0x80)
+    {
+        *out++ = static_cast<boost::uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    *out++ = static_cast<boost::uint8_t>(value);
+    return out;
+}
+
+template <typename Iterator>
+inline bool read(Iterator& it, Iterator end, boost::uint64_t& value)
+{
+    value = 0;
+    for (unsigned int shift = 0; shift < 64; shift += 7)
+    {
+        if (it == end)
+        {
+            return false;
+        }
+        boost::uint64_t const byte = static_cast<boost::uint8_t>(*it);
+        ++it;
+        value |= (byte & 0x7f) << shift;
+        if (byte < 0x80)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename Iterator>
+inline bool skip(Iterator& it, Iterator end)
+{
+    boost::uint64_t value;
+    return read(it, end, value);
+}
+
+}} // namespace detail::varint
+#endif // DOXYGEN_NO_DETAIL
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GIS_IO_DETAIL_VARINT_HPP
@@ -0,0 +1,521 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXTENSIONS_GIS_IO_MVT_ENCODE_MVT_HPP
+#define BOOST_GEOMETRY_EXTENSIONS_GIS_IO_MVT_ENCODE_MVT_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/concepts/check.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/strategies/transform/map_transformer.hpp>
+
+#include <boost/geometry/extensions/gis/io/detail/varint.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Geometry types of vector tile features
+\ingroup mvt
+*/
+struct mvt_geometry_type
+{
+    enum enum_t
+    {
+        unknown = 0,
+        point = 1,
+        linestring = 2,
+        polygon = 3
+    };
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace mvt
+{
+
+struct command
+{
+    enum enum_t
+    {
+        move_to = 1,
+        line_to = 2,
+        close_path = 7
+    };
+};
+
+inline boost::uint32_t command_integer(command::enum_t id, std::size_t count)
+{
+    return (boost::uint32_t(id) & 0x7) | (boost::uint32_t(count) << 3);
+}
+
+inline boost::uint32_t parameter(boost::int32_t value)
+{
+    return static_cast<boost::uint32_t>(varint::zigzag_encode(value));
+}
+
+inline boost::int32_t parameter_value(boost::uint32_t value)
+{
+    return static_cast<boost::int32_t>(varint::zigzag_decode(value));
+}
+
+struct tile_point
+{
+    boost::int32_t x, y;
+
+    bool operator==(tile_point const& other) const
+    {
+        return x == other.x && y == other.y;
+    }
+};
+
+// Coordinates are limited such that the differences, at most 2^31 - 2
+// in absolute value, fit in 32 bits
+static const double max_coordinate = (1 << 30) - 1;
+
+/*!
+\brief Internal, writes the commands of a geometry to the caller's buffer
+\details The points are quantized one by one, duplicate points and points
+    in the middle of straight segments are replaced in the buffer, so no
+    copy of the geometry is made. Rings collapsed by the quantization are
+    removed and rings not having the orientation required by the
+    specification are reversed in place.
+*/
+template <typename Container, typename Strategy>
+class command_writer
+{
+public:
+    command_writer(Container& commands, Strategy const& strategy)
+        : m_commands(commands)
+        , m_strategy(strategy)
+    {
+        m_cursor.x = 0;
+        m_cursor.y = 0;
+    }
+
+    template <typename Point>
+    tile_point quantize(Point const& point) const
+    {
+        model::point<double, 2, cs::cartesian> mapped;
+        m_strategy.apply(point, mapped);
+
+        tile_point result;
+        result.x = round(get<0>(mapped));
+        result.y = round(get<1>(mapped));
+        return result;
+    }
+
+    // Points of a point or multi point, consecutive duplicates are removed
+    template <typename Iterator>
+    bool points(Iterator first, Iterator last)
+    {
+        std::size_t const start = m_commands.size();
+        m_commands.push_back(0);
+        std::size_t count = 0;
+        for (Iterator it = first; it != last; ++it)
+        {
+            tile_point const p = quantize(*it);
+            if (count > 0 && p == m_cursor)
+            {
+                continue;
+            }
+            push(p, m_cursor);
+            m_cursor = p;
+            count++;
+        }
+        if (count == 0)
+        {
+            m_commands.resize(start);
+            return false;
+        }
+        m_commands[start] = command_integer(command::move_to, count);
+        return true;
+    }
+
+    // A linestring or a ring. Rings having a positive orientation are
+    // exterior rings, negative orientation interior rings.
+    template <typename Range>
+    bool range(Range const& range, bool is_ring, int orientation)
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator;
+
+        iterator it = boost::begin(range);
+        iterator const end = boost::end(range);
+        if (it == end)
+        {
+            return false;
+        }
+
+        std::size_t const start = m_commands.size();
+        tile_point const start_cursor = m_cursor;
+
+        tile_point const first = quantize(*it);
+        m_commands.push_back(command_integer(command::move_to, 1));
+        push(first, m_cursor);
+        std::size_t const line_to = m_commands.size();
+        m_commands.push_back(0);
+
+        // last two points written
+        std::size_t count = 1;
+        tile_point previous = first;
+        tile_point last = first;
+        for (++it; it != end; ++it)
+        {
+            tile_point const p = quantize(*it);
+            if (p == last)
+            {
+                continue;
+            }
+            if (count >= 2 && is_continuation(previous, last, p))
+            {
+                m_commands.resize(m_commands.size() - 2);
+                push(p, previous);
+            }
+            else
+            {
+                push(p, last);
+                previous = last;
+                count++;
+            }
+            last = p;
+        }
+
+        if (is_ring && count >= 2 && last == first)
+        {
+            // closed by the close path command
+            m_commands.resize(m_commands.size() - 2);
+            count--;
+            last = previous;
+        }
+
+        boost::int64_t const area = is_ring ? double_area(start + 1, first) : 0;
+        if (count < (is_ring ? 3u : 2u) || (is_ring && area == 0))
+        {
+            m_commands.resize(start);
+            m_cursor = start_cursor;
+            return false;
+        }
+
+        m_commands[line_to] = command_integer(command::line_to, count - 1);
+        m_cursor = last;
+
+        if (is_ring)
+        {
+            if ((area > 0) != (orientation > 0))
+            {
+                reverse(start + 1, count);
+                m_cursor = first;
+            }
+            m_commands.push_back(command_integer(command::close_path, 1));
+        }
+        return true;
+    }
+
+private:
+    static boost::int32_t round(double value)
+    {
+        double const rounded = std::floor(value + 0.5);
+        return static_cast<boost::int32_t>(rounded < -max_coordinate ? -max_coordinate
+                                         : rounded > max_coordinate ? max_coordinate
+                                         : rounded);
+    }
+
+    void push(tile_point const& p, tile_point const& from)
+    {
+        m_commands.push_back(parameter(p.x - from.x));
+        m_commands.push_back(parameter(p.y - from.y));
+    }
+
+    // q continues the segment from p1 to p2 in the same direction
+    static bool is_continuation(tile_point const& p1, tile_point const& p2,
+                                tile_point const& q)
+    {
+        boost::int64_t const dx1 = boost::int64_t(p2.x) - p1.x;
+        boost::int64_t const dy1 = boost::int64_t(p2.y) - p1.y;
+        boost::int64_t const dx2 = boost::int64_t(q.x) - p2.x;
+        boost::int64_t const dy2 = boost::int64_t(q.y) - p2.y;
+        return dx1 * dy2 == dy1 * dx2
+            && dx1 * dx2 + dy1 * dy2 > 0;
+    }
+
+    // Twice the area of a ring written from index, positive if the ring
+    // is clockwise in tile coordinates having y downwards
+    boost::int64_t double_area(std::size_t index, tile_point const& first) const
+    {
+        std::size_t const end = m_commands.size();
+        boost::int64_t result = 0;
+        boost::int64_t x = first.x;
+        boost::int64_t y = first.y;
+        // skip the move to parameters and the line to command
+        for (std::size_t i = index + 3; i + 1 < end; i += 2)
+        {
+            boost::int64_t const nx = x + parameter_value(m_commands[i]);
+            boost::int64_t const ny = y + parameter_value(m_commands[i + 1]);
+            result += x * ny - nx * y;
+            x = nx;
+            y = ny;
+        }
+        result += x * first.y - boost::int64_t(first.x) * y;
+        return result;
+    }
+
+    // Reverses the points of a ring written from index: the first point
+    // becomes the last one, the differences are reversed and negated
+    void reverse(std::size_t index, std::size_t count)
+    {
+        std::size_t const lines = index + 3;
+        boost::int32_t dx = parameter_value(m_commands[index]);
+        boost::int32_t dy = parameter_value(m_commands[index + 1]);
+        for (std::size_t i = 0; i + 1 < count; i++)
+        {
+            dx += parameter_value(m_commands[lines + 2 * i]);
+            dy += parameter_value(m_commands[lines + 2 * i + 1]);
+        }
+        m_commands[index] = parameter(dx);
+        m_commands[index + 1] = parameter(dy);
+
+        std::size_t const n = count - 1;
+        for (std::size_t i = 0, j = n - 1; i < j; i++, j--)
+        {
+            std::swap(m_commands[lines + 2 * i], m_commands[lines + 2 * j]);
+            std::swap(m_commands[lines + 2 * i + 1], m_commands[lines + 2 * j + 1]);
+        }
+        for (std::size_t i = lines; i < lines + 2 * n; i++)
+        {
+            m_commands[i] = parameter(-parameter_value(m_commands[i]));
+        }
+    }
+
+    Container& m_commands;
+    Strategy const& m_strategy;
+    tile_point m_cursor;
+};
+
+struct polygon_writer
+{
+    template <typename Polygon, typename Writer>
+    static inline bool apply(Polygon const& polygon, Writer& writer)
+    {
+        // interior rings of a collapsed exterior ring are not written
+        if (! writer.range(exterior_ring(polygon), true, 1))
+        {
+            return false;
+        }
+
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            writer.range(*it, true, -1);
+        }
+        return true;
+    }
+};
+
+}} // namespace detail::mvt
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct encode_mvt
+{};
+
+template <typename Point>
+struct encode_mvt<Point, point_tag>
+{
+    static const mvt_geometry_type::enum_t type = mvt_geometry_type::point;
+
+    template <typename Writer>
+    static inline bool apply(Point const& point, Writer& writer)
+    {
+        return writer.points(&point, &point + 1);
+    }
+};
+
+template <typename MultiPoint>
+struct encode_mvt<MultiPoint, multi_point_tag>
+{
+    static const mvt_geometry_type::enum_t type = mvt_geometry_type::point;
+
+    template <typename Writer>
+    static inline bool apply(MultiPoint const& multi_point, Writer& writer)
+    {
+        return writer.points(boost::begin(multi_point), boost::end(multi_point));
+    }
+};
+
+template <typename Linestring>
+struct encode_mvt<Linestring, linestring_tag>
+{
+    static const mvt_geometry_type::enum_t type = mvt_geometry_type::linestring;
+
+    template <typename Writer>
+    static inline bool apply(Linestring const& linestring, Writer& writer)
+    {
+        return writer.range(linestring, false, 0);
+    }
+};
+
+template <typename MultiLinestring>
+struct encode_mvt<MultiLinestring, multi_linestring_tag>
+{
+    static const mvt_geometry_type::enum_t type = mvt_geometry_type::linestring;
+
+    template <typename Writer>
+    static inline bool apply(MultiLinestring const& multi, Writer& writer)
+    {
+        bool result = false;
+        for (typename boost::range_iterator<MultiLinestring const>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            result = writer.range(*it, false, 0) || result;
+        }
+        return result;
+    }
+};
+
+template <typename Ring>
+struct encode_mvt<Ring, ring_tag>
+{
+    static const mvt_geometry_type::enum_t type = mvt_geometry_type::polygon;
+
+    template <typename Writer>
+    static inline bool apply(Ring const& ring, Writer& writer)
+    {
+        return writer.range(ring, true, 1);
+    }
+};
+
+template <typename Polygon>
+struct encode_mvt<Polygon, polygon_tag>
+    : detail::mvt::polygon_writer
+{
+    static const mvt_geometry_type::enum_t type = mvt_geometry_type::polygon;
+};
+
+template <typename MultiPolygon>
+struct encode_mvt<MultiPolygon, multi_polygon_tag>
+{
+    static const mvt_geometry_type::enum_t type = mvt_geometry_type::polygon;
+
+    template <typename Writer>
+    static inline bool apply(MultiPolygon const& multi, Writer& writer)
+    {
+        bool result = false;
+        for (typename boost::range_iterator<MultiPolygon const>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            result = detail::mvt::polygon_writer::apply(*it, writer) || result;
+        }
+        return result;
+    }
+};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Encodes a geometry as the commands of a vector tile feature
+\details The points are mapped to tile coordinates by the strategy and
+    rounded to integers. Duplicate points and points in the middle of
+    straight segments created by the rounding are removed, rings and
+    linestrings collapsed by the rounding are not written. Exterior rings
+    are written clockwise and interior rings counterclockwise in tile
+    coordinates, having y downwards, whatever their orientation in the
+    geometry. The commands and zigzag encoded parameters are appended to
+    the container, e.g. the std::vector<boost::uint32_t> of the feature
+    reused for all features.
+\ingroup mvt
+\tparam Geometry \tparam_geometry
+\tparam Strategy transformation strategy mapping the points of the
+    geometry to a 2D cartesian point of doubles
+\tparam Container random access container of boost::uint32_t
+\param geometry \param_geometry
+\param strategy transformation strategy
+\param commands container to which the commands are appended
+\return the geometry type of the feature, or unknown if nothing was
+    written because the geometry collapsed
+\note The geometry is expected to be clipped to the tile, including its
+    buffer. Coordinates are limited to 2^30 - 1 in absolute value.
+*/
+template <typename Geometry, typename Strategy, typename Container>
+inline mvt_geometry_type::enum_t encode_mvt(Geometry const& geometry,
+                                            Strategy const& strategy,
+                                            Container& commands)
+{
+    concepts::check<Geometry const>();
+
+    typedef dispatch::encode_mvt<Geometry> encoder;
+
+    detail::mvt::command_writer<Container, Strategy> writer(commands, strategy);
+    return encoder::apply(geometry, writer)
+        ? encoder::type
+        : mvt_geometry_type::unknown;
+}
+
+/*!
+\brief Encodes a geometry as the commands of a vector tile feature
+\details The tile box is mapped to tile coordinates from (0, 0) at its
+    upper left corner to (extent, extent) at its lower right corner.
+\ingroup mvt
+\param geometry \param_geometry
+\param tile box of the tile in the coordinates of the geometry
+\param extent extent of the tile, e.g. 4096
+\param commands container to which the commands are appended
+\qbk{[heading Example]
+\code
+std::vector<boost::uint32_t> commands;
+for (...)
+{
+    commands.clear();
+    type = encode_mvt(feature_geometry, tile_box, 4096, commands);
+    if (type != mvt_geometry_type::unknown)
+    {
+        // store type and commands in the feature
+    }
+}
+\endcode
+}
+*/
+template <typename Geometry, typename Box, typename Container>
+inline mvt_geometry_type::enum_t encode_mvt(Geometry const& geometry,
+                                            Box const& tile, std::size_t extent,
+                                            Container& commands)
+{
+    // y downwards, independent scales
+    strategy::transform::map_transformer<double, 2, 2, true, false>
+        const strategy(tile, double(extent), double(extent));
+    return encode_mvt(geometry, strategy, commands);
+}
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_EXTENSIONS_GIS_IO_MVT_ENCODE_MVT_HPP
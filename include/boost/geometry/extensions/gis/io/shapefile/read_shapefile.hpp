@@ -0,0 +1,829 @@
+// Boost.Geometry
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_EXT_GIS_IO_SHAPEFILE_READ_SHAPEFILE_HPP
+#define BOOST_GEOMETRY_EXT_GIS_IO_SHAPEFILE_READ_SHAPEFILE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exception.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/interior_type.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/util/range.hpp>
+
+#include <boost/geometry/extensions/gis/io/wkb/detail/endian.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/wkb_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+
+/*!
+\brief Read shapefile exception
+\details Thrown if a shapefile can't be opened, if it is corrupted or if a
+    record can't be stored in the requested geometry
+*/
+class read_shapefile_exception : public geometry::exception
+{
+public:
+    explicit read_shapefile_exception(std::string const& message)
+        : m_message(message)
+    {}
+
+    virtual ~read_shapefile_exception() throw() {}
+
+    virtual char const* what() const throw()
+    {
+        return m_message.c_str();
+    }
+
+private:
+    std::string m_message;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace shapefile
+{
+
+struct shape_type
+{
+    enum enum_t
+    {
+        null_shape = 0,
+        point = 1,
+        polyline = 3,
+        polygon = 5,
+        multipoint = 8,
+        pointz = 11,
+        polylinez = 13,
+        polygonz = 15,
+        multipointz = 18,
+        pointm = 21,
+        polylinem = 23,
+        polygonm = 25,
+        multipointm = 28
+    };
+};
+
+// Sizes in the files are in 16-bit words
+static const std::size_t header_size = 100;
+static const std::size_t record_header_size = 8;
+static const std::size_t word_size = 2;
+
+template <typename T, typename Endian>
+inline T load(char const* data)
+{
+    // the bytes are loaded unsigned
+    endian::endian_value<T> value;
+    value.template load<Endian>(reinterpret_cast<boost::uint8_t const*>(data));
+    return value;
+}
+
+inline boost::int32_t load_int32_be(char const* data)
+{
+    return load<boost::int32_t, endian::big_endian_tag>(data);
+}
+
+inline boost::int32_t load_int32_le(char const* data)
+{
+    return load<boost::int32_t, endian::little_endian_tag>(data);
+}
+
+inline double load_double(char const* data)
+{
+    return load<double, endian::little_endian_tag>(data);
+}
+
+inline void throw_corrupted()
+{
+    throw read_shapefile_exception("Corrupted shapefile");
+}
+
+/*!
+\brief Internal, content of a record
+\details The arrays are checked to be stored inside the record. The points
+    are stored as x, y doubles, the z values are stored in a separate array.
+*/
+struct record
+{
+    record()
+        : type(shape_type::null_shape)
+        , num_parts(0)
+        , num_points(0)
+        , box(0)
+        , parts(0)
+        , points(0)
+        , z(0)
+    {}
+
+    record(char const* data, std::size_t size)
+        : type(shape_type::null_shape)
+        , num_parts(0)
+        , num_points(0)
+        , box(0)
+        , parts(0)
+        , points(0)
+        , z(0)
+    {
+        if (size < 4)
+        {
+            throw_corrupted();
+        }
+
+        boost::int32_t const stored_type = load_int32_le(data);
+        bool const has_z = stored_type / 10 == 1;
+        type = shape_type::enum_t(stored_type % 10 + (stored_type >= 30 ? 30 : 0));
+
+        char const* const end = data + size;
+        char const* it = data + 4;
+        switch (type)
+        {
+        case shape_type::null_shape :
+            return;
+        case shape_type::point :
+            if (end - it < (has_z ? 16 + 8 : 16))
+            {
+                throw_corrupted();
+            }
+            num_parts = 1;
+            num_points = 1;
+            points = it;
+            it += 16;
+            z = has_z ? it : 0;
+            break;
+        case shape_type::multipoint :
+        case shape_type::polyline :
+        case shape_type::polygon :
+            if (end - it < (type == shape_type::multipoint ? 32 + 4 : 32 + 8))
+            {
+                throw_corrupted();
+            }
+            box = it;
+            it += 32;
+            if (type == shape_type::multipoint)
+            {
+                num_points = load_int32_le(it);
+                it += 4;
+            }
+            else
+            {
+                num_parts = load_int32_le(it);
+                num_points = load_int32_le(it + 4);
+                it += 8;
+            }
+            if (num_parts < 0 || num_points < 0
+                || std::size_t(end - it) / 4 < std::size_t(num_parts))
+            {
+                throw_corrupted();
+            }
+            parts = num_parts > 0 ? it : 0;
+            it += 4 * num_parts;
+            if (std::size_t(end - it) / 16 < std::size_t(num_points))
+            {
+                throw_corrupted();
+            }
+            points = it;
+            it += 16 * num_points;
+            if (has_z)
+            {
+                // range of z and z values
+                if (end - it < 16
+                    || std::size_t(end - it - 16) / 8 < std::size_t(num_points))
+                {
+                    throw_corrupted();
+                }
+                z = it + 16;
+            }
+            break;
+        default :
+            throw read_shapefile_exception("Unsupported shape type");
+        }
+
+        // each part starts after the previous one
+        for (boost::int32_t p = 0; p < num_parts && parts != 0; ++p)
+        {
+            boost::int32_t const first = part_begin(p);
+            if (first < 0 || first > num_points || (p > 0 && first < part_begin(p - 1)))
+            {
+                throw_corrupted();
+            }
+        }
+    }
+
+    boost::int32_t part_begin(boost::int32_t p) const
+    {
+        return parts != 0 ? load_int32_le(parts + 4 * p) : 0;
+    }
+
+    boost::int32_t part_end(boost::int32_t p) const
+    {
+        return p + 1 < num_parts ? part_begin(p + 1) : num_points;
+    }
+
+    double x(boost::int32_t i) const { return load_double(points + 16 * i); }
+    double y(boost::int32_t i) const { return load_double(points + 16 * i + 8); }
+    double get_z(boost::int32_t i) const { return z != 0 ? load_double(z + 8 * i) : 0.0; }
+
+    // Twice the signed area, positive for counterclockwise rings (holes)
+    double ring_area(boost::int32_t p) const
+    {
+        boost::int32_t const first = part_begin(p);
+        boost::int32_t const last = part_end(p);
+        double sum = 0;
+        for (boost::int32_t i = first; i + 1 < last; ++i)
+        {
+            sum += (x(i) - x(first)) * (y(i + 1) - y(first))
+                 - (x(i + 1) - x(first)) * (y(i) - y(first));
+        }
+        return sum;
+    }
+
+    shape_type::enum_t type;
+    boost::int32_t num_parts;
+    boost::int32_t num_points;
+    char const* box;
+    char const* parts;
+    char const* points;
+    char const* z;
+};
+
+template <typename Point, std::size_t Dimension = dimension<Point>::value>
+struct point_assigner
+{
+    static inline void apply(record const& r, boost::int32_t i, Point& point)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+        set<0>(point, static_cast<coordinate_type>(r.x(i)));
+        set<1>(point, static_cast<coordinate_type>(r.y(i)));
+        set<2>(point, static_cast<coordinate_type>(r.get_z(i)));
+    }
+};
+
+template <typename Point>
+struct point_assigner<Point, 2>
+{
+    static inline void apply(record const& r, boost::int32_t i, Point& point)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+        set<0>(point, static_cast<coordinate_type>(r.x(i)));
+        set<1>(point, static_cast<coordinate_type>(r.y(i)));
+    }
+};
+
+inline void check_type(record const& r, shape_type::enum_t type)
+{
+    if (r.type != type)
+    {
+        throw read_shapefile_exception("Shape type not matching the geometry");
+    }
+}
+
+// Points of a part in the order and closure of the Range
+template <typename Range>
+inline void assign_part(record const& r, boost::int32_t p, Range& range)
+{
+    typedef typename point_type<Range>::type point_type;
+
+    boost::int32_t const first = r.part_begin(p);
+    boost::int32_t const last = r.part_end(p);
+
+    // The memory of the range is reused
+    range::resize(range, std::size_t(last - first));
+    boost::int32_t i = first;
+    for (typename boost::range_iterator<Range>::type it = boost::begin(range);
+         it != boost::end(range); ++it, ++i)
+    {
+        point_assigner<point_type>::apply(r, i, *it);
+    }
+}
+
+// Rings are stored closed and clockwise, holes counterclockwise
+template <typename Ring>
+inline void assign_ring(record const& r, boost::int32_t p, Ring& ring)
+{
+    assign_part(r, p, ring);
+
+    if (geometry::point_order<Ring>::value == counterclockwise)
+    {
+        std::reverse(boost::begin(ring), boost::end(ring));
+    }
+    if (geometry::closure<Ring>::value == open && boost::size(ring) > 1)
+    {
+        range::resize(ring, boost::size(ring) - 1);
+    }
+}
+
+struct read_point
+{
+    template <typename Point>
+    static inline void apply(record const& r, Point& point)
+    {
+        check_type(r, shape_type::point);
+        point_assigner<Point>::apply(r, 0, point);
+    }
+};
+
+struct read_multi_point
+{
+    template <typename MultiPoint>
+    static inline void apply(record const& r, MultiPoint& multi_point)
+    {
+        if (r.type == shape_type::point)
+        {
+            range::resize(multi_point, 1);
+            read_point::apply(r, range::front(multi_point));
+            return;
+        }
+        check_type(r, shape_type::multipoint);
+        assign_part(r, 0, multi_point);
+    }
+};
+
+struct read_linestring
+{
+    template <typename Linestring>
+    static inline void apply(record const& r, Linestring& linestring)
+    {
+        check_type(r, shape_type::polyline);
+        if (r.num_parts != 1)
+        {
+            throw read_shapefile_exception("Polyline with more than one part");
+        }
+        assign_part(r, 0, linestring);
+    }
+};
+
+struct read_multi_linestring
+{
+    template <typename MultiLinestring>
+    static inline void apply(record const& r, MultiLinestring& multi_linestring)
+    {
+        check_type(r, shape_type::polyline);
+        range::resize(multi_linestring, std::size_t(r.num_parts));
+        boost::int32_t p = 0;
+        for (typename boost::range_iterator<MultiLinestring>::type
+                it = boost::begin(multi_linestring);
+             it != boost::end(multi_linestring); ++it, ++p)
+        {
+            assign_part(r, p, *it);
+        }
+    }
+};
+
+// Each clockwise ring starts a polygon, the following counterclockwise rings
+// are its holes
+struct read_multi_polygon
+{
+    template <typename Polygon>
+    static inline void assign(record const& r, boost::int32_t first,
+                              boost::int32_t last, Polygon& polygon)
+    {
+        typedef typename interior_type<Polygon>::type interior_type;
+
+        assign_ring(r, first, exterior_ring(polygon));
+
+        typename interior_return_type<Polygon>::type
+            interiors = interior_rings(polygon);
+        range::resize(interiors, std::size_t(last - first - 1));
+        boost::int32_t p = first + 1;
+        for (typename boost::range_iterator<interior_type>::type
+                it = boost::begin(interiors);
+             it != boost::end(interiors); ++it, ++p)
+        {
+            assign_ring(r, p, *it);
+        }
+    }
+
+    static inline std::vector<boost::int32_t> outer_rings(record const& r)
+    {
+        check_type(r, shape_type::polygon);
+
+        std::vector<boost::int32_t> result;
+        for (boost::int32_t p = 0; p < r.num_parts; ++p)
+        {
+            if (p == 0 || r.ring_area(p) <= 0)
+            {
+                result.push_back(p);
+            }
+        }
+        result.push_back(r.num_parts);
+        return result;
+    }
+
+    template <typename MultiPolygon>
+    static inline void apply(record const& r, MultiPolygon& multi_polygon)
+    {
+        std::vector<boost::int32_t> const outers = outer_rings(r);
+
+        range::resize(multi_polygon, outers.size() - 1);
+        std::size_t i = 0;
+        for (typename boost::range_iterator<MultiPolygon>::type
+                it = boost::begin(multi_polygon);
+             it != boost::end(multi_polygon); ++it, ++i)
+        {
+            assign(r, outers[i], outers[i + 1], *it);
+        }
+    }
+};
+
+struct read_polygon
+{
+    template <typename Polygon>
+    static inline void apply(record const& r, Polygon& polygon)
+    {
+        std::vector<boost::int32_t> const outers = read_multi_polygon::outer_rings(r);
+        if (outers.size() > 2)
+        {
+            throw read_shapefile_exception("Polygon with more than one exterior ring");
+        }
+        if (r.num_parts == 0)
+        {
+            range::clear(exterior_ring(polygon));
+            range::clear(interior_rings(polygon));
+            return;
+        }
+        read_multi_polygon::assign(r, 0, r.num_parts, polygon);
+    }
+};
+
+}} // namespace detail::shapefile
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct read_shapefile_record
+{
+    BOOST_MPL_ASSERT_MSG
+        (
+            false, NOT_OR_NOT_YET_IMPLEMENTED_FOR_THIS_GEOMETRY_TYPE
+            , (Geometry)
+        );
+};
+
+template <typename Point>
+struct read_shapefile_record<Point, point_tag>
+    : detail::shapefile::read_point
+{};
+
+template <typename MultiPoint>
+struct read_shapefile_record<MultiPoint, multi_point_tag>
+    : detail::shapefile::read_multi_point
+{};
+
+template <typename Linestring>
+struct read_shapefile_record<Linestring, linestring_tag>
+    : detail::shapefile::read_linestring
+{};
+
+template <typename MultiLinestring>
+struct read_shapefile_record<MultiLinestring, multi_linestring_tag>
+    : detail::shapefile::read_multi_linestring
+{};
+
+template <typename Polygon>
+struct read_shapefile_record<Polygon, polygon_tag>
+    : detail::shapefile::read_polygon
+{};
+
+template <typename MultiPolygon>
+struct read_shapefile_record<MultiPolygon, multi_polygon_tag>
+    : detail::shapefile::read_multi_polygon
+{};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Reads the records of an ESRI shapefile (.shp)
+\details The .shp and .shx files are memory mapped, only the pages of the
+    records which are read are loaded. The records are accessed by index
+    through the .shx file, if it doesn't exist the .shp file is scanned once
+    when it is opened. The geometries are built directly from the mapped
+    bytes, reusing their memory. Points, multipoints, polylines and polygons
+    with optional z and m are supported; m values are ignored.
+\qbk{
+[heading Example]
+\code
+shapefile_reader reader("roads.shp");
+std::vector<std::pair<box_type, std::size_t> > values;
+reader.envelopes<box_type>(std::back_inserter(values));
+bgi::rtree<std::pair<box_type, std::size_t>, bgi::rstar<16> > rtree(values);
+
+linestring_type line;
+reader.read(values.front().second, line);
+\endcode
+}
+*/
+class shapefile_reader : boost::noncopyable
+{
+public:
+    /*!
+    \brief Opens the .shp file and the .shx file next to it
+    \details read_shapefile_exception is thrown if the .shp file can't
+        be mapped or its header is not valid
+    */
+    explicit shapefile_reader(std::string const& filename)
+    {
+        namespace shp = detail::shapefile;
+
+        if (! map(filename, m_shp_region))
+        {
+            throw read_shapefile_exception("Can't open " + filename);
+        }
+
+        m_shp = static_cast<char const*>(m_shp_region.get_address());
+        m_shp_size = m_shp_region.get_size();
+        if (m_shp_size < shp::header_size || shp::load_int32_be(m_shp) != 9994)
+        {
+            shp::throw_corrupted();
+        }
+        m_shape_type = shp::load_int32_le(m_shp + 32);
+
+        // roads.shp -> roads.shx, ROADS.SHP -> ROADS.SHX
+        std::string index_name = filename;
+        std::size_t const size = index_name.size();
+        if (size > 4 && index_name[size - 4] == '.'
+            && (index_name[size - 3] == 's' || index_name[size - 3] == 'S')
+            && (index_name[size - 2] == 'h' || index_name[size - 2] == 'H')
+            && (index_name[size - 1] == 'p' || index_name[size - 1] == 'P'))
+        {
+            index_name[size - 1] = index_name[size - 1] == 'P' ? 'X' : 'x';
+        }
+        if (index_name != filename && map(index_name, m_shx_region)
+            && m_shx_region.get_size() >= shp::header_size)
+        {
+            m_shx = static_cast<char const*>(m_shx_region.get_address());
+            m_count = (m_shx_region.get_size() - shp::header_size)
+                    / shp::record_header_size;
+        }
+        else
+        {
+            m_shx = 0;
+            scan();
+        }
+    }
+
+    //! Number of records
+    std::size_t size() const
+    {
+        return m_count;
+    }
+
+    //! Shape type stored in the header, e.g. 5 for polygons
+    int shape_type() const
+    {
+        return m_shape_type;
+    }
+
+    //! Returns true if the record doesn't contain a shape
+    bool is_null(std::size_t index) const
+    {
+        return get(index).type == detail::shapefile::shape_type::null_shape;
+    }
+
+    /*!
+    \brief Reads the geometry of a record
+    \details read_shapefile_exception is thrown if the shape type of the
+        record doesn't correspond to the geometry, e.g. if a polyline having
+        more than one part is read as a linestring
+    */
+    template <typename Geometry>
+    void read(std::size_t index, Geometry& geometry) const
+    {
+        dispatch::read_shapefile_record<Geometry>::apply(get(index), geometry);
+    }
+
+    /*!
+    \brief Returns the bounding box of the record stored in the file
+    \return false for null shapes
+    */
+    template <typename Box>
+    bool envelope(std::size_t index, Box& box) const
+    {
+        detail::shapefile::record const r = get(index);
+        if (r.type == detail::shapefile::shape_type::null_shape
+            || (r.num_points == 0 && r.box == 0))
+        {
+            return false;
+        }
+
+        if (r.box != 0)
+        {
+            set_box(box, r.box);
+        }
+        else
+        {
+            set_box(box, r.points, r.points);
+        }
+        return true;
+    }
+
+    //! Returns the bounding box of all records stored in the header
+    template <typename Box>
+    void envelope(Box& box) const
+    {
+        set_box(box, m_shp + 36);
+    }
+
+    /*!
+    \brief Writes the bounding boxes of the records with their indexes
+    \details The pairs may be used to create an rtree with the packing
+        algorithm. Null shapes are skipped.
+    */
+    template <typename Box, typename OutputIterator>
+    OutputIterator envelopes(OutputIterator out) const
+    {
+        Box box;
+        for (std::size_t i = 0; i < m_count; ++i)
+        {
+            if (envelope(i, box))
+            {
+                *out = std::make_pair(box, i);
+                ++out;
+            }
+        }
+        return out;
+    }
+
+    //! Number of parts of a record, e.g. rings of polygons
+    std::size_t num_parts(std::size_t index) const
+    {
+        return std::size_t(get(index).num_parts);
+    }
+
+    /*!
+    \brief Returns a view of the points of a part reading them in place
+    \tparam View wkb_linestring_view or wkb_ring_view
+    \details The view is valid as long as the reader exists.
+    */
+    template <typename View>
+    View part_view(std::size_t index, std::size_t part) const
+    {
+        detail::shapefile::record const r = get(index);
+        if (part >= std::size_t(r.num_parts))
+        {
+            throw read_shapefile_exception("Part index out of range");
+        }
+
+        detail::wkb::view_header header;
+        header.data = reinterpret_cast<boost::uint8_t const*>(r.points)
+                    + 16 * r.part_begin(boost::int32_t(part));
+        header.order = detail::wkb::byte_order_type::ndr;
+        header.stride = 16;
+        return View(header, std::size_t(r.part_end(boost::int32_t(part))
+                                      - r.part_begin(boost::int32_t(part))));
+    }
+
+private:
+    static bool map(std::string const& filename,
+                    boost::interprocess::mapped_region& region)
+    {
+        namespace ipc = boost::interprocess;
+
+        try
+        {
+            ipc::file_mapping mapping(filename.c_str(), ipc::read_only);
+            ipc::mapped_region mapped(mapping, ipc::read_only);
+            region.swap(mapped);
+        }
+        catch (ipc::interprocess_exception const&)
+        {
+            return false;
+        }
+        return true;
+    }
+
+    // Offsets of the records if there is no .shx file
+    void scan()
+    {
+        namespace shp = detail::shapefile;
+
+        std::size_t offset = shp::header_size;
+        while (offset + shp::record_header_size <= m_shp_size)
+        {
+            // A negative or too large length would make the offset wrap
+            // around or point beyond the file
+            boost::int32_t const length = shp::load_int32_be(m_shp + offset + 4);
+            if (length < 0
+                || std::size_t(length) > (m_shp_size - offset
+                                          - shp::record_header_size)
+                                         / shp::word_size)
+            {
+                shp::throw_corrupted();
+            }
+            m_offsets.push_back(offset);
+            offset += shp::record_header_size + std::size_t(length) * shp::word_size;
+        }
+        m_count = m_offsets.size();
+    }
+
+    detail::shapefile::record get(std::size_t index) const
+    {
+        namespace shp = detail::shapefile;
+
+        if (index >= m_count)
+        {
+            throw read_shapefile_exception("Record index out of range");
+        }
+
+        std::size_t offset = m_offsets.empty() ? 0 : m_offsets[index];
+        if (m_shx != 0)
+        {
+            boost::int32_t const words = shp::load_int32_be(m_shx
+                    + shp::header_size + index * shp::record_header_size);
+            if (words < 0)
+            {
+                shp::throw_corrupted();
+            }
+            offset = std::size_t(words) * shp::word_size;
+        }
+        if (offset < shp::header_size
+            || offset > m_shp_size - shp::record_header_size)
+        {
+            shp::throw_corrupted();
+        }
+
+        boost::int32_t const length = shp::load_int32_be(m_shp + offset + 4);
+        if (length < 0
+            || std::size_t(length) > (m_shp_size - offset
+                                      - shp::record_header_size)
+                                     / shp::word_size)
+        {
+            shp::throw_corrupted();
+        }
+
+        return shp::record(m_shp + offset + shp::record_header_size,
+                           std::size_t(length) * shp::word_size);
+    }
+
+    // xmin, ymin, xmax, ymax
+    template <typename Box>
+    static void set_box(Box& box, char const* data)
+    {
+        set_box(box, data, data + 16);
+    }
+
+    template <typename Box>
+    static void set_box(Box& box, char const* min, char const* max)
+    {
+        typedef typename coordinate_type<Box>::type coordinate_type;
+        using detail::shapefile::load_double;
+        set<min_corner, 0>(box, static_cast<coordinate_type>(load_double(min)));
+        set<min_corner, 1>(box, static_cast<coordinate_type>(load_double(min + 8)));
+        set<max_corner, 0>(box, static_cast<coordinate_type>(load_double(max)));
+        set<max_corner, 1>(box, static_cast<coordinate_type>(load_double(max + 8)));
+    }
+
+    boost::interprocess::mapped_region m_shp_region;
+    boost::interprocess::mapped_region m_shx_region;
+    char const* m_shp;
+    std::size_t m_shp_size;
+    char const* m_shx;
+    std::size_t m_count;
+    std::vector<std::size_t> m_offsets;
+    int m_shape_type;
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_EXT_GIS_IO_SHAPEFILE_READ_SHAPEFILE_HPP
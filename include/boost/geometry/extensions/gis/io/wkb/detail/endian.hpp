@@ -2,6 +2,9 @@
 
 // Copyright (c) 2009-2012 Mateusz Loskot, London, UK.
 
+// This file was modified by Oracle on 2019.
+// Modifications copyright (c) 2019, Oracle and/or its affiliates.
+
 // Use, modification and distribution is subject to the Boost Software License,
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
@@ -25,8 +28,8 @@
 
 #include <boost/config.hpp>
 #include <boost/cstdint.hpp>
+#include <boost/predef/other/endian.h>
 #include <boost/static_assert.hpp>
-#include <boost/detail/endian.hpp>
 #include <boost/type_traits/is_signed.hpp>
 
 #if CHAR_BIT != 8
@@ -46,7 +49,7 @@ namespace detail { namespace endian
 struct big_endian_tag {};
 struct little_endian_tag {};
 
-#ifdef BOOST_BIG_ENDIAN
+#if BOOST_ENDIAN_BIG_BYTE
 typedef big_endian_tag native_endian_tag;
 #else
 typedef little_endian_tag native_endian_tag;
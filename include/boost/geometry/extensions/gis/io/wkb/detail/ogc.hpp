@@ -2,6 +2,9 @@
 
 // Copyright (c) 2009-2012 Mateusz Loskot, London, UK.
 
+// This file was modified by Oracle on 2019.
+// Modifications copyright (c) 2019, Oracle and/or its affiliates.
+
 // Use, modification and distribution is subject to the Boost Software License,
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
@@ -97,6 +100,14 @@ struct geometry_type_ewkt
     };
 };
 
+// Flags set in the geometry type of PostGIS extended WKB (EWKB)
+struct ewkb_flag
+{
+    static const boost::uint32_t z = 0x80000000;
+    static const boost::uint32_t m = 0x40000000;
+    static const boost::uint32_t srid = 0x20000000;
+};
+
 struct ogc_policy
 {
 };
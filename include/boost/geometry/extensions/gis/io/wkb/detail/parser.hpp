@@ -2,6 +2,9 @@
 
 // Copyright (c) 2009-2012 Mateusz Loskot, London, UK.
 
+// This file was modified by Oracle on 2019.
+// Modifications copyright (c) 2019, Oracle and/or its affiliates.
+
 // Use, modification and distribution is subject to the Boost Software License,
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
@@ -12,6 +15,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <limits>
 
@@ -22,6 +26,10 @@
 #include <boost/type_traits/is_integral.hpp>
 #include <boost/type_traits/is_same.hpp>
 #include <boost/static_assert.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/value_type.hpp>
 
 #include <boost/geometry/core/access.hpp>
 #include <boost/geometry/core/assert.hpp>
@@ -29,8 +37,12 @@
 #include <boost/geometry/core/coordinate_type.hpp>
 #include <boost/geometry/core/exterior_ring.hpp>
 #include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/interior_type.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/ring_type.hpp>
 #include <boost/geometry/extensions/gis/io/wkb/detail/endian.hpp>
 #include <boost/geometry/extensions/gis/io/wkb/detail/ogc.hpp>
+#include <boost/geometry/util/range.hpp>
 
 namespace boost { namespace geometry
 {
@@ -120,63 +132,192 @@ struct byte_order_parser
     }
 };
 
+/*!
+\brief Internal, type of a geometry stored in WKB
+\details Besides OGC WKB the dimensions of ISO WKB (the type increased by
+    1000 for Z, 2000 for M and 3000 for ZM) and the flags of PostGIS EWKB
+    (Z, M and SRID) are decoded.
+*/
+struct geometry_header
+{
+    geometry_header()
+        : type(0)
+        , has_z(false)
+        , has_m(false)
+        , has_srid(false)
+        , srid(0)
+    {}
+
+    void decode(boost::uint32_t value)
+    {
+        has_z = (value & ewkb_flag::z) != 0;
+        has_m = (value & ewkb_flag::m) != 0;
+        has_srid = (value & ewkb_flag::srid) != 0;
+
+        value &= ~(ewkb_flag::z | ewkb_flag::m | ewkb_flag::srid);
+        boost::uint32_t const iso_dimension = value / 1000;
+        has_z = has_z || iso_dimension == 1 || iso_dimension == 3;
+        has_m = has_m || iso_dimension == 2 || iso_dimension == 3;
+        type = value % 1000;
+    }
+
+    //! Number of coordinates of the stored points
+    std::size_t dimension() const
+    {
+        return 2 + (has_z ? 1 : 0) + (has_m ? 1 : 0);
+    }
+
+    boost::uint32_t type;
+    bool has_z;
+    bool has_m;
+    bool has_srid;
+    boost::uint32_t srid;
+};
+
 template <typename Geometry>
 struct geometry_type_parser
 {
     template <typename Iterator>
-    static bool parse(Iterator& it, Iterator end, 
-                byte_order_type::enum_t order)
+    static bool parse(Iterator& it, Iterator end,
+                byte_order_type::enum_t order,
+                geometry_header& header)
     {
         boost::uint32_t value;
-        if (value_parser<boost::uint32_t>::parse(it, end, value, order))
+        if (! value_parser<boost::uint32_t>::parse(it, end, value, order))
         {
-            return geometry_type<Geometry>::check(value);
+            return false;
         }
-        return false;
+
+        header.decode(value);
+        if (header.has_srid
+            && ! value_parser<boost::uint32_t>::parse(it, end, header.srid, order))
+        {
+            return false;
+        }
+
+        // Stored dimensions different than the dimension of the geometry are
+        // accepted, see point_coordinates_parser
+        return header.type == geometry_type<Geometry>::get() % 1000;
+    }
+
+    template <typename Iterator>
+    static bool parse(Iterator& it, Iterator end,
+                byte_order_type::enum_t order)
+    {
+        geometry_header header;
+        return parse(it, end, order, header);
     }
 };
 
-template <typename P,
-          std::size_t I = 0,
-          std::size_t N = dimension<P>::value>
-struct parsing_assigner
+inline bool is_native(byte_order_type::enum_t order)
+{
+    return order == byte_order_type::unknown
+        || order == (boost::is_same
+                        <
+                            endian::native_endian_tag,
+                            endian::little_endian_tag
+                        >::value ? byte_order_type::ndr : byte_order_type::xdr);
+}
+
+// Loads count coordinates. The caller checks the size of the stream.
+struct coordinates_loader
 {
     template <typename Iterator>
-    static void run(Iterator& it, Iterator end, P& point, 
+    static void apply(Iterator& it, double* values, std::size_t count,
                 byte_order_type::enum_t order)
     {
-        typedef typename coordinate_type<P>::type coordinate_type;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            endian::endian_value<double> parsed_value;
+            if (byte_order_type::xdr == order)
+            {
+                parsed_value.template load<endian::big_endian_tag>(it);
+            }
+            else if (byte_order_type::ndr == order)
+            {
+                parsed_value.template load<endian::little_endian_tag>(it);
+            }
+            else
+            {
+                parsed_value.template load<endian::native_endian_tag>(it);
+            }
+            values[i] = parsed_value;
+            std::advance(it, sizeof(double));
+        }
+    }
 
-        // coordinate type in WKB is always double
-        double value(0);
-        if (value_parser<double>::parse(it, end, value, order))
+    // Bytes in memory in the native byte order are copied at once
+    template <typename Byte>
+    static void apply(Byte const*& it, double* values, std::size_t count,
+                byte_order_type::enum_t order)
+    {
+        if (is_native(order))
         {
-            // actual coordinate type of point may be different
-            set<I>(point, static_cast<coordinate_type>(value));
+            std::memcpy(values, it, count * sizeof(double));
+            it += count * sizeof(double);
         }
         else
         {
-            // TODO: mloskot - Report premature termination at coordinate level
-            //throw failed to read coordinate value
-
-            // default initialized value as fallback
-            set<I>(point, coordinate_type());
+            apply<Byte const*>(it, values, count, order);
         }
-        parsing_assigner<P, I+1, N>::run(it, end, point, order);
+    }
+};
+
+template <typename P,
+          std::size_t I = 0,
+          std::size_t N = dimension<P>::value>
+struct coordinates_assigner
+{
+    static void apply(double const* values, geometry_header const& header,
+                P& point)
+    {
+        typedef typename coordinate_type<P>::type coordinate_type;
+
+        // x and y are always stored, z may be stored. Other coordinates
+        // of the point and the measure are not read.
+        double const value = I < 2 ? values[I]
+                           : I == 2 && header.has_z ? values[2]
+                           : 0;
+
+        // actual coordinate type of point may be different
+        set<I>(point, static_cast<coordinate_type>(value));
+
+        coordinates_assigner<P, I + 1, N>::apply(values, header, point);
     }
 };
 
 template <typename P, std::size_t N>
-struct parsing_assigner<P, N, N>
+struct coordinates_assigner<P, N, N>
+{
+    static void apply(double const* , geometry_header const& , P& )
+    {}
+};
+
+template <typename P>
+struct point_coordinates_parser
 {
+    // The caller checks the size of the stream
     template <typename Iterator>
-    static void run(Iterator& /*it*/, Iterator /*end*/, P& /*point*/,
-                byte_order_type::enum_t /*order*/)
+    static void parse(Iterator& it, P& point,
+                byte_order_type::enum_t order,
+                geometry_header const& header)
     {
-        // terminate
+        // coordinate type in WKB is always double
+        double values[4];
+        coordinates_loader::apply(it, values, header.dimension(), order);
+        coordinates_assigner<P>::apply(values, header, point);
     }
 };
 
+template <typename Iterator>
+inline bool has_bytes(Iterator it, Iterator end, boost::uint32_t count,
+                      std::size_t size)
+{
+    typedef typename std::iterator_traits<Iterator>::difference_type size_type;
+    size_type const bytes = std::distance(it, end);
+    return bytes >= 0 && std::size_t(bytes) / size >= count;
+}
+
 template <typename P>
 struct point_parser
 {
@@ -184,15 +325,15 @@ struct point_parser
     static bool parse(Iterator& it, Iterator end, P& point, 
                 byte_order_type::enum_t order)
     {
-        if (geometry_type_parser<P>::parse(it, end, order))
+        geometry_header header;
+        if (! geometry_type_parser<P>::parse(it, end, order, header)
+            || ! has_bytes(it, end, 1, header.dimension() * sizeof(double)))
         {
-            if (it != end)
-            {
-                parsing_assigner<P>::run(it, end, point, order);
-            }
-            return true;
+            return false;
         }
-        return false;
+
+        point_coordinates_parser<P>::parse(it, point, order, header);
+        return true;
     }
 };
 
@@ -201,46 +342,24 @@ struct point_container_parser
 {
     template <typename Iterator>
     static bool parse(Iterator& it, Iterator end, C& container, 
-                byte_order_type::enum_t order)
+                byte_order_type::enum_t order,
+                geometry_header const& header)
     {
         typedef typename point_type<C>::type point_type;
 
         boost::uint32_t num_points(0);
-        if (!value_parser<boost::uint32_t>::parse(it, end, num_points, order))
+        if (! value_parser<boost::uint32_t>::parse(it, end, num_points, order)
+            || ! has_bytes(it, end, num_points, header.dimension() * sizeof(double)))
         {
             return false;
         }
-        
-        typedef typename std::iterator_traits<Iterator>::difference_type size_type;
-        if(num_points > (std::numeric_limits<boost::uint32_t>::max)() )
-        {
-            throw boost::geometry::read_wkb_exception();
-        }
-
-        size_type const container_size = static_cast<size_type>(num_points);
-        size_type const point_size = dimension<point_type>::value * sizeof(double);
-
-        if (std::distance(it, end) >= (container_size * point_size))
-        {
-            point_type point_buffer;
-
-            // Read coordinates into point and append point to line (ring)
-            size_type points_parsed = 0;
-            while (points_parsed < container_size && it != end)
-            {
-                parsing_assigner<point_type>::run(it, end, point_buffer, order);
-                boost::geometry::append(container, point_buffer);
-                ++points_parsed;
-            }
 
-            if (container_size != points_parsed)
-            {
-                return false;
-            }
-        }
-        else
+        // Points are read in place, the memory of the container is reused
+        range::resize(container, num_points);
+        for (typename boost::range_iterator<C>::type pit = boost::begin(container);
+             pit != boost::end(container); ++pit)
         {
-            return false;
+            point_coordinates_parser<point_type>::parse(it, *pit, order, header);
         }
 
         return true;
@@ -254,17 +373,13 @@ struct linestring_parser
     static bool parse(Iterator& it, Iterator end, L& linestring, 
                 byte_order_type::enum_t order)
     {
-        if (!geometry_type_parser<L>::parse(it, end, order))
+        geometry_header header;
+        if (! geometry_type_parser<L>::parse(it, end, order, header))
         {
             return false;
         }
 
-        if(it == end)
-        {
-            throw boost::geometry::read_wkb_exception();
-        }
-        
-        return point_container_parser<L>::parse(it, end, linestring, order);
+        return point_container_parser<L>::parse(it, end, linestring, order, header);
     }
 };
 
@@ -275,48 +390,135 @@ struct polygon_parser
     static bool parse(Iterator& it, Iterator end, Polygon& polygon, 
                 byte_order_type::enum_t order)
     {
-        if (!geometry_type_parser<Polygon>::parse(it, end, order))
+        geometry_header header;
+        if (! geometry_type_parser<Polygon>::parse(it, end, order, header))
         {
             return false;
         }
 
         boost::uint32_t num_rings(0);
-        if (!value_parser<boost::uint32_t>::parse(it, end, num_rings, order))
+        if (! value_parser<boost::uint32_t>::parse(it, end, num_rings, order)
+            || ! has_bytes(it, end, num_rings, sizeof(boost::uint32_t)))
+        {
+            return false;
+        }
+
+        typedef typename boost::geometry::ring_type<Polygon>::type ring_type;
+
+        if (num_rings == 0)
+        {
+            range::clear(exterior_ring(polygon));
+            range::clear(interior_rings(polygon));
+            return true;
+        }
+
+        if (! point_container_parser<ring_type>::parse(it, end,
+                exterior_ring(polygon), order, header))
         {
             return false;
         }
-        
-        typedef typename boost::geometry::ring_return_type<Polygon>::type ring_type;
 
-        std::size_t rings_parsed = 0;
-        while (rings_parsed < num_rings && it != end)
+        typename interior_return_type<Polygon>::type
+            interiors = interior_rings(polygon);
+        range::resize(interiors, num_rings - 1);
+        for (typename boost::range_iterator
+                <
+                    typename interior_type<Polygon>::type
+                >::type rit = boost::begin(interiors);
+             rit != boost::end(interiors); ++rit)
         {
-            if (0 == rings_parsed)
+            if (! point_container_parser<ring_type>::parse(it, end, *rit, order, header))
             {
-                ring_type ring0 = exterior_ring(polygon);
-                if (!point_container_parser<ring_type>::parse(it, end, ring0, order))
-                {
-                    return false;
-                }
+                return false;
             }
-            else
+        }
+
+        return true;
+    }
+};
+
+// Each part of a multi-geometry is stored with its own byte order and type
+template <typename MultiGeometry, typename Parser>
+struct multi_parser
+{
+    template <typename Iterator>
+    static bool parse(Iterator& it, Iterator end, MultiGeometry& multi,
+                byte_order_type::enum_t order)
+    {
+        if (! geometry_type_parser<MultiGeometry>::parse(it, end, order))
+        {
+            return false;
+        }
+
+        // byte order and type of each part
+        boost::uint32_t num_parts(0);
+        if (! value_parser<boost::uint32_t>::parse(it, end, num_parts, order)
+            || ! has_bytes(it, end, num_parts, 1 + sizeof(boost::uint32_t)))
+        {
+            return false;
+        }
+
+        range::resize(multi, num_parts);
+        for (typename boost::range_iterator<MultiGeometry>::type
+                pit = boost::begin(multi);
+             pit != boost::end(multi); ++pit)
+        {
+            byte_order_type::enum_t part_order;
+            if (! byte_order_parser::parse(it, end, part_order)
+                || ! Parser::parse(it, end, *pit, part_order))
             {
-                boost::geometry::range::resize(interior_rings(polygon), rings_parsed);
-                ring_type ringN = boost::geometry::range::back(interior_rings(polygon));
-                
-                if (!point_container_parser<ring_type>::parse(it, end, ringN, order))
-                {
-                    return false;
-                }
+                return false;
             }
-
-            ++rings_parsed;
         }
 
         return true;
     }
 };
 
+template <typename MultiPoint>
+struct multipoint_parser
+    : multi_parser
+        <
+            MultiPoint,
+            point_parser<typename boost::range_value<MultiPoint>::type>
+        >
+{};
+
+template <typename MultiLinestring>
+struct multilinestring_parser
+    : multi_parser
+        <
+            MultiLinestring,
+            linestring_parser<typename boost::range_value<MultiLinestring>::type>
+        >
+{};
+
+template <typename MultiPolygon>
+struct multipolygon_parser
+    : multi_parser
+        <
+            MultiPolygon,
+            polygon_parser<typename boost::range_value<MultiPolygon>::type>
+        >
+{};
+
+// Reads the SRID of EWKB, 0 if it is not stored
+template <typename Iterator>
+inline bool srid_parser(Iterator it, Iterator end, boost::uint32_t& srid)
+{
+    byte_order_type::enum_t order;
+    boost::uint32_t type;
+    if (! byte_order_parser::parse(it, end, order)
+        || ! value_parser<boost::uint32_t>::parse(it, end, type, order))
+    {
+        return false;
+    }
+
+    srid = 0;
+    return (type & ewkb_flag::srid) == 0
+        || value_parser<boost::uint32_t>::parse(it, end, srid, order);
+}
+
 }} // namespace detail::wkb
 #endif // DOXYGEN_NO_IMPL
 
@@ -2,6 +2,9 @@
 
 // Copyright (c) 2009-2012 Mateusz Loskot, London, UK.
 
+// This file was modified by Oracle on 2019.
+// Modifications copyright (c) 2019, Oracle and/or its affiliates.
+
 // Use, modification and distribution is subject to the Boost Software License,
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
@@ -9,11 +12,14 @@
 #ifndef BOOST_GEOMETRY_IO_WKB_READ_WKB_HPP
 #define BOOST_GEOMETRY_IO_WKB_READ_WKB_HPP
 
+#include <cstddef>
 #include <iterator>
 
+#include <boost/cstdint.hpp>
 #include <boost/type_traits/is_convertible.hpp>
 #include <boost/static_assert.hpp>
 
+#include <boost/geometry/core/tag.hpp>
 #include <boost/geometry/core/tags.hpp>
 #include <boost/geometry/extensions/gis/io/wkb/detail/parser.hpp>
 
@@ -45,7 +51,6 @@ struct read_wkb<linestring_tag, Geometry>
     static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
         detail::wkb::byte_order_type::enum_t order)
     {
-        geometry::clear(geometry);
         return detail::wkb::linestring_parser<Geometry>::parse(it, end, geometry, order);
     }
 };
@@ -57,11 +62,43 @@ struct read_wkb<polygon_tag, Geometry>
     static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
         detail::wkb::byte_order_type::enum_t order)
     {
-        geometry::clear(geometry);
         return detail::wkb::polygon_parser<Geometry>::parse(it, end, geometry, order);
     }
 };
 
+template <typename Geometry>
+struct read_wkb<multi_point_tag, Geometry>
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
+        detail::wkb::byte_order_type::enum_t order)
+    {
+        return detail::wkb::multipoint_parser<Geometry>::parse(it, end, geometry, order);
+    }
+};
+
+template <typename Geometry>
+struct read_wkb<multi_linestring_tag, Geometry>
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
+        detail::wkb::byte_order_type::enum_t order)
+    {
+        return detail::wkb::multilinestring_parser<Geometry>::parse(it, end, geometry, order);
+    }
+};
+
+template <typename Geometry>
+struct read_wkb<multi_polygon_tag, Geometry>
+{
+    template <typename Iterator>
+    static inline bool parse(Iterator& it, Iterator end, Geometry& geometry,
+        detail::wkb::byte_order_type::enum_t order)
+    {
+        return detail::wkb::multipolygon_parser<Geometry>::parse(it, end, geometry, order);
+    }
+};
+
 } // namespace dispatch
 #endif // DOXYGEN_NO_DISPATCH
 
@@ -90,6 +127,19 @@ inline bool read_wkb(Iterator begin, Iterator end, Geometry& geometry)
     return false;
 }
 
+/*!
+\brief Reads a geometry stored in WKB or in PostGIS EWKB with its SRID
+\details The SRID is 0 if it is not stored. Coordinates stored besides x, y
+    and z are skipped, the z coordinate is 0 if it is not stored.
+*/
+template <typename Iterator, typename Geometry>
+inline bool read_wkb(Iterator begin, Iterator end, Geometry& geometry,
+                     boost::uint32_t& srid)
+{
+    return detail::wkb::srid_parser(begin, end, srid)
+        && read_wkb(begin, end, geometry);
+}
+
 template <typename ByteType, typename Geometry>
 inline bool read_wkb(ByteType const* bytes, std::size_t length, Geometry& geometry)
 {
@@ -102,6 +152,64 @@ inline bool read_wkb(ByteType const* bytes, std::size_t length, Geometry& geomet
     return read_wkb(begin, end, geometry);
 }
 
+/*!
+\brief Reads consecutive WKB geometries from a buffer
+\details The geometries are stored one after another, each one starting
+    with its own byte order. Each call of next() reads one geometry directly
+    from the bytes, the same geometry may be passed to all calls so its
+    memory is reused. The buffer may be e.g. a memory mapped file, then
+    only the pages of the geometries being read are loaded.
+*/
+class wkb_reader
+{
+public:
+    wkb_reader(boost::uint8_t const* first, boost::uint8_t const* last)
+        : m_first(first)
+        , m_it(first)
+        , m_last(last)
+    {}
+
+    /*!
+    \brief Reads the next geometry
+    \return false if there are no more geometries
+    \note read_wkb_exception is thrown if the bytes are not a valid
+        geometry of the requested type. Because the size of the invalid
+        record is unknown the reader can't continue after that.
+    */
+    template <typename Geometry>
+    bool next(Geometry& geometry)
+    {
+        if (m_it == m_last)
+        {
+            return false;
+        }
+
+        detail::wkb::byte_order_type::enum_t byte_order;
+        if (! detail::wkb::byte_order_parser::parse(m_it, m_last, byte_order)
+         || ! dispatch::read_wkb
+                <
+                    typename tag<Geometry>::type,
+                    Geometry
+                >::parse(m_it, m_last, geometry, byte_order))
+        {
+            throw read_wkb_exception();
+        }
+
+        return true;
+    }
+
+    //! Offset of the next geometry in the buffer
+    std::size_t offset() const
+    {
+        return static_cast<std::size_t>(m_it - m_first);
+    }
+
+private:
+    boost::uint8_t const* m_first;
+    boost::uint8_t const* m_it;
+    boost::uint8_t const* m_last;
+};
+
 
 }} // namespace boost::geometry
 
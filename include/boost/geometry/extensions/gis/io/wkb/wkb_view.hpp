@@ -0,0 +1,849 @@
+// Boost.Geometry
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKB_WKB_VIEW_HPP
+#define BOOST_GEOMETRY_IO_WKB_WKB_VIEW_HPP
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/mpl/int.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_system.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/extensions/gis/io/wkb/detail/ogc.hpp>
+#include <boost/geometry/extensions/gis/io/wkb/detail/parser.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+// Geometry or part of a multi-geometry stored in a buffer. Data points
+// to the first value after the type and the SRID.
+struct view_header
+{
+    view_header()
+        : data(0)
+        , order(byte_order_type::unknown)
+        , stride(2 * sizeof(double))
+    {}
+
+    boost::uint8_t const* data;
+    byte_order_type::enum_t order;
+    std::size_t stride; // size of a point
+};
+
+inline double load_double(boost::uint8_t const* it, byte_order_type::enum_t order)
+{
+    double value;
+    coordinates_loader::apply(it, &value, 1, order);
+    return value;
+}
+
+inline boost::uint32_t load_uint32(boost::uint8_t const* it, byte_order_type::enum_t order)
+{
+    boost::uint32_t value = 0;
+    value_parser<boost::uint32_t>::parse(it, it + sizeof(boost::uint32_t), value, order);
+    return value;
+}
+
+// Parses the byte order, the type and the SRID, last is 0 if the bytes
+// were already checked
+inline bool parse_view_header(boost::uint8_t const*& it, boost::uint8_t const* last,
+                              boost::uint32_t type, view_header& header)
+{
+    if (last != 0 && ! has_bytes(it, last, 1, 1 + sizeof(boost::uint32_t)))
+    {
+        return false;
+    }
+    if (*it != byte_order_type::xdr && *it != byte_order_type::ndr)
+    {
+        return false;
+    }
+    byte_order_type::enum_t const order = byte_order_type::enum_t(*it);
+    ++it;
+
+    geometry_header geometry;
+    geometry.decode(load_uint32(it, order));
+    it += sizeof(boost::uint32_t);
+    if (geometry.type != type)
+    {
+        return false;
+    }
+
+    if (geometry.has_srid)
+    {
+        if (last != 0 && ! has_bytes(it, last, 1, sizeof(boost::uint32_t)))
+        {
+            return false;
+        }
+        it += sizeof(boost::uint32_t);
+    }
+
+    header.data = it;
+    header.order = order;
+    header.stride = geometry.dimension() * sizeof(double);
+    return true;
+}
+
+// Moves past the number of points and the points, last is 0 if the
+// bytes were already checked
+inline bool skip_points(boost::uint8_t const*& it, boost::uint8_t const* last,
+                        view_header const& header)
+{
+    if (last != 0 && ! has_bytes(it, last, 1, sizeof(boost::uint32_t)))
+    {
+        return false;
+    }
+    boost::uint32_t const count = load_uint32(it, header.order);
+    it += sizeof(boost::uint32_t);
+    if (last != 0 && ! has_bytes(it, last, count, header.stride))
+    {
+        return false;
+    }
+    it += count * header.stride;
+    return true;
+}
+
+inline bool skip_rings(boost::uint8_t const*& it, boost::uint8_t const* last,
+                       view_header const& header)
+{
+    if (last != 0 && ! has_bytes(it, last, 1, sizeof(boost::uint32_t)))
+    {
+        return false;
+    }
+    boost::uint32_t const count = load_uint32(it, header.order);
+    it += sizeof(boost::uint32_t);
+    for (boost::uint32_t i = 0; i < count; ++i)
+    {
+        if (! skip_points(it, last, header))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename Point>
+class point_view_iterator
+    : public boost::iterator_facade
+        <
+            point_view_iterator<Point>,
+            Point, // value type
+            boost::random_access_traversal_tag,
+            Point // reference type
+        >
+{
+public:
+    typedef std::ptrdiff_t difference_type;
+
+    point_view_iterator()
+        : m_it(0)
+        , m_order(byte_order_type::unknown)
+        , m_stride(0)
+    {}
+
+    point_view_iterator(boost::uint8_t const* it, view_header const& header)
+        : m_it(it)
+        , m_order(header.order)
+        , m_stride(header.stride)
+    {}
+
+private:
+    friend class boost::iterator_core_access;
+
+    inline Point dereference() const
+    {
+        return Point(m_it, m_order);
+    }
+
+    inline void increment() { m_it += m_stride; }
+    inline void decrement() { m_it -= m_stride; }
+    inline void advance(difference_type n) { m_it += n * difference_type(m_stride); }
+
+    inline difference_type distance_to(point_view_iterator const& other) const
+    {
+        return (other.m_it - m_it) / difference_type(m_stride);
+    }
+
+    inline bool equal(point_view_iterator const& other) const
+    {
+        return m_it == other.m_it;
+    }
+
+    boost::uint8_t const* m_it;
+    byte_order_type::enum_t m_order;
+    std::size_t m_stride;
+};
+
+// Points stored after their number
+template <typename Point>
+class points_view
+{
+public:
+    typedef point_view_iterator<Point> iterator;
+    typedef point_view_iterator<Point> const_iterator;
+
+    points_view()
+        : m_count(0)
+    {}
+
+    // The number of points is stored at header.data
+    explicit points_view(view_header const& header)
+        : m_header(header)
+        , m_count(load_uint32(header.data, header.order))
+    {
+        m_header.data += sizeof(boost::uint32_t);
+    }
+
+    // The first point is stored at header.data
+    points_view(view_header const& header, std::size_t count)
+        : m_header(header)
+        , m_count(count)
+    {}
+
+    const_iterator begin() const
+    {
+        return const_iterator(m_header.data, m_header);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(m_header.data + m_count * m_header.stride, m_header);
+    }
+
+    std::size_t size() const
+    {
+        return m_count;
+    }
+
+    bool empty() const
+    {
+        return m_count == 0;
+    }
+
+private:
+    view_header m_header;
+    std::size_t m_count;
+};
+
+// Iterates over rings or parts of multi-geometries, which have varying sizes.
+// Random access is required by the concepts but parts can only be found
+// going forward, so moving backward starts again from the first part.
+template <typename Part, typename Access>
+class part_view_iterator
+    : public boost::iterator_facade
+        <
+            part_view_iterator<Part, Access>,
+            Part, // value type
+            boost::random_access_traversal_tag,
+            Part // reference type
+        >
+{
+public:
+    typedef std::ptrdiff_t difference_type;
+
+    part_view_iterator()
+        : m_index(0)
+    {}
+
+    // The first part or the end, which is not dereferenced so the parts
+    // are not skipped
+    part_view_iterator(view_header const& first, std::size_t index)
+        : m_first(first)
+        , m_header(first)
+        , m_index(index)
+    {}
+
+private:
+    friend class boost::iterator_core_access;
+
+    inline Part dereference() const
+    {
+        return Access::get(m_header);
+    }
+
+    inline void increment()
+    {
+        Access::skip(m_header);
+        ++m_index;
+    }
+
+    inline void decrement()
+    {
+        advance(-1);
+    }
+
+    inline void advance(difference_type n)
+    {
+        if (n < 0)
+        {
+            n += difference_type(m_index);
+            m_header = m_first;
+            m_index = 0;
+        }
+        for (difference_type i = 0; i < n; ++i)
+        {
+            increment();
+        }
+    }
+
+    inline difference_type distance_to(part_view_iterator const& other) const
+    {
+        return difference_type(other.m_index) - difference_type(m_index);
+    }
+
+    inline bool equal(part_view_iterator const& other) const
+    {
+        return m_index == other.m_index;
+    }
+
+    view_header m_first;
+    view_header m_header;
+    std::size_t m_index;
+};
+
+template <typename Part, typename Access>
+class parts_view
+{
+public:
+    typedef part_view_iterator<Part, Access> iterator;
+    typedef part_view_iterator<Part, Access> const_iterator;
+
+    parts_view()
+        : m_count(0)
+    {}
+
+    // The number of parts is stored at header.data
+    explicit parts_view(view_header const& header)
+        : m_header(header)
+        , m_count(load_uint32(header.data, header.order))
+    {
+        m_header.data += sizeof(boost::uint32_t);
+    }
+
+    // The first part is stored at header.data
+    parts_view(view_header const& header, std::size_t count)
+        : m_header(header)
+        , m_count(count)
+    {}
+
+    const_iterator begin() const
+    {
+        return const_iterator(m_header, 0);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(m_header, m_count);
+    }
+
+    std::size_t size() const
+    {
+        return m_count;
+    }
+
+    bool empty() const
+    {
+        return m_count == 0;
+    }
+
+private:
+    view_header m_header;
+    std::size_t m_count;
+};
+
+// Rings of a polygon are stored with the header of the polygon
+template <typename Ring>
+struct ring_access
+{
+    static Ring get(view_header const& header)
+    {
+        return Ring(header);
+    }
+
+    static void skip(view_header& header)
+    {
+        skip_points(header.data, 0, header);
+    }
+};
+
+// Parts of multi-geometries have their own byte order and type
+template <typename Geometry>
+struct geometry_access
+{
+    static Geometry get(view_header const& header)
+    {
+        boost::uint8_t const* it = header.data;
+        view_header part;
+        parse_view_header(it, 0, Geometry::type, part);
+        return Geometry(part);
+    }
+
+    static void skip(view_header& header)
+    {
+        view_header part;
+        parse_view_header(header.data, 0, Geometry::type, part);
+        Geometry::skip_body(header.data, 0, part);
+    }
+
+    static bool check(boost::uint8_t const*& it, boost::uint8_t const* last)
+    {
+        view_header part;
+        return parse_view_header(it, last, Geometry::type, part)
+            && Geometry::skip_body(it, last, part);
+    }
+};
+
+template <typename Part>
+inline bool check_parts(boost::uint8_t const*& it, boost::uint8_t const* last,
+                        view_header const& header)
+{
+    if (! has_bytes(it, last, 1, sizeof(boost::uint32_t)))
+    {
+        return false;
+    }
+    boost::uint32_t const count = load_uint32(it, header.order);
+    it += sizeof(boost::uint32_t);
+    for (boost::uint32_t i = 0; i < count; ++i)
+    {
+        if (! geometry_access<Part>::check(it, last))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline void throw_if_not(bool valid)
+{
+    if (! valid)
+    {
+        throw read_wkb_exception();
+    }
+}
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Point of a geometry stored in WKB, reading its coordinates in place
+\details Only x and y are accessed. Used as the point type of the WKB views.
+*/
+template <typename CoordinateSystem = cs::cartesian>
+class wkb_point
+{
+public:
+    wkb_point()
+        : m_data(0)
+        , m_order(detail::wkb::byte_order_type::unknown)
+    {}
+
+    wkb_point(boost::uint8_t const* data,
+              detail::wkb::byte_order_type::enum_t order)
+        : m_data(data)
+        , m_order(order)
+    {}
+
+    template <std::size_t K>
+    double get() const
+    {
+        return detail::wkb::load_double(m_data + K * sizeof(double), m_order);
+    }
+
+private:
+    boost::uint8_t const* m_data;
+    detail::wkb::byte_order_type::enum_t m_order;
+};
+
+/*!
+\brief Linestring stored in WKB, used directly by the algorithms
+\details The bytes are checked once by the constructor, which throws
+    read_wkb_exception if they are not a valid linestring. They are not
+    copied and must outlive the view. The SRID of EWKB and coordinates
+    other than x and y are ignored.
+\qbk{
+[heading Example]
+\code
+wkb_linestring_view<> view(&wkb[0], &wkb[0] + wkb.size());
+double const len = boost::geometry::length(view);
+\endcode
+}
+*/
+template <typename CoordinateSystem = cs::cartesian>
+class wkb_linestring_view
+    : public detail::wkb::points_view<wkb_point<CoordinateSystem> >
+{
+    typedef detail::wkb::points_view<wkb_point<CoordinateSystem> > base_type;
+
+public:
+    static const boost::uint32_t type = detail::wkb::geometry_type_ogc::linestring;
+
+    wkb_linestring_view()
+    {}
+
+    wkb_linestring_view(boost::uint8_t const* first, boost::uint8_t const* last)
+        : base_type(check(first, last))
+    {}
+
+    // Header of bytes already checked, used by the multi-geometries
+    explicit wkb_linestring_view(detail::wkb::view_header const& header)
+        : base_type(header)
+    {}
+
+    // Points stored without their number, e.g. in other formats
+    wkb_linestring_view(detail::wkb::view_header const& header, std::size_t count)
+        : base_type(header, count)
+    {}
+
+    static bool skip_body(boost::uint8_t const*& it, boost::uint8_t const* last,
+                          detail::wkb::view_header const& header)
+    {
+        return detail::wkb::skip_points(it, last, header);
+    }
+
+private:
+    static detail::wkb::view_header check(boost::uint8_t const* it,
+                                          boost::uint8_t const* last)
+    {
+        detail::wkb::view_header header;
+        detail::wkb::throw_if_not(
+            detail::wkb::parse_view_header(it, last, type, header)
+            && skip_body(it, last, header));
+        return header;
+    }
+};
+
+/*!
+\brief Ring of a polygon stored in WKB
+*/
+template <typename CoordinateSystem = cs::cartesian, bool ClockWise = true>
+class wkb_ring_view
+    : public detail::wkb::points_view<wkb_point<CoordinateSystem> >
+{
+    typedef detail::wkb::points_view<wkb_point<CoordinateSystem> > base_type;
+
+public:
+    wkb_ring_view()
+    {}
+
+    explicit wkb_ring_view(detail::wkb::view_header const& header)
+        : base_type(header)
+    {}
+
+    wkb_ring_view(detail::wkb::view_header const& header, std::size_t count)
+        : base_type(header, count)
+    {}
+};
+
+/*!
+\brief Polygon stored in WKB, used directly by the algorithms
+\details The bytes are checked once by the constructor, which throws
+    read_wkb_exception if they are not a valid polygon. They are not
+    copied and must outlive the view. The rings are closed, their
+    orientation is defined by ClockWise.
+*/
+template <typename CoordinateSystem = cs::cartesian, bool ClockWise = true>
+class wkb_polygon_view
+{
+public:
+    typedef wkb_ring_view<CoordinateSystem, ClockWise> ring_view_type;
+    typedef detail::wkb::parts_view
+        <
+            ring_view_type, detail::wkb::ring_access<ring_view_type>
+        > interior_view_type;
+
+    static const boost::uint32_t type = detail::wkb::geometry_type_ogc::polygon;
+
+    wkb_polygon_view()
+        : m_num_rings(0)
+    {}
+
+    wkb_polygon_view(boost::uint8_t const* first, boost::uint8_t const* last)
+        : m_header(check(first, last))
+        , m_num_rings(detail::wkb::load_uint32(m_header.data, m_header.order))
+    {
+        m_header.data += sizeof(boost::uint32_t);
+    }
+
+    // Header of bytes already checked, used by the multi-geometries
+    explicit wkb_polygon_view(detail::wkb::view_header const& header)
+        : m_header(header)
+        , m_num_rings(detail::wkb::load_uint32(header.data, header.order))
+    {
+        m_header.data += sizeof(boost::uint32_t);
+    }
+
+    ring_view_type exterior() const
+    {
+        return m_num_rings == 0 ? ring_view_type() : ring_view_type(m_header);
+    }
+
+    interior_view_type interiors() const
+    {
+        if (m_num_rings <= 1)
+        {
+            return interior_view_type();
+        }
+
+        detail::wkb::view_header rings = m_header;
+        detail::wkb::skip_points(rings.data, 0, rings);
+        return interior_view_type(rings, m_num_rings - 1);
+    }
+
+    static bool skip_body(boost::uint8_t const*& it, boost::uint8_t const* last,
+                          detail::wkb::view_header const& header)
+    {
+        return detail::wkb::skip_rings(it, last, header);
+    }
+
+private:
+    static detail::wkb::view_header check(boost::uint8_t const* it,
+                                          boost::uint8_t const* last)
+    {
+        detail::wkb::view_header header;
+        detail::wkb::throw_if_not(
+            detail::wkb::parse_view_header(it, last, type, header)
+            && skip_body(it, last, header));
+        return header;
+    }
+
+    // The exterior ring is stored at m_header.data
+    detail::wkb::view_header m_header;
+    std::size_t m_num_rings;
+};
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkb
+{
+
+template <typename Part>
+class multi_view
+    : public parts_view<Part, geometry_access<Part> >
+{
+    typedef parts_view<Part, geometry_access<Part> > base_type;
+
+public:
+    multi_view()
+    {}
+
+    explicit multi_view(view_header const& header)
+        : base_type(header)
+    {}
+
+protected:
+    static view_header check(boost::uint8_t const* it, boost::uint8_t const* last,
+                             boost::uint32_t type)
+    {
+        view_header header;
+        throw_if_not(parse_view_header(it, last, type, header)
+                     && check_parts<Part>(it, last, header));
+        return header;
+    }
+};
+
+}} // namespace detail::wkb
+#endif // DOXYGEN_NO_DETAIL
+
+/*!
+\brief Multi-linestring stored in WKB, used directly by the algorithms
+\details The bytes are checked once by the constructor, which throws
+    read_wkb_exception if they are not a valid multi-linestring.
+*/
+template <typename CoordinateSystem = cs::cartesian>
+class wkb_multi_linestring_view
+    : public detail::wkb::multi_view<wkb_linestring_view<CoordinateSystem> >
+{
+    typedef detail::wkb::multi_view<wkb_linestring_view<CoordinateSystem> > base_type;
+
+public:
+    static const boost::uint32_t type = detail::wkb::geometry_type_ogc::multilinestring;
+
+    wkb_multi_linestring_view()
+    {}
+
+    wkb_multi_linestring_view(boost::uint8_t const* first, boost::uint8_t const* last)
+        : base_type(base_type::check(first, last, type))
+    {}
+};
+
+/*!
+\brief Multi-polygon stored in WKB, used directly by the algorithms
+\details The bytes are checked once by the constructor, which throws
+    read_wkb_exception if they are not a valid multi-polygon. The
+    polygons are iterated forward, each one is found after the previous
+    one.
+*/
+template <typename CoordinateSystem = cs::cartesian, bool ClockWise = true>
+class wkb_multi_polygon_view
+    : public detail::wkb::multi_view<wkb_polygon_view<CoordinateSystem, ClockWise> >
+{
+    typedef detail::wkb::multi_view
+        <
+            wkb_polygon_view<CoordinateSystem, ClockWise>
+        > base_type;
+
+public:
+    static const boost::uint32_t type = detail::wkb::geometry_type_ogc::multipolygon;
+
+    wkb_multi_polygon_view()
+    {}
+
+    wkb_multi_polygon_view(boost::uint8_t const* first, boost::uint8_t const* last)
+        : base_type(base_type::check(first, last, type))
+    {}
+};
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename CoordinateSystem>
+struct tag<wkb_point<CoordinateSystem> >
+{
+    typedef point_tag type;
+};
+
+template <typename CoordinateSystem>
+struct coordinate_type<wkb_point<CoordinateSystem> >
+{
+    typedef double type;
+};
+
+template <typename CoordinateSystem>
+struct coordinate_system<wkb_point<CoordinateSystem> >
+{
+    typedef CoordinateSystem type;
+};
+
+template <typename CoordinateSystem>
+struct dimension<wkb_point<CoordinateSystem> >
+    : boost::mpl::int_<2>
+{};
+
+template <typename CoordinateSystem, std::size_t Dimension>
+struct access<wkb_point<CoordinateSystem>, Dimension>
+{
+    static inline double get(wkb_point<CoordinateSystem> const& p)
+    {
+        return p.template get<Dimension>();
+    }
+};
+
+template <typename CoordinateSystem>
+struct tag<wkb_linestring_view<CoordinateSystem> >
+{
+    typedef linestring_tag type;
+};
+
+template <typename CoordinateSystem, bool ClockWise>
+struct tag<wkb_ring_view<CoordinateSystem, ClockWise> >
+{
+    typedef ring_tag type;
+};
+
+template <typename CoordinateSystem, bool ClockWise>
+struct point_order<wkb_ring_view<CoordinateSystem, ClockWise> >
+{
+    static const order_selector value = ClockWise ? clockwise : counterclockwise;
+};
+
+template <typename CoordinateSystem, bool ClockWise>
+struct closure<wkb_ring_view<CoordinateSystem, ClockWise> >
+{
+    static const closure_selector value = closed;
+};
+
+template <typename CoordinateSystem, bool ClockWise>
+struct tag<wkb_polygon_view<CoordinateSystem, ClockWise> >
+{
+    typedef polygon_tag type;
+};
+
+template <typename CoordinateSystem, bool ClockWise>
+struct ring_const_type<wkb_polygon_view<CoordinateSystem, ClockWise> >
+{
+    typedef typename wkb_polygon_view<CoordinateSystem, ClockWise>::ring_view_type type;
+};
+
+template <typename CoordinateSystem, bool ClockWise>
+struct ring_mutable_type<wkb_polygon_view<CoordinateSystem, ClockWise> >
+{
+    typedef typename wkb_polygon_view<CoordinateSystem, ClockWise>::ring_view_type type;
+};
+
+template <typename CoordinateSystem, bool ClockWise>
+struct interior_const_type<wkb_polygon_view<CoordinateSystem, ClockWise> >
+{
+    typedef typename wkb_polygon_view<CoordinateSystem, ClockWise>::interior_view_type type;
+};
+
+template <typename CoordinateSystem, bool ClockWise>
+struct interior_mutable_type<wkb_polygon_view<CoordinateSystem, ClockWise> >
+{
+    typedef typename wkb_polygon_view<CoordinateSystem, ClockWise>::interior_view_type type;
+};
+
+template <typename CoordinateSystem, bool ClockWise>
+struct exterior_ring<wkb_polygon_view<CoordinateSystem, ClockWise> >
+{
+    typedef wkb_polygon_view<CoordinateSystem, ClockWise> polygon_type;
+
+    static inline typename polygon_type::ring_view_type get(polygon_type const& p)
+    {
+        return p.exterior();
+    }
+};
+
+template <typename CoordinateSystem, bool ClockWise>
+struct interior_rings<wkb_polygon_view<CoordinateSystem, ClockWise> >
+{
+    typedef wkb_polygon_view<CoordinateSystem, ClockWise> polygon_type;
+
+    static inline typename polygon_type::interior_view_type get(polygon_type const& p)
+    {
+        return p.interiors();
+    }
+};
+
+template <typename CoordinateSystem>
+struct tag<wkb_multi_linestring_view<CoordinateSystem> >
+{
+    typedef multi_linestring_tag type;
+};
+
+template <typename CoordinateSystem, bool ClockWise>
+struct tag<wkb_multi_polygon_view<CoordinateSystem, ClockWise> >
+{
+    typedef multi_polygon_tag type;
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKB_WKB_VIEW_HPP
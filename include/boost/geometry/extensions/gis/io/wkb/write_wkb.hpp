@@ -2,6 +2,9 @@
 //
 // Copyright (c) 2015 Mats Taraldsvik.
 //
+// This file was modified by Oracle on 2019.
+// Modifications copyright (c) 2019, Oracle and/or its affiliates.
+//
 // Use, modification and distribution is subject to the Boost Software License,
 // Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
 // http://www.boost.org/LICENSE_1_0.txt)
@@ -62,6 +65,39 @@ struct write_wkb<polygon_tag, G>
     }
 };
 
+template <typename Geometry>
+struct write_wkb<multi_point_tag, Geometry>
+{
+    template <typename OutputIterator>
+    static inline bool write(const Geometry& geometry, OutputIterator iter,
+                       detail::wkb::byte_order_type::enum_t byte_order)
+    {
+        return detail::wkb::multipoint_writer<Geometry>::write(geometry, iter, byte_order);
+    }
+};
+
+template <typename Geometry>
+struct write_wkb<multi_linestring_tag, Geometry>
+{
+    template <typename OutputIterator>
+    static inline bool write(const Geometry& geometry, OutputIterator iter,
+                       detail::wkb::byte_order_type::enum_t byte_order)
+    {
+        return detail::wkb::multilinestring_writer<Geometry>::write(geometry, iter, byte_order);
+    }
+};
+
+template <typename Geometry>
+struct write_wkb<multi_polygon_tag, Geometry>
+{
+    template <typename OutputIterator>
+    static inline bool write(const Geometry& geometry, OutputIterator iter,
+                       detail::wkb::byte_order_type::enum_t byte_order)
+    {
+        return detail::wkb::multipolygon_writer<Geometry>::write(geometry, iter, byte_order);
+    }
+};
+
 } // namespace dispatch
 #endif // DOXYGEN_NO_DISPATCH
 
@@ -77,7 +113,7 @@ inline bool write_wkb(const G& geometry, OutputIterator iter)
         >::value));
 
 // Will write in the native byte order
-#ifdef BOOST_BIG_ENDIAN
+#if BOOST_ENDIAN_BIG_BYTE
         detail::wkb::byte_order_type::enum_t byte_order =  detail::wkb::byte_order_type::xdr;
 #else
         detail::wkb::byte_order_type::enum_t byte_order =  detail::wkb::byte_order_type::ndr;
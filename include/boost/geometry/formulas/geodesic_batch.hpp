@@ -0,0 +1,309 @@
+// Boost.Geometry
+
+// Copyright (c) 2019 Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_FORMULAS_GEODESIC_BATCH_HPP
+#define BOOST_GEOMETRY_FORMULAS_GEODESIC_BATCH_HPP
+
+
+#include <cstddef>
+#include <vector>
+
+#include <boost/range.hpp>
+
+#include <boost/geometry/core/assert.hpp>
+
+#include <boost/geometry/formulas/andoyer_inverse.hpp>
+#include <boost/geometry/formulas/result_inverse.hpp>
+#include <boost/geometry/formulas/thomas_inverse.hpp>
+
+
+namespace boost { namespace geometry { namespace formula
+{
+
+template <typename Result>
+struct result_calculation_type
+{};
+
+template <typename CT>
+struct result_calculation_type<result_inverse<CT> >
+{
+    typedef CT type;
+};
+
+
+/*!
+\brief Quantities of one point of the inverse problem which do not depend
+       on the other point, calculated once per point in batches.
+*/
+template <typename Inverse>
+struct inverse_batch_point
+{
+    typedef typename result_calculation_type
+        <
+            typename Inverse::result_type
+        >::type calculation_type;
+
+    template <typename T, typename Spheroid>
+    inline void set(T const& lon_, T const& lat_, Spheroid const& )
+    {
+        lon = lon_;
+        lat = lat_;
+    }
+
+    template <typename Spheroid>
+    static inline typename Inverse::result_type
+    apply(inverse_batch_point const& p1, inverse_batch_point const& p2,
+          Spheroid const& spheroid)
+    {
+        return Inverse::apply(p1.lon, p1.lat, p2.lon, p2.lat, spheroid);
+    }
+
+    calculation_type lon;
+    calculation_type lat;
+};
+
+template
+<
+    typename CT,
+    bool EnableDistance, bool EnableAzimuth, bool EnableReverseAzimuth,
+    bool EnableReducedLength, bool EnableGeodesicScale
+>
+struct inverse_batch_point
+    <
+        andoyer_inverse
+            <
+                CT, EnableDistance, EnableAzimuth, EnableReverseAzimuth,
+                EnableReducedLength, EnableGeodesicScale
+            >
+    >
+{
+    typedef andoyer_inverse
+        <
+            CT, EnableDistance, EnableAzimuth, EnableReverseAzimuth,
+            EnableReducedLength, EnableGeodesicScale
+        > inverse_type;
+
+    template <typename T, typename Spheroid>
+    inline void set(T const& lon_, T const& lat_, Spheroid const& )
+    {
+        lon = lon_;
+        lat = lat_;
+        sin_lat = sin(lat);
+        cos_lat = cos(lat);
+    }
+
+    template <typename Spheroid>
+    static inline typename inverse_type::result_type
+    apply(inverse_batch_point const& p1, inverse_batch_point const& p2,
+          Spheroid const& spheroid)
+    {
+        return inverse_type::apply(p1.lon, p1.lat, p1.sin_lat, p1.cos_lat,
+                                   p2.lon, p2.lat, p2.sin_lat, p2.cos_lat,
+                                   spheroid);
+    }
+
+    CT lon;
+    CT lat;
+    CT sin_lat;
+    CT cos_lat;
+};
+
+template
+<
+    typename CT,
+    bool EnableDistance, bool EnableAzimuth, bool EnableReverseAzimuth,
+    bool EnableReducedLength, bool EnableGeodesicScale
+>
+struct inverse_batch_point
+    <
+        thomas_inverse
+            <
+                CT, EnableDistance, EnableAzimuth, EnableReverseAzimuth,
+                EnableReducedLength, EnableGeodesicScale
+            >
+    >
+{
+    typedef thomas_inverse
+        <
+            CT, EnableDistance, EnableAzimuth, EnableReverseAzimuth,
+            EnableReducedLength, EnableGeodesicScale
+        > inverse_type;
+
+    template <typename T, typename Spheroid>
+    inline void set(T const& lon_, T const& lat_, Spheroid const& spheroid)
+    {
+        lon = lon_;
+        lat = lat_;
+        theta = inverse_type::reduced_latitude(lat, spheroid);
+    }
+
+    template <typename Spheroid>
+    static inline typename inverse_type::result_type
+    apply(inverse_batch_point const& p1, inverse_batch_point const& p2,
+          Spheroid const& spheroid)
+    {
+        return inverse_type::apply(p1.lon, p1.lat, p1.theta,
+                                   p2.lon, p2.lat, p2.theta,
+                                   spheroid);
+    }
+
+    CT lon;
+    CT lat;
+    CT theta;
+};
+
+
+/*!
+\brief Solutions of the inverse problem of geodesics for many pairs of
+       points given as separate ranges of longitudes and latitudes.
+\details The quantities depending on one point only (e.g. the sines and
+       cosines of the latitudes in Andoyer's formula or the reduced
+       latitudes in Thomas' formula) are calculated once per point, so a
+       matrix of N x M results needs N + M of them instead of 2 x N x M.
+\tparam Inverse inverse formula, e.g. andoyer_inverse, thomas_inverse or
+       vincenty_inverse
+*/
+template <typename Inverse>
+class inverse_batch
+{
+    typedef inverse_batch_point<Inverse> point_type;
+
+public:
+    typedef typename Inverse::result_type result_type;
+
+    /*!
+    \brief Writes the results for the pairs of points of the same index
+    \note Coordinates in radians
+    */
+    template
+    <
+        typename Lons1, typename Lats1, typename Lons2, typename Lats2,
+        typename Spheroid, typename OutputIterator
+    >
+    static inline OutputIterator apply(Lons1 const& lons1, Lats1 const& lats1,
+                                       Lons2 const& lons2, Lats2 const& lats2,
+                                       Spheroid const& spheroid,
+                                       OutputIterator out)
+    {
+        BOOST_GEOMETRY_ASSERT(boost::size(lons1) == boost::size(lats1));
+        BOOST_GEOMETRY_ASSERT(boost::size(lons2) == boost::size(lats2));
+        BOOST_GEOMETRY_ASSERT(boost::size(lons1) == boost::size(lons2));
+
+        typename boost::range_iterator<Lons1 const>::type lon1 = boost::begin(lons1);
+        typename boost::range_iterator<Lats1 const>::type lat1 = boost::begin(lats1);
+        typename boost::range_iterator<Lons2 const>::type lon2 = boost::begin(lons2);
+        typename boost::range_iterator<Lats2 const>::type lat2 = boost::begin(lats2);
+
+        point_type p1, p2;
+        for ( ; lon1 != boost::end(lons1) ; ++lon1, ++lat1, ++lon2, ++lat2)
+        {
+            p1.set(*lon1, *lat1, spheroid);
+            p2.set(*lon2, *lat2, spheroid);
+            *out++ = point_type::apply(p1, p2, spheroid);
+        }
+
+        return out;
+    }
+
+    /*!
+    \brief Writes the results for all pairs of points of the first and
+           the second ranges, row by row, i.e. the result for the points i
+           and j is the (i * size(lons2) + j)-th one
+    \note Coordinates in radians
+    */
+    template
+    <
+        typename Lons1, typename Lats1, typename Lons2, typename Lats2,
+        typename Spheroid, typename OutputIterator
+    >
+    static inline OutputIterator apply_matrix(Lons1 const& lons1, Lats1 const& lats1,
+                                              Lons2 const& lons2, Lats2 const& lats2,
+                                              Spheroid const& spheroid,
+                                              OutputIterator out)
+    {
+        BOOST_GEOMETRY_ASSERT(boost::size(lons1) == boost::size(lats1));
+        BOOST_GEOMETRY_ASSERT(boost::size(lons2) == boost::size(lats2));
+
+        std::vector<point_type> points2(boost::size(lons2));
+        {
+            typename boost::range_iterator<Lons2 const>::type lon2 = boost::begin(lons2);
+            typename boost::range_iterator<Lats2 const>::type lat2 = boost::begin(lats2);
+            for (std::size_t j = 0 ; j < points2.size() ; ++j, ++lon2, ++lat2)
+            {
+                points2[j].set(*lon2, *lat2, spheroid);
+            }
+        }
+
+        typename boost::range_iterator<Lons1 const>::type lon1 = boost::begin(lons1);
+        typename boost::range_iterator<Lats1 const>::type lat1 = boost::begin(lats1);
+
+        point_type p1;
+        for ( ; lon1 != boost::end(lons1) ; ++lon1, ++lat1)
+        {
+            p1.set(*lon1, *lat1, spheroid);
+            for (std::size_t j = 0 ; j < points2.size() ; ++j)
+            {
+                *out++ = point_type::apply(p1, points2[j], spheroid);
+            }
+        }
+
+        return out;
+    }
+};
+
+
+/*!
+\brief Solutions of the direct problem of geodesics for many points,
+       distances and azimuths given as separate ranges.
+\tparam Direct direct formula, e.g. vincenty_direct, thomas_direct or
+       karney_direct
+*/
+template <typename Direct>
+class direct_batch
+{
+public:
+    typedef typename Direct::result_type result_type;
+
+    /*!
+    \brief Writes the results for the points, distances and azimuths of
+           the same index
+    \note Coordinates and azimuths in radians
+    */
+    template
+    <
+        typename Lons, typename Lats, typename Distances, typename Azimuths,
+        typename Spheroid, typename OutputIterator
+    >
+    static inline OutputIterator apply(Lons const& lons, Lats const& lats,
+                                       Distances const& distances,
+                                       Azimuths const& azimuths,
+                                       Spheroid const& spheroid,
+                                       OutputIterator out)
+    {
+        BOOST_GEOMETRY_ASSERT(boost::size(lons) == boost::size(lats));
+        BOOST_GEOMETRY_ASSERT(boost::size(lons) == boost::size(distances));
+        BOOST_GEOMETRY_ASSERT(boost::size(lons) == boost::size(azimuths));
+
+        typename boost::range_iterator<Lons const>::type lon = boost::begin(lons);
+        typename boost::range_iterator<Lats const>::type lat = boost::begin(lats);
+        typename boost::range_iterator<Distances const>::type distance = boost::begin(distances);
+        typename boost::range_iterator<Azimuths const>::type azimuth = boost::begin(azimuths);
+
+        for ( ; lon != boost::end(lons) ; ++lon, ++lat, ++distance, ++azimuth)
+        {
+            *out++ = Direct::apply(*lon, *lat, *distance, *azimuth, spheroid);
+        }
+
+        return out;
+    }
+};
+
+}}} // namespace boost::geometry::formula
+
+
+#endif // BOOST_GEOMETRY_FORMULAS_GEODESIC_BATCH_HPP
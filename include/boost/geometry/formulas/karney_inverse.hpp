@@ -0,0 +1,860 @@
+// Boost.Geometry
+
+// Copyright (c) 2019 Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+// This file is converted from GeographicLib, https://geographiclib.sourceforge.io
+// GeographicLib is originally written by Charles Karney.
+
+// Author: Charles Karney (2008-2017)
+
+// Last updated version of GeographicLib: 1.49
+
+// Original copyright notice:
+
+// Copyright (c) Charles Karney (2008-2017) <charles@karney.com> and licensed
+// under the MIT/X11 License. For more information, see
+// https://geographiclib.sourceforge.io
+
+#ifndef BOOST_GEOMETRY_FORMULAS_KARNEY_INVERSE_HPP
+#define BOOST_GEOMETRY_FORMULAS_KARNEY_INVERSE_HPP
+
+
+#include <algorithm>
+#include <limits>
+
+#include <boost/core/ignore_unused.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/special_functions/cbrt.hpp>
+#include <boost/math/special_functions/hypot.hpp>
+#include <boost/static_assert.hpp>
+
+#include <boost/geometry/core/radius.hpp>
+
+#include <boost/geometry/formulas/flattening.hpp>
+#include <boost/geometry/formulas/result_inverse.hpp>
+
+#include <boost/geometry/util/condition.hpp>
+#include <boost/geometry/util/math.hpp>
+#include <boost/geometry/util/normalize_spheroidal_coordinates.hpp>
+#include <boost/geometry/util/series_expansion.hpp>
+
+
+#ifndef BOOST_GEOMETRY_DETAIL_KARNEY_INVERSE_MAX_STEPS
+#define BOOST_GEOMETRY_DETAIL_KARNEY_INVERSE_MAX_STEPS 100
+#endif
+
+#ifndef BOOST_GEOMETRY_DETAIL_KARNEY_INVERSE_NEWTON_STEPS
+#define BOOST_GEOMETRY_DETAIL_KARNEY_INVERSE_NEWTON_STEPS 20
+#endif
+
+
+namespace boost { namespace geometry { namespace formula
+{
+
+namespace se = series_expansion;
+
+/*!
+\brief The solution of the inverse problem of geodesics on latlong coordinates,
+       after Karney (2011).
+\details Newton's method is used to find the azimuth at the first point,
+       falling back to bisection if it does not converge. The number of
+       iterations is bounded by BOOST_GEOMETRY_DETAIL_KARNEY_INVERSE_MAX_STEPS.
+       The accuracy, and the cost of each iteration, is controlled by the
+       order of the series expansions (SeriesOrder, from 2 to 8).
+\author See
+- Charles F.F Karney, Algorithms for geodesics, 2011
+https://arxiv.org/pdf/1109.4448.pdf
+*/
+template <
+    typename CT,
+    bool EnableDistance,
+    bool EnableAzimuth,
+    bool EnableReverseAzimuth = false,
+    bool EnableReducedLength = false,
+    bool EnableGeodesicScale = false,
+    size_t SeriesOrder = 8
+>
+class karney_inverse
+{
+    static const bool CalcQuantities = EnableReducedLength || EnableGeodesicScale;
+    static const bool CalcDistance = EnableDistance || CalcQuantities;
+
+    BOOST_STATIC_ASSERT(SeriesOrder >= 2 && SeriesOrder <= 8);
+
+public:
+    typedef result_inverse<CT> result_type;
+
+    template <typename T1, typename T2, typename Spheroid>
+    static inline result_type apply(T1 const& lo1,
+                                    T1 const& la1,
+                                    T2 const& lo2,
+                                    T2 const& la2,
+                                    Spheroid const& spheroid)
+    {
+        result_type result;
+
+        // coordinates in radians, the calculations are done in degrees
+        CT const r2d = math::r2d<CT>();
+        CT const lon1 = lo1 * r2d;
+        CT lat1 = la1 * r2d;
+        CT const lon2 = lo2 * r2d;
+        CT lat2 = la2 * r2d;
+
+        CT const c0 = 0;
+        CT const c1 = 1;
+        CT const c2 = 2;
+        CT const c90 = 90;
+        CT const c180 = 180;
+        CT const pi = math::pi<CT>();
+        CT const tiny = math::sqrt((std::numeric_limits<CT>::min)());
+        CT const tol0 = std::numeric_limits<CT>::epsilon();
+        CT const tol2 = math::sqrt(tol0);
+        CT const tolb = tol0 * tol2;
+
+        int const max_steps = BOOST_GEOMETRY_DETAIL_KARNEY_INVERSE_MAX_STEPS;
+        int const newton_steps = (std::min)(max_steps,
+                                    int(BOOST_GEOMETRY_DETAIL_KARNEY_INVERSE_NEWTON_STEPS));
+
+        constants const c(spheroid);
+
+        // Compute the longitude difference carefully. The result is
+        // in [-180, 180], -180 only for west-going geodesics.
+        CT lon12s;
+        CT lon12 = angle_diff(lon1, lon2, lon12s);
+
+        // Make the longitude difference positive.
+        int lonsign = lon12 >= c0 ? 1 : -1;
+
+        // If very close to being on the same half-meridian, then make it so.
+        lon12 = lonsign * math::round_angle(lon12);
+        lon12s = math::round_angle((c180 - lon12) - lonsign * lon12s);
+
+        CT const lam12 = lon12 * math::d2r<CT>();
+        CT sin_lam12, cos_lam12;
+        if (lon12 > c90)
+        {
+            math::sin_cos_degrees(lon12s, sin_lam12, cos_lam12);
+            cos_lam12 = -cos_lam12;
+        }
+        else
+        {
+            math::sin_cos_degrees(lon12, sin_lam12, cos_lam12);
+        }
+
+        // If really close to the equator, treat as on equator.
+        lat1 = math::round_angle(lat1);
+        lat2 = math::round_angle(lat2);
+
+        // Swap the points so that the point with the higher (absolute)
+        // latitude is the first one.
+        int const swap_point = math::abs(lat1) < math::abs(lat2) ? -1 : 1;
+        if (swap_point < 0)
+        {
+            lonsign *= -1;
+            std::swap(lat1, lat2);
+        }
+
+        // Make lat1 <= 0.
+        int const latsign = lat1 < c0 ? 1 : -1;
+        lat1 *= latsign;
+        lat2 *= latsign;
+
+        // Now 0 <= lon12 <= 180, -90 <= lat1 <= 0 and lat1 <= lat2 <= -lat1.
+        // lonsign, swap_point and latsign register the transformation.
+
+        CT sin_beta1, cos_beta1;
+        math::sin_cos_degrees(lat1, sin_beta1, cos_beta1);
+        sin_beta1 *= c.one_minus_f;
+        math::normalize_unit_vector<CT>(sin_beta1, cos_beta1);
+        cos_beta1 = (std::max)(tiny, cos_beta1);
+
+        CT sin_beta2, cos_beta2;
+        math::sin_cos_degrees(lat2, sin_beta2, cos_beta2);
+        sin_beta2 *= c.one_minus_f;
+        math::normalize_unit_vector<CT>(sin_beta2, cos_beta2);
+        cos_beta2 = (std::max)(tiny, cos_beta2);
+
+        // If the latitudes are equal or opposite, force it exactly.
+        if (cos_beta1 < -sin_beta1)
+        {
+            if (cos_beta2 == cos_beta1)
+            {
+                sin_beta2 = sin_beta2 < c0 ? sin_beta1 : -sin_beta1;
+            }
+        }
+        else
+        {
+            if (math::abs(sin_beta2) == -sin_beta1)
+            {
+                cos_beta2 = cos_beta1;
+            }
+        }
+
+        CT const dn1 = math::sqrt(c1 + c.ep2 * math::sqr(sin_beta1));
+        CT const dn2 = math::sqrt(c1 + c.ep2 * math::sqr(sin_beta2));
+
+        CT sin_alpha1 = c0, cos_alpha1 = c1;
+        CT sin_alpha2 = c0, cos_alpha2 = c1;
+        CT sigma12 = c0;
+        lengths_type lengths;
+
+        bool meridian = lat1 == -c90 || sin_lam12 == c0;
+
+        if (meridian)
+        {
+            // The endpoints are on a single full meridian, so the geodesic
+            // might lie on a meridian.
+            cos_alpha1 = cos_lam12;
+            sin_alpha1 = sin_lam12; // Head to the target longitude.
+            cos_alpha2 = c1;
+            sin_alpha2 = c0; // At the target we are heading north.
+
+            // tan(beta) = tan(sigma) * cos(alpha)
+            CT const sin_sigma1 = sin_beta1;
+            CT const cos_sigma1 = cos_alpha1 * cos_beta1;
+            CT const sin_sigma2 = sin_beta2;
+            CT const cos_sigma2 = cos_alpha2 * cos_beta2;
+
+            sigma12 = atan2((std::max)(c0, cos_sigma1 * sin_sigma2 - sin_sigma1 * cos_sigma2),
+                            cos_sigma1 * cos_sigma2 + sin_sigma1 * sin_sigma2);
+
+            lengths = calculate_lengths<true, true>(c.n, sigma12,
+                                                    sin_sigma1, cos_sigma1, dn1,
+                                                    sin_sigma2, cos_sigma2, dn2,
+                                                    cos_beta1, cos_beta2, c.ep2);
+
+            // sigma12 > pi/2 for a meridional geodesic which is not
+            // a shortest path.
+            if (sigma12 < c1 || lengths.m12b >= c0)
+            {
+                if (sigma12 < CT(3) * tiny)
+                {
+                    sigma12 = lengths.m12b = lengths.s12b = c0;
+                }
+            }
+            else
+            {
+                // m12 < 0, i.e. prolate and too close to anti-podal.
+                meridian = false;
+            }
+        }
+
+        if (! meridian
+         && sin_beta1 == c0 // and sin_beta2 == 0
+         && (c.f <= c0 || lon12s >= c.f * c180))
+        {
+            // The geodesic runs along the equator.
+            cos_alpha1 = cos_alpha2 = c0;
+            sin_alpha1 = sin_alpha2 = c1;
+
+            sigma12 = lam12 / c.one_minus_f;
+            lengths.s12b = c.a * lam12 / c.b;
+            lengths.m12b = sin(sigma12);
+            lengths.M12 = lengths.M21 = cos(sigma12);
+        }
+        else if (! meridian)
+        {
+            // The points lie within a hemisphere bounded by a meridian and
+            // the geodesic is neither meridional nor equatorial.
+
+            // Find the starting point for Newton's method.
+            CT dnm = c1;
+            sigma12 = newton_start(sin_beta1, cos_beta1, dn1,
+                                   sin_beta2, cos_beta2, dn2,
+                                   lam12, sin_lam12, cos_lam12,
+                                   sin_alpha1, cos_alpha1,
+                                   sin_alpha2, cos_alpha2,
+                                   dnm, c);
+
+            if (sigma12 >= c0)
+            {
+                // Short lines, newton_start sets sin_alpha2, cos_alpha2, dnm.
+                lengths.s12b = sigma12 * dnm;
+                lengths.m12b = math::sqr(dnm) * sin(sigma12 / dnm);
+                lengths.M12 = lengths.M21 = cos(sigma12 / dnm);
+            }
+            else
+            {
+                // Newton's method, solving lambda12(alpha1) - lam12 = 0.
+                // The root is bracketed by (alpha1a, alpha1b), the bracket is
+                // shrunk with each evaluation and its midpoint is used if
+                // the derivative is not positive or the Newton step leaves
+                // the bracket.
+                CT sin_sigma1 = c0, cos_sigma1 = c0;
+                CT sin_sigma2 = c0, cos_sigma2 = c0;
+                CT eps = c0;
+
+                // Bracketing range.
+                CT sin_alpha1a = tiny, cos_alpha1a = c1;
+                CT sin_alpha1b = tiny, cos_alpha1b = -c1;
+
+                bool tripn = false;
+                bool tripb = false;
+                for (int step = 0; step < max_steps; ++step)
+                {
+                    CT dv = c0;
+                    CT const v = lambda12(sin_beta1, cos_beta1, dn1,
+                                          sin_beta2, cos_beta2, dn2,
+                                          sin_alpha1, cos_alpha1,
+                                          sin_lam12, cos_lam12,
+                                          sin_alpha2, cos_alpha2, sigma12,
+                                          sin_sigma1, cos_sigma1,
+                                          sin_sigma2, cos_sigma2,
+                                          eps, step < newton_steps, dv, c);
+
+                    // Reversed test to allow escape with NaNs.
+                    if (tripb || ! (math::abs(v) >= (tripn ? CT(8) : c1) * tol0))
+                    {
+                        break;
+                    }
+
+                    // Update the bracketing values.
+                    if (v > c0 && (step > newton_steps
+                                   || cos_alpha1 / sin_alpha1 > cos_alpha1b / sin_alpha1b))
+                    {
+                        sin_alpha1b = sin_alpha1;
+                        cos_alpha1b = cos_alpha1;
+                    }
+                    else if (v < c0 && (step > newton_steps
+                                        || cos_alpha1 / sin_alpha1 < cos_alpha1a / sin_alpha1a))
+                    {
+                        sin_alpha1a = sin_alpha1;
+                        cos_alpha1a = cos_alpha1;
+                    }
+
+                    if (step < newton_steps && dv > c0)
+                    {
+                        CT const dalpha1 = -v / dv;
+                        CT const sin_dalpha1 = sin(dalpha1);
+                        CT const cos_dalpha1 = cos(dalpha1);
+                        CT const nsin_alpha1 = sin_alpha1 * cos_dalpha1
+                                             + cos_alpha1 * sin_dalpha1;
+
+                        if (nsin_alpha1 > c0 && math::abs(dalpha1) < pi)
+                        {
+                            cos_alpha1 = cos_alpha1 * cos_dalpha1
+                                       - sin_alpha1 * sin_dalpha1;
+                            sin_alpha1 = nsin_alpha1;
+                            math::normalize_unit_vector<CT>(sin_alpha1, cos_alpha1);
+
+                            // The slope may go to 0, so the convergence is
+                            // based on epsilon instead of sqrt(epsilon).
+                            tripn = math::abs(v) <= CT(16) * tol0;
+                            continue;
+                        }
+                    }
+
+                    // Use the midpoint of the bracket as the next estimate.
+                    sin_alpha1 = (sin_alpha1a + sin_alpha1b) / c2;
+                    cos_alpha1 = (cos_alpha1a + cos_alpha1b) / c2;
+                    math::normalize_unit_vector<CT>(sin_alpha1, cos_alpha1);
+                    tripn = false;
+                    tripb = (math::abs(sin_alpha1a - sin_alpha1)
+                             + (cos_alpha1a - cos_alpha1) < tolb
+                          || math::abs(sin_alpha1 - sin_alpha1b)
+                             + (cos_alpha1 - cos_alpha1b) < tolb);
+                }
+
+                lengths = calculate_lengths<CalcDistance, CalcQuantities>(eps, sigma12,
+                                                    sin_sigma1, cos_sigma1, dn1,
+                                                    sin_sigma2, cos_sigma2, dn2,
+                                                    cos_beta1, cos_beta2, c.ep2);
+            }
+        }
+
+        if (BOOST_GEOMETRY_CONDITION(EnableDistance))
+        {
+            result.distance = c0 + lengths.s12b * c.b; // Convert -0 to 0
+        }
+
+        if (BOOST_GEOMETRY_CONDITION(EnableReducedLength))
+        {
+            result.reduced_length = c0 + lengths.m12b * c.b; // Convert -0 to 0
+        }
+
+        // Convert the sines and cosines to azimuths accounting for
+        // lonsign, swap_point and latsign.
+        if (swap_point < 0)
+        {
+            std::swap(sin_alpha1, sin_alpha2);
+            std::swap(cos_alpha1, cos_alpha2);
+            std::swap(lengths.M12, lengths.M21);
+        }
+
+        if (BOOST_GEOMETRY_CONDITION(EnableGeodesicScale))
+        {
+            result.geodesic_scale = lengths.M12;
+        }
+
+        sin_alpha1 *= swap_point * lonsign;
+        cos_alpha1 *= swap_point * latsign;
+        sin_alpha2 *= swap_point * lonsign;
+        cos_alpha2 *= swap_point * latsign;
+
+        if (BOOST_GEOMETRY_CONDITION(EnableAzimuth))
+        {
+            result.azimuth = atan2(sin_alpha1, cos_alpha1);
+        }
+
+        if (BOOST_GEOMETRY_CONDITION(EnableReverseAzimuth))
+        {
+            result.reverse_azimuth = atan2(sin_alpha2, cos_alpha2);
+        }
+
+        return result;
+    }
+
+private:
+    struct constants
+    {
+        template <typename Spheroid>
+        explicit constants(Spheroid const& spheroid)
+        {
+            a = CT(get_radius<0>(spheroid));
+            b = CT(get_radius<2>(spheroid));
+            f = formula::flattening<CT>(spheroid);
+            one_minus_f = CT(1) - f;
+            CT const two_minus_f = CT(2) - f;
+            n = f / two_minus_f;
+            e2 = f * two_minus_f;
+            ep2 = e2 / math::sqr(one_minus_f);
+
+            CT const tol2 = math::sqrt(std::numeric_limits<CT>::epsilon());
+            etol2 = CT(0.1) * tol2
+                  / math::sqrt((std::max)(CT(0.001), math::abs(f))
+                               * (std::min)(CT(1), CT(1) - f / CT(2)) / CT(2));
+        }
+
+        CT a, b, f, one_minus_f, n, e2, ep2, etol2;
+    };
+
+    struct lengths_type
+    {
+        lengths_type()
+            : s12b(0), m12b(0), m0(0), M12(1), M21(1)
+        {}
+
+        CT s12b; // distance / b
+        CT m12b; // reduced length / b
+        CT m0; // coefficient of the secular term of the reduced length
+        CT M12;
+        CT M21;
+    };
+
+    template <bool Distance, bool Quantities>
+    static inline lengths_type calculate_lengths(CT const& eps, CT const& sigma12,
+                                                 CT const& sin_sigma1, CT const& cos_sigma1,
+                                                 CT const& dn1,
+                                                 CT const& sin_sigma2, CT const& cos_sigma2,
+                                                 CT const& dn2,
+                                                 CT const& cos_beta1, CT const& cos_beta2,
+                                                 CT const& ep2)
+    {
+        CT const c1 = 1;
+
+        lengths_type result;
+
+        CT const A1m1 = se::evaluate_A1<SeriesOrder>(eps);
+        se::coeffs_C1<SeriesOrder, CT> const coeffs_C1(eps);
+        CT const A1 = c1 + A1m1;
+
+        CT const B1 = se::sin_cos_series(sin_sigma2, cos_sigma2, coeffs_C1)
+                    - se::sin_cos_series(sin_sigma1, cos_sigma1, coeffs_C1);
+
+        if (BOOST_GEOMETRY_CONDITION(Distance))
+        {
+            result.s12b = A1 * (sigma12 + B1);
+        }
+
+        if (BOOST_GEOMETRY_CONDITION(Quantities))
+        {
+            CT const A2m1 = se::evaluate_A2<SeriesOrder>(eps);
+            se::coeffs_C2<SeriesOrder, CT> const coeffs_C2(eps);
+            CT const A2 = c1 + A2m1;
+
+            CT const B2 = se::sin_cos_series(sin_sigma2, cos_sigma2, coeffs_C2)
+                        - se::sin_cos_series(sin_sigma1, cos_sigma1, coeffs_C2);
+
+            result.m0 = A1m1 - A2m1;
+            CT const J12 = result.m0 * sigma12 + (A1 * B1 - A2 * B2);
+
+            // Parentheses ensure accurate cancellation for coincident points.
+            result.m12b = dn2 * (cos_sigma1 * sin_sigma2)
+                        - dn1 * (sin_sigma1 * cos_sigma2)
+                        - cos_sigma1 * cos_sigma2 * J12;
+
+            CT const cos_sigma12 = cos_sigma1 * cos_sigma2 + sin_sigma1 * sin_sigma2;
+            CT const t = ep2 * (cos_beta1 - cos_beta2) * (cos_beta1 + cos_beta2)
+                       / (dn1 + dn2);
+
+            result.M12 = cos_sigma12 + (t * sin_sigma2 - cos_sigma2 * J12) * sin_sigma1 / dn1;
+            result.M21 = cos_sigma12 - (t * sin_sigma1 - cos_sigma1 * J12) * sin_sigma2 / dn2;
+        }
+
+        return result;
+    }
+
+    /*
+     Solve the astroid problem k^4 + 2*k^3 - (x^2 + y^2 - 1)*k^2
+                               - 2*y^2*k - y^2 = 0
+     for the positive root k.
+    */
+    static inline CT astroid(CT const& x, CT const& y)
+    {
+        CT const c0 = 0;
+
+        CT const p = math::sqr(x);
+        CT const q = math::sqr(y);
+        CT const r = (p + q - CT(1)) / CT(6);
+
+        if (q == c0 && r <= c0)
+        {
+            // y = 0 with |x| <= 1
+            return c0;
+        }
+
+        // Avoid a possible division by zero when r = 0 by multiplying
+        // the equations for s and t by r^3 and r respectively.
+        CT const S = p * q / CT(4); // S = r^3 * s
+        CT const r2 = math::sqr(r);
+        CT const r3 = r * r2;
+
+        // The discriminant of the quadratic equation for T3, zero on the
+        // evolute curve p^(1/3) + q^(1/3) = 1.
+        CT const disc = S * (S + CT(2) * r3);
+
+        CT u = r;
+        if (disc >= c0)
+        {
+            CT T3 = S + r3;
+
+            // Pick the sign of the square root maximizing abs(T3), this
+            // minimizes the loss of precision due to cancellation.
+            T3 += T3 < c0 ? -math::sqrt(disc) : math::sqrt(disc); // T3 = (r * t)^3
+
+            CT const T = boost::math::cbrt(T3); // T = r * t
+
+            // T can be zero, but then r2 / T -> 0.
+            u += T + (T != c0 ? r2 / T : c0);
+        }
+        else
+        {
+            // T is complex, but the way u is defined the result is real.
+            CT const angle = atan2(math::sqrt(-disc), -(S + r3));
+
+            // Choose the cube root which avoids cancellation, disc < 0
+            // implies r < 0.
+            u += CT(2) * r * cos(angle / CT(3));
+        }
+
+        CT const v = math::sqrt(math::sqr(u) + q); // guaranteed positive
+
+        // Avoid a loss of accuracy when u < 0.
+        CT const uv = u < c0 ? q / (v - u) : u + v; // u + v, guaranteed positive
+        CT const w = (uv - q) / (CT(2) * v); // positive?
+
+        // Rearranged to avoid a loss of accuracy due to the subtraction,
+        // a division by 0 is not possible because uv > 0 and w >= 0.
+        return uv / (math::sqrt(uv + math::sqr(w)) + w); // guaranteed positive
+    }
+
+    /*
+     Return the starting point of Newton's method in sin_alpha1 and
+     cos_alpha1 and -1. If Newton's method is not needed, set also
+     sin_alpha2, cos_alpha2, dnm and return sigma12.
+    */
+    static inline CT newton_start(CT const& sin_beta1, CT const& cos_beta1, CT const& dn1,
+                                  CT const& sin_beta2, CT const& cos_beta2, CT const& dn2,
+                                  CT const& lam12, CT const& sin_lam12, CT const& cos_lam12,
+                                  CT& sin_alpha1, CT& cos_alpha1,
+                                  CT& sin_alpha2, CT& cos_alpha2,
+                                  CT& dnm,
+                                  constants const& c)
+    {
+        boost::ignore_unused(dn1, dn2);
+
+        CT const c0 = 0;
+        CT const c1 = 1;
+        CT const c2 = 2;
+        CT const half = c1 / c2;
+        CT const pi = math::pi<CT>();
+        CT const tol0 = std::numeric_limits<CT>::epsilon();
+        CT const tol1 = CT(200) * tol0;
+        CT const xthresh = CT(1000) * math::sqrt(tol0);
+
+        CT sigma12 = -c1;
+
+        // beta12 = beta2 - beta1 in [0, pi)
+        CT const sin_beta12 = sin_beta2 * cos_beta1 - cos_beta2 * sin_beta1;
+        CT const cos_beta12 = cos_beta2 * cos_beta1 + sin_beta2 * sin_beta1;
+
+        // beta12a = beta2 + beta1 in (-pi, 0]
+        CT const sin_beta12a = sin_beta2 * cos_beta1 + cos_beta2 * sin_beta1;
+
+        bool const shortline = cos_beta12 >= c0
+                            && sin_beta12 < half
+                            && cos_beta2 * lam12 < half;
+
+        CT sin_omega12, cos_omega12;
+        if (shortline)
+        {
+            // sin((beta1 + beta2) / 2)^2
+            CT sin_betam2 = math::sqr(sin_beta1 + sin_beta2);
+            sin_betam2 /= sin_betam2 + math::sqr(cos_beta1 + cos_beta2);
+            dnm = math::sqrt(c1 + c.ep2 * sin_betam2);
+
+            CT const omega12 = lam12 / (c.one_minus_f * dnm);
+            sin_omega12 = sin(omega12);
+            cos_omega12 = cos(omega12);
+        }
+        else
+        {
+            sin_omega12 = sin_lam12;
+            cos_omega12 = cos_lam12;
+        }
+
+        sin_alpha1 = cos_beta2 * sin_omega12;
+        cos_alpha1 = cos_omega12 >= c0
+            ? sin_beta12 + cos_beta2 * sin_beta1 * math::sqr(sin_omega12) / (c1 + cos_omega12)
+            : sin_beta12a - cos_beta2 * sin_beta1 * math::sqr(sin_omega12) / (c1 - cos_omega12);
+
+        CT const sin_sigma12 = boost::math::hypot(sin_alpha1, cos_alpha1);
+        CT const cos_sigma12 = sin_beta1 * sin_beta2 + cos_beta1 * cos_beta2 * cos_omega12;
+
+        if (shortline && sin_sigma12 < c.etol2)
+        {
+            // Really short lines.
+            sin_alpha2 = cos_beta1 * sin_omega12;
+            cos_alpha2 = sin_beta12 - cos_beta1 * sin_beta2 *
+                (cos_omega12 >= c0
+                    ? math::sqr(sin_omega12) / (c1 + cos_omega12)
+                    : c1 - cos_omega12);
+            math::normalize_unit_vector<CT>(sin_alpha2, cos_alpha2);
+
+            sigma12 = atan2(sin_sigma12, cos_sigma12);
+        }
+        else if (math::abs(c.n) > CT(0.1) // Too eccentric for the astroid.
+              || cos_sigma12 >= c0
+              || sin_sigma12 >= CT(6) * math::abs(c.n) * pi * math::sqr(cos_beta1))
+        {
+            // The zeroth order spherical approximation is OK.
+        }
+        else if (c.f >= c0) // Oblate spheroid, the prolate one is not handled here.
+        {
+            // Scale lam12 and beta2 to the x, y coordinate system where
+            // the antipodal point is at the origin and the singular point
+            // is at y = 0, x = -1.
+            CT const lam12x = atan2(-sin_lam12, -cos_lam12); // lam12 - pi
+
+            CT const k2 = math::sqr(sin_beta1) * c.ep2;
+            CT const eps = k2 / (c2 * (c1 + math::sqrt(c1 + k2)) + k2);
+
+            se::coeffs_A3<SeriesOrder, CT> const coeffs_A3(c.n);
+            CT const A3 = math::horner_evaluate(eps, coeffs_A3.begin(), coeffs_A3.end());
+
+            CT const lamscale = c.f * cos_beta1 * A3 * pi;
+            CT const betscale = lamscale * cos_beta1;
+
+            CT const x = lam12x / lamscale;
+            CT const y = sin_beta12a / betscale;
+
+            if (y > -tol1 && x > -c1 - xthresh)
+            {
+                // Strip near the cut.
+                sin_alpha1 = (std::min)(c1, -x);
+                cos_alpha1 = -math::sqrt(c1 - math::sqr(sin_alpha1));
+            }
+            else
+            {
+                // Estimate omega12 by solving the astroid problem and use
+                // the spherical formula to calculate alpha1. omega12 is
+                // near pi, so omega12a = pi - omega12 is used.
+                CT const k = astroid(x, y);
+                CT const omega12a = lamscale * (-x * k / (c1 + k));
+
+                sin_omega12 = sin(omega12a);
+                cos_omega12 = -cos(omega12a);
+
+                // Update the spherical estimate of alpha1 using omega12
+                // instead of lam12.
+                sin_alpha1 = cos_beta2 * sin_omega12;
+                cos_alpha1 = sin_beta12a - cos_beta2 * sin_beta1 *
+                             math::sqr(sin_omega12) / (c1 - cos_omega12);
+            }
+        }
+
+        // Sanity check of the starting guess, the backwards check allows
+        // NaN through.
+        if (! (sin_alpha1 <= c0))
+        {
+            math::normalize_unit_vector<CT>(sin_alpha1, cos_alpha1);
+        }
+        else
+        {
+            sin_alpha1 = c1;
+            cos_alpha1 = c0;
+        }
+
+        return sigma12;
+    }
+
+    /*
+     Return lambda12(alpha1) - lam12 and its derivative if diffp is true.
+    */
+    static inline CT lambda12(CT const& sin_beta1, CT const& cos_beta1, CT const& dn1,
+                              CT const& sin_beta2, CT const& cos_beta2, CT const& dn2,
+                              CT const& sin_alpha1, CT cos_alpha1,
+                              CT const& sin_lam120, CT const& cos_lam120,
+                              CT& sin_alpha2, CT& cos_alpha2,
+                              CT& sigma12,
+                              CT& sin_sigma1, CT& cos_sigma1,
+                              CT& sin_sigma2, CT& cos_sigma2,
+                              CT& eps,
+                              bool diffp, CT& dlam12,
+                              constants const& c)
+    {
+        CT const c0 = 0;
+        CT const c1 = 1;
+        CT const c2 = 2;
+
+        if (sin_beta1 == c0 && cos_alpha1 == c0)
+        {
+            // Break the degeneracy of the equatorial line, this case has
+            // already been handled.
+            cos_alpha1 = -math::sqrt((std::numeric_limits<CT>::min)());
+        }
+
+        // sin(alpha1) * cos(beta1) = sin(alpha0)
+        CT const sin_alpha0 = sin_alpha1 * cos_beta1;
+        CT const cos_alpha0 = boost::math::hypot(cos_alpha1, sin_alpha1 * sin_beta1); // > 0
+
+        // tan(beta1) = tan(sigma1) * cos(alpha1)
+        // tan(omega1) = sin(alpha0) * tan(sigma1)
+        sin_sigma1 = sin_beta1;
+        CT const sin_omega1 = sin_alpha0 * sin_beta1;
+        cos_sigma1 = cos_alpha1 * cos_beta1;
+        CT const cos_omega1 = cos_sigma1;
+        math::normalize_unit_vector<CT>(sin_sigma1, cos_sigma1);
+
+        // Enforce the symmetries in the case abs(beta2) = -beta1, which
+        // can yield singularities in the Newton iteration.
+        // sin(alpha2) * cos(beta2) = sin(alpha0)
+        sin_alpha2 = cos_beta2 != cos_beta1 ? sin_alpha0 / cos_beta2 : sin_alpha1;
+
+        // calp2 = sqrt(1 - sq(salp2)) = sqrt(sq(calp0) - sq(sbet2)) / cbet2
+        cos_alpha2 = cos_beta2 != cos_beta1 || math::abs(sin_beta2) != -sin_beta1
+            ? math::sqrt(math::sqr(cos_alpha1 * cos_beta1)
+                         + (cos_beta1 < -sin_beta1
+                            ? (cos_beta2 - cos_beta1) * (cos_beta1 + cos_beta2)
+                            : (sin_beta1 - sin_beta2) * (sin_beta1 + sin_beta2)))
+              / cos_beta2
+            : math::abs(cos_alpha1);
+
+        // tan(beta2) = tan(sigma2) * cos(alpha2)
+        // tan(omega2) = sin(alpha0) * tan(sigma2)
+        sin_sigma2 = sin_beta2;
+        CT const sin_omega2 = sin_alpha0 * sin_beta2;
+        cos_sigma2 = cos_alpha2 * cos_beta2;
+        CT const cos_omega2 = cos_sigma2;
+        math::normalize_unit_vector<CT>(sin_sigma2, cos_sigma2);
+
+        // sigma12 = sigma2 - sigma1, limited to [0, pi]
+        sigma12 = atan2((std::max)(c0, cos_sigma1 * sin_sigma2 - sin_sigma1 * cos_sigma2),
+                        cos_sigma1 * cos_sigma2 + sin_sigma1 * sin_sigma2);
+
+        // omega12 = omega2 - omega1, limited to [0, pi]
+        CT const sin_omega12 = (std::max)(c0, cos_omega1 * sin_omega2 - sin_omega1 * cos_omega2);
+        CT const cos_omega12 = cos_omega1 * cos_omega2 + sin_omega1 * sin_omega2;
+
+        // eta = omega12 - lam120
+        CT const eta = atan2(sin_omega12 * cos_lam120 - cos_omega12 * sin_lam120,
+                             cos_omega12 * cos_lam120 + sin_omega12 * sin_lam120);
+
+        CT const k2 = math::sqr(cos_alpha0) * c.ep2;
+        eps = k2 / (c2 * (c1 + math::sqrt(c1 + k2)) + k2);
+
+        se::coeffs_C3<SeriesOrder, CT> const coeffs_C3(c.n, eps);
+        CT const B312 = se::sin_cos_series(sin_sigma2, cos_sigma2, coeffs_C3)
+                      - se::sin_cos_series(sin_sigma1, cos_sigma1, coeffs_C3);
+
+        se::coeffs_A3<SeriesOrder, CT> const coeffs_A3(c.n);
+        CT const A3 = math::horner_evaluate(eps, coeffs_A3.begin(), coeffs_A3.end());
+
+        CT const domega12 = -c.f * A3 * sin_alpha0 * (sigma12 + B312);
+        CT const lam12 = eta + domega12;
+
+        if (diffp)
+        {
+            if (cos_alpha2 == c0)
+            {
+                dlam12 = -c2 * c.one_minus_f * dn1 / sin_beta1;
+            }
+            else
+            {
+                lengths_type const lengths
+                    = calculate_lengths<false, true>(eps, sigma12,
+                                                     sin_sigma1, cos_sigma1, dn1,
+                                                     sin_sigma2, cos_sigma2, dn2,
+                                                     cos_beta1, cos_beta2, c.ep2);
+
+                dlam12 = lengths.m12b * c.one_minus_f / (cos_alpha2 * cos_beta2);
+            }
+        }
+
+        return lam12;
+    }
+
+    // Difference of angles in degrees, y - x = d + e exactly, d in (-180, 180]
+    static inline CT angle_diff(CT const& x, CT const& y, CT& e)
+    {
+        CT t;
+        CT d = angle_normalize(sum(remainder_360(-x), remainder_360(y), t));
+
+        // The only case where the addition of t takes the result outside
+        // the range (-180, 180] is d = 180 and t > 0.
+        return sum(d == CT(180) && t > CT(0) ? CT(-180) : d, t, e);
+    }
+
+    // Error free transformation of a sum, u + v = s + t exactly
+    static inline CT sum(CT const& u, CT const& v, CT& t)
+    {
+        volatile CT s = u + v;
+        volatile CT up = s - v;
+        volatile CT vpp = s - up;
+        up -= u;
+        vpp -= v;
+        t = -(up + vpp);
+        return s;
+    }
+
+    // x in [-180, 180]
+    static inline CT remainder_360(CT const& x)
+    {
+        CT y = math::mod(x, CT(360));
+        if (y > CT(180))
+        {
+            y -= CT(360);
+        }
+        else if (y < CT(-180))
+        {
+            y += CT(360);
+        }
+        return y;
+    }
+
+    // x in (-180, 180]
+    static inline CT angle_normalize(CT const& x)
+    {
+        CT const y = remainder_360(x);
+        return y != CT(-180) ? y : CT(180);
+    }
+};
+
+}}} // namespace boost::geometry::formula
+
+
+#endif // BOOST_GEOMETRY_FORMULAS_KARNEY_INVERSE_HPP
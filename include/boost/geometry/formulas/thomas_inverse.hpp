@@ -61,6 +61,43 @@ public:
                                     T2 const& lon2,
                                     T2 const& lat2,
                                     Spheroid const& spheroid)
+    {
+        // coordinates in radians
+
+        if ( math::equals(lon1, lon2) && math::equals(lat1, lat2) )
+        {
+            return result_type();
+        }
+
+        return apply(lon1, lat1, reduced_latitude(lat1, spheroid),
+                     lon2, lat2, reduced_latitude(lat2, spheroid),
+                     spheroid);
+    }
+
+    template <typename T, typename Spheroid>
+    static inline CT reduced_latitude(T const& lat, Spheroid const& spheroid)
+    {
+        CT const pi_half = math::pi<CT>() / CT(2);
+        CT const one_minus_f = CT(1) - formula::flattening<CT>(spheroid);
+
+//        CT const tan_theta = one_minus_f * tan(lat);
+//        CT const theta = atan(tan_theta);
+
+        return math::equals(lat, pi_half) ? CT(lat) :
+               math::equals(lat, -pi_half) ? CT(lat) :
+               atan(one_minus_f * tan(lat));
+    }
+
+    // reduced latitudes calculated by the caller, e.g. once per point for
+    // many pairs of points
+    template <typename T1, typename T2, typename Spheroid>
+    static inline result_type apply(T1 const& lon1,
+                                    T1 const& lat1,
+                                    CT const& theta1,
+                                    T2 const& lon2,
+                                    T2 const& lat2,
+                                    CT const& theta2,
+                                    Spheroid const& spheroid)
     {
         result_type result;
 
@@ -76,21 +113,7 @@ public:
         CT const c2 = 2;
         CT const c4 = 4;
 
-        CT const pi_half = math::pi<CT>() / c2;
         CT const f = formula::flattening<CT>(spheroid);
-        CT const one_minus_f = c1 - f;
-
-//        CT const tan_theta1 = one_minus_f * tan(lat1);
-//        CT const tan_theta2 = one_minus_f * tan(lat2);
-//        CT const theta1 = atan(tan_theta1);
-//        CT const theta2 = atan(tan_theta2);
-
-        CT const theta1 = math::equals(lat1, pi_half) ? lat1 :
-                          math::equals(lat1, -pi_half) ? lat1 :
-                          atan(one_minus_f * tan(lat1));
-        CT const theta2 = math::equals(lat2, pi_half) ? lat2 :
-                          math::equals(lat2, -pi_half) ? lat2 :
-                          atan(one_minus_f * tan(lat2));
 
         CT const theta_m = (theta1 + theta2) / c2;
         CT const d_theta_m = (theta2 - theta1) / c2;
@@ -0,0 +1,670 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_DETAIL_FORMAT_NUMBER_HPP
+#define BOOST_GEOMETRY_IO_DETAIL_FORMAT_NUMBER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <iomanip>
+#include <ios>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/special_functions/sign.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/make_unsigned.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace format_number
+{
+
+// Maximum number of characters written by write_shortest() and write_fixed()
+static const std::size_t max_chars = 32;
+
+// Floating point number with 64-bit significand, f * 2^e
+struct diy_fp
+{
+    diy_fp()
+        : f(0), e(0)
+    {}
+
+    diy_fp(boost::uint64_t f_, int e_)
+        : f(f_), e(e_)
+    {}
+
+    // The upper 64 bits of the product, rounded
+    diy_fp operator*(diy_fp const& other) const
+    {
+        boost::uint64_t const m32 = 0xFFFFFFFFu;
+        boost::uint64_t const a = f >> 32;
+        boost::uint64_t const b = f & m32;
+        boost::uint64_t const c = other.f >> 32;
+        boost::uint64_t const d = other.f & m32;
+        boost::uint64_t const ac = a * c;
+        boost::uint64_t const bc = b * c;
+        boost::uint64_t const ad = a * d;
+        boost::uint64_t const bd = b * d;
+        boost::uint64_t tmp = (bd >> 32) + (ad & m32) + (bc & m32);
+        tmp += boost::uint64_t(1) << 31;
+        return diy_fp(ac + (ad >> 32) + (bc >> 32) + (tmp >> 32), e + other.e + 64);
+    }
+
+    diy_fp normalized() const
+    {
+        diy_fp result = *this;
+        boost::uint64_t const top = boost::uint64_t(1) << 63;
+        while (! (result.f & top))
+        {
+            result.f <<= 1;
+            result.e--;
+        }
+        return result;
+    }
+
+    boost::uint64_t f;
+    int e;
+};
+
+template <typename T>
+struct ieee_traits
+{};
+
+template <>
+struct ieee_traits<double>
+{
+    typedef boost::uint64_t bits_type;
+    static const int significand_size = 52;
+    static const int exponent_mask = 0x7FF;
+    static const int exponent_bias = 0x3FF + significand_size;
+};
+
+template <>
+struct ieee_traits<float>
+{
+    typedef boost::uint32_t bits_type;
+    static const int significand_size = 23;
+    static const int exponent_mask = 0xFF;
+    static const int exponent_bias = 0x7F + significand_size;
+};
+
+// Normalized 10^k for k = -348, -340, ..., 340 and their binary exponents
+inline diy_fp cached_power(std::size_t index)
+{
+    static const struct { boost::uint32_t high, low; int e; } powers[] =
+    {
+        { 0xfa8fd5a0, 0x081c0288, -1220 }, { 0xbaaee17f, 0xa23ebf76, -1193 },
+        { 0x8b16fb20, 0x3055ac76, -1166 }, { 0xcf42894a, 0x5dce35ea, -1140 },
+        { 0x9a6bb0aa, 0x55653b2d, -1113 }, { 0xe61acf03, 0x3d1a45df, -1087 },
+        { 0xab70fe17, 0xc79ac6ca, -1060 }, { 0xff77b1fc, 0xbebcdc4f, -1034 },
+        { 0xbe5691ef, 0x416bd60c, -1007 }, { 0x8dd01fad, 0x907ffc3c, -980 },
+        { 0xd3515c28, 0x31559a83, -954 }, { 0x9d71ac8f, 0xada6c9b5, -927 },
+        { 0xea9c2277, 0x23ee8bcb, -901 }, { 0xaecc4991, 0x4078536d, -874 },
+        { 0x823c1279, 0x5db6ce57, -847 }, { 0xc2109436, 0x4dfb5637, -821 },
+        { 0x9096ea6f, 0x3848984f, -794 }, { 0xd77485cb, 0x25823ac7, -768 },
+        { 0xa086cfcd, 0x97bf97f4, -741 }, { 0xef340a98, 0x172aace5, -715 },
+        { 0xb23867fb, 0x2a35b28e, -688 }, { 0x84c8d4df, 0xd2c63f3b, -661 },
+        { 0xc5dd4427, 0x1ad3cdba, -635 }, { 0x936b9fce, 0xbb25c996, -608 },
+        { 0xdbac6c24, 0x7d62a584, -582 }, { 0xa3ab6658, 0x0d5fdaf6, -555 },
+        { 0xf3e2f893, 0xdec3f126, -529 }, { 0xb5b5ada8, 0xaaff80b8, -502 },
+        { 0x87625f05, 0x6c7c4a8b, -475 }, { 0xc9bcff60, 0x34c13053, -449 },
+        { 0x964e858c, 0x91ba2655, -422 }, { 0xdff97724, 0x70297ebd, -396 },
+        { 0xa6dfbd9f, 0xb8e5b88f, -369 }, { 0xf8a95fcf, 0x88747d94, -343 },
+        { 0xb9447093, 0x8fa89bcf, -316 }, { 0x8a08f0f8, 0xbf0f156b, -289 },
+        { 0xcdb02555, 0x653131b6, -263 }, { 0x993fe2c6, 0xd07b7fac, -236 },
+        { 0xe45c10c4, 0x2a2b3b06, -210 }, { 0xaa242499, 0x697392d3, -183 },
+        { 0xfd87b5f2, 0x8300ca0e, -157 }, { 0xbce50864, 0x92111aeb, -130 },
+        { 0x8cbccc09, 0x6f5088cc, -103 }, { 0xd1b71758, 0xe219652c, -77 },
+        { 0x9c400000, 0x00000000, -50 }, { 0xe8d4a510, 0x00000000, -24 },
+        { 0xad78ebc5, 0xac620000, 3 }, { 0x813f3978, 0xf8940984, 30 },
+        { 0xc097ce7b, 0xc90715b3, 56 }, { 0x8f7e32ce, 0x7bea5c70, 83 },
+        { 0xd5d238a4, 0xabe98068, 109 }, { 0x9f4f2726, 0x179a2245, 136 },
+        { 0xed63a231, 0xd4c4fb27, 162 }, { 0xb0de6538, 0x8cc8ada8, 189 },
+        { 0x83c7088e, 0x1aab65db, 216 }, { 0xc45d1df9, 0x42711d9a, 242 },
+        { 0x924d692c, 0xa61be758, 269 }, { 0xda01ee64, 0x1a708dea, 295 },
+        { 0xa26da399, 0x9aef774a, 322 }, { 0xf209787b, 0xb47d6b85, 348 },
+        { 0xb454e4a1, 0x79dd1877, 375 }, { 0x865b8692, 0x5b9bc5c2, 402 },
+        { 0xc83553c5, 0xc8965d3d, 428 }, { 0x952ab45c, 0xfa97a0b3, 455 },
+        { 0xde469fbd, 0x99a05fe3, 481 }, { 0xa59bc234, 0xdb398c25, 508 },
+        { 0xf6c69a72, 0xa3989f5c, 534 }, { 0xb7dcbf53, 0x54e9bece, 561 },
+        { 0x88fcf317, 0xf22241e2, 588 }, { 0xcc20ce9b, 0xd35c78a5, 614 },
+        { 0x98165af3, 0x7b2153df, 641 }, { 0xe2a0b5dc, 0x971f303a, 667 },
+        { 0xa8d9d153, 0x5ce3b396, 694 }, { 0xfb9b7cd9, 0xa4a7443c, 720 },
+        { 0xbb764c4c, 0xa7a44410, 747 }, { 0x8bab8eef, 0xb6409c1a, 774 },
+        { 0xd01fef10, 0xa657842c, 800 }, { 0x9b10a4e5, 0xe9913129, 827 },
+        { 0xe7109bfb, 0xa19c0c9d, 853 }, { 0xac2820d9, 0x623bf429, 880 },
+        { 0x80444b5e, 0x7aa7cf85, 907 }, { 0xbf21e440, 0x03acdd2d, 933 },
+        { 0x8e679c2f, 0x5e44ff8f, 960 }, { 0xd433179d, 0x9c8cb841, 986 },
+        { 0x9e19db92, 0xb4e31ba9, 1013 }, { 0xeb96bf6e, 0xbadf77d9, 1039 },
+        { 0xaf87023b, 0x9bf0ee6b, 1066 },
+    };
+
+    return diy_fp((boost::uint64_t(powers[index].high) << 32) | powers[index].low,
+                  powers[index].e);
+}
+
+// The cached power c such that the exponent of the product of a number
+// having binary exponent e and c is in [-60, -32], and -k, its decimal exponent
+inline diy_fp cached_power_for(int e, int& k)
+{
+    double const dk = (-61 - e) * 0.30102999566398114 + 347;
+    int ik = static_cast<int>(dk);
+    if (dk - ik > 0.0)
+    {
+        ik++;
+    }
+
+    std::size_t const index = static_cast<std::size_t>((ik >> 3) + 1);
+    k = -(-348 + static_cast<int>(index << 3));
+    return cached_power(index);
+}
+
+inline boost::uint64_t power_of_ten(int n)
+{
+    boost::uint64_t result = 1;
+    for (int i = 0 ; i < n ; ++i)
+    {
+        result *= 10;
+    }
+    return result;
+}
+
+inline void grisu_round(char* digits, int length, boost::uint64_t delta,
+                        boost::uint64_t rest, boost::uint64_t ten_kappa,
+                        boost::uint64_t wp_w)
+{
+    while (rest < wp_w && delta - rest >= ten_kappa
+           && (rest + ten_kappa < wp_w
+               || wp_w - rest > rest + ten_kappa - wp_w))
+    {
+        digits[length - 1]--;
+        rest += ten_kappa;
+    }
+}
+
+inline int count_decimal_digits(boost::uint32_t n)
+{
+    int result = 1;
+    for (boost::uint32_t p = 10 ; result < 10 && n >= p ; p *= 10)
+    {
+        ++result;
+    }
+    return result;
+}
+
+inline void digit_gen(diy_fp const& w, diy_fp const& mp, boost::uint64_t delta,
+                      char* digits, int& length, int& k)
+{
+    diy_fp const one(boost::uint64_t(1) << -mp.e, mp.e);
+    boost::uint64_t const wp_w = mp.f - w.f;
+    boost::uint32_t p1 = static_cast<boost::uint32_t>(mp.f >> -one.e);
+    boost::uint64_t p2 = mp.f & (one.f - 1);
+    int kappa = count_decimal_digits(p1);
+    length = 0;
+
+    // integral part
+    while (kappa > 0)
+    {
+        boost::uint32_t const divisor = static_cast<boost::uint32_t>(power_of_ten(kappa - 1));
+        boost::uint32_t const d = p1 / divisor;
+        p1 %= divisor;
+        if (d != 0 || length != 0)
+        {
+            digits[length++] = static_cast<char>('0' + d);
+        }
+        kappa--;
+
+        boost::uint64_t const rest = (static_cast<boost::uint64_t>(p1) << -one.e) + p2;
+        if (rest <= delta)
+        {
+            k += kappa;
+            grisu_round(digits, length, delta, rest,
+                        power_of_ten(kappa) << -one.e, wp_w);
+            return;
+        }
+    }
+
+    // fractional part
+    for (;;)
+    {
+        p2 *= 10;
+        delta *= 10;
+        char const d = static_cast<char>(p2 >> -one.e);
+        if (d != 0 || length != 0)
+        {
+            digits[length++] = static_cast<char>('0' + d);
+        }
+        p2 &= one.f - 1;
+        kappa--;
+        if (p2 < delta)
+        {
+            k += kappa;
+            int const index = -kappa;
+            grisu_round(digits, length, delta, p2, one.f,
+                        wp_w * (index < 20 ? power_of_ten(index) : 0));
+            return;
+        }
+    }
+}
+
+/*!
+\brief Internal, generates the decimal digits of a positive finite number
+\details Grisu2 algorithm of Florian Loitsch. The digits read back as the
+    same number and are the shortest such digits in the vast majority
+    of cases. The value is digits * 10^k.
+*/
+template <typename T>
+inline void grisu2(T value, char* digits, int& length, int& k)
+{
+    typedef ieee_traits<T> traits;
+    typedef typename traits::bits_type bits_type;
+
+    bits_type bits;
+    std::memcpy(&bits, &value, sizeof(T));
+
+    boost::uint64_t const hidden_bit = boost::uint64_t(1) << traits::significand_size;
+    boost::uint64_t const significand = bits & (hidden_bit - 1);
+    int const biased_e = static_cast<int>(bits >> traits::significand_size)
+                       & traits::exponent_mask;
+
+    diy_fp const v = biased_e != 0
+                   ? diy_fp(significand + hidden_bit, biased_e - traits::exponent_bias)
+                   : diy_fp(significand, 1 - traits::exponent_bias);
+
+    // boundaries between v and its neighbours
+    diy_fp const m_plus = diy_fp((v.f << 1) + 1, v.e - 1).normalized();
+    diy_fp m_minus = v.f == hidden_bit
+                   ? diy_fp((v.f << 2) - 1, v.e - 2)
+                   : diy_fp((v.f << 1) - 1, v.e - 1);
+    m_minus.f <<= m_minus.e - m_plus.e;
+    m_minus.e = m_plus.e;
+
+    diy_fp const c_mk = cached_power_for(m_plus.e, k);
+    diy_fp const w = v.normalized() * c_mk;
+    diy_fp wp = m_plus * c_mk;
+    diy_fp wm = m_minus * c_mk;
+    wm.f++;
+    wp.f--;
+
+    digit_gen(w, wp, wp.f - wm.f, digits, length, k);
+}
+
+inline char* write_exponent(int e, char* out)
+{
+    if (e < 0)
+    {
+        *out++ = '-';
+        e = -e;
+    }
+    if (e >= 100)
+    {
+        *out++ = static_cast<char>('0' + e / 100);
+        e %= 100;
+        *out++ = static_cast<char>('0' + e / 10);
+    }
+    else if (e >= 10)
+    {
+        *out++ = static_cast<char>('0' + e / 10);
+    }
+    *out++ = static_cast<char>('0' + e % 10);
+    return out;
+}
+
+/*!
+\brief Internal, writes digits * 10^k in fixed or exponential notation
+\details The fixed notation is used for numbers in [1e-6, 1e21)
+*/
+inline char* write_decimal(char const* digits, int length, int k, char* out)
+{
+    // 10^(kk-1) <= v < 10^kk
+    int const kk = length + k;
+
+    if (k >= 0 && kk <= 21)
+    {
+        // 1234e7 -> 12340000000
+        std::memcpy(out, digits, length);
+        out += length;
+        for (int i = 0 ; i < k ; ++i)
+        {
+            *out++ = '0';
+        }
+    }
+    else if (0 < kk && kk <= 21)
+    {
+        // 1234e-2 -> 12.34
+        std::memcpy(out, digits, kk);
+        out += kk;
+        *out++ = '.';
+        std::memcpy(out, digits + kk, length - kk);
+        out += length - kk;
+    }
+    else if (-6 < kk && kk <= 0)
+    {
+        // 1234e-6 -> 0.001234
+        *out++ = '0';
+        *out++ = '.';
+        for (int i = kk ; i < 0 ; ++i)
+        {
+            *out++ = '0';
+        }
+        std::memcpy(out, digits, length);
+        out += length;
+    }
+    else
+    {
+        // 1234e30 -> 1.234e33
+        *out++ = digits[0];
+        if (length > 1)
+        {
+            *out++ = '.';
+            std::memcpy(out, digits + 1, length - 1);
+            out += length - 1;
+        }
+        *out++ = 'e';
+        out = write_exponent(kk - 1, out);
+    }
+
+    return out;
+}
+
+template <typename T>
+inline bool write_special(T value, char*& out)
+{
+    if ((boost::math::isnan)(value))
+    {
+        std::memcpy(out, "nan", 3);
+        out += 3;
+        return true;
+    }
+
+    if ((boost::math::signbit)(value))
+    {
+        *out++ = '-';
+    }
+
+    if ((boost::math::isinf)(value))
+    {
+        std::memcpy(out, "inf", 3);
+        out += 3;
+        return true;
+    }
+
+    if (value == 0)
+    {
+        *out++ = '0';
+        return true;
+    }
+
+    return false;
+}
+
+/*!
+\brief Internal, writes the shortest representation reading back as the value
+\details Locale independent. At most max_chars characters are written.
+\return pointer past the last character written
+*/
+template <typename T>
+inline char* write_shortest(T value, char* out)
+{
+    if (write_special(value, out))
+    {
+        return out;
+    }
+
+    char digits[20];
+    int length = 0;
+    int k = 0;
+    grisu2(value < 0 ? -value : value, digits, length, k);
+    return write_decimal(digits, length, k, out);
+}
+
+/*!
+\brief Internal, rounds value * 10^precision to the nearest integer
+\details The exact binary value is rounded, ties to even, as printf does.
+    The value is positive and finite, precision is at most 18 and the
+    result is less than 1.8e19 and fits in 64 bits.
+*/
+inline boost::uint64_t round_scaled(double value, int precision)
+{
+    typedef ieee_traits<double> traits;
+
+    boost::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(double));
+
+    boost::uint64_t const hidden_bit = boost::uint64_t(1) << traits::significand_size;
+    boost::uint64_t const significand = bits & (hidden_bit - 1);
+    int const biased_e = static_cast<int>(bits >> traits::significand_size)
+                       & traits::exponent_mask;
+
+    // value = f * 2^e, and value * 10^precision = f * 5^precision * 2^shift
+    boost::uint64_t const f = biased_e != 0 ? significand + hidden_bit : significand;
+    int const e = biased_e != 0 ? biased_e - traits::exponent_bias : 1 - traits::exponent_bias;
+    int const shift = e + precision;
+
+    boost::uint64_t five = 1;
+    for (int i = 0 ; i < precision ; ++i)
+    {
+        five *= 5;
+    }
+
+    // f < 2^53 and five < 2^42, the 128-bit product is high * 2^64 + low
+    boost::uint64_t const m32 = 0xFFFFFFFFu;
+    boost::uint64_t const bd = (f & m32) * (five & m32);
+    boost::uint64_t const ad = (f >> 32) * (five & m32);
+    boost::uint64_t const bc = (f & m32) * (five >> 32);
+    boost::uint64_t const middle = (bd >> 32) + (ad & m32) + (bc & m32);
+    boost::uint64_t const low = (middle << 32) | (bd & m32);
+    boost::uint64_t const high = (f >> 32) * (five >> 32)
+                               + (ad >> 32) + (bc >> 32) + (middle >> 32);
+
+    if (shift >= 0)
+    {
+        return low << shift;
+    }
+
+    int const n = -shift;
+    if (n >= 96)
+    {
+        // the product is below 2^95, less than half of 2^n
+        return 0;
+    }
+
+    // the quotient and the remainder of the division by 2^n,
+    // compared to half of 2^n
+    boost::uint64_t quotient, rest_high, rest_low, half_high, half_low;
+    if (n < 64)
+    {
+        quotient = (low >> n) | (high << (64 - n));
+        rest_high = 0;
+        rest_low = low & ((boost::uint64_t(1) << n) - 1);
+        half_high = 0;
+        half_low = boost::uint64_t(1) << (n - 1);
+    }
+    else
+    {
+        int const h = n - 64;
+        quotient = high >> h;
+        rest_high = high & ((boost::uint64_t(1) << h) - 1);
+        rest_low = low;
+        half_high = h > 0 ? boost::uint64_t(1) << (h - 1) : 0;
+        half_low = h > 0 ? 0 : boost::uint64_t(1) << 63;
+    }
+
+    bool const above = rest_high > half_high
+                    || (rest_high == half_high && rest_low > half_low);
+    bool const tie = rest_high == half_high && rest_low == half_low;
+    return above || (tie && (quotient & 1) != 0) ? quotient + 1 : quotient;
+}
+
+/*!
+\brief Internal, writes the value rounded to at most precision decimal digits
+\details The value is rounded like printf with %.*f. Trailing zeros are
+    not written. Numbers which are too big to be rounded exactly are
+    written with write_shortest().
+\return pointer past the last character written
+*/
+template <typename T>
+inline char* write_fixed(T value, int precision, char* out)
+{
+    char* const first = out;
+    if (write_special(value, out))
+    {
+        return out;
+    }
+
+    double const positive = value < 0 ? -double(value) : double(value);
+    double const scaled = positive
+                        * double(power_of_ten(precision < 19 ? precision : 0));
+    if (precision > 18 || ! (scaled < 1.8e19))
+    {
+        return write_shortest(value, first);
+    }
+
+    boost::uint64_t m = round_scaled(positive, precision);
+    if (m == 0)
+    {
+        // no minus sign
+        *first = '0';
+        return first + 1;
+    }
+
+    // digits of m in reverse order, with at least precision + 1 digits
+    char reversed[20];
+    int length = 0;
+    for ( ; m != 0 || length <= precision ; m /= 10)
+    {
+        reversed[length++] = static_cast<char>('0' + m % 10);
+    }
+
+    // without trailing zeros of the fraction
+    int skipped = 0;
+    while (skipped < precision && reversed[skipped] == '0')
+    {
+        ++skipped;
+    }
+
+    for (int i = length - 1 ; i >= skipped ; --i)
+    {
+        if (i == precision - 1)
+        {
+            *out++ = '.';
+        }
+        *out++ = reversed[i];
+    }
+
+    return out;
+}
+
+template <typename T>
+inline char* write_integer(T value, char* out)
+{
+    typedef typename boost::make_unsigned<T>::type unsigned_type;
+
+    unsigned_type u = static_cast<unsigned_type>(value);
+    if (value < 0)
+    {
+        *out++ = '-';
+        u = static_cast<unsigned_type>(0 - u);
+    }
+
+    char reversed[3 * sizeof(T) + 1];
+    int length = 0;
+    do
+    {
+        reversed[length++] = static_cast<char>('0' + u % 10);
+        u /= 10;
+    }
+    while (u != 0);
+
+    while (length > 0)
+    {
+        *out++ = reversed[--length];
+    }
+    return out;
+}
+
+template
+<
+    typename T,
+    bool IsDouble = boost::is_same<T, double>::value
+                 || boost::is_same<T, float>::value,
+    bool IsIntegral = boost::is_integral<T>::value
+>
+struct formatter
+{
+    // Other types, e.g. long double or user defined types, are written
+    // by a stream with classic locale
+    static inline void apply(T const& value, int precision, std::string& out)
+    {
+        std::ostringstream os;
+        os.imbue(std::locale::classic());
+        if (precision >= 0)
+        {
+            os << std::fixed << std::setprecision(precision);
+        }
+        else if (std::numeric_limits<T>::is_specialized)
+        {
+            os << std::setprecision(std::numeric_limits<T>::digits10 + 3);
+        }
+        os << value;
+        out += os.str();
+    }
+};
+
+template <typename T>
+struct formatter<T, true, false>
+{
+    static inline void apply(T const& value, int precision, std::string& out)
+    {
+        char buffer[max_chars];
+        char const* const last = precision < 0
+                               ? write_shortest(value, buffer)
+                               : write_fixed(value, precision, buffer);
+        out.append(buffer, std::size_t(last - buffer));
+    }
+};
+
+template <typename T>
+struct formatter<T, false, true>
+{
+    static inline void apply(T const& value, int, std::string& out)
+    {
+        char buffer[max_chars];
+        char const* const last = write_integer(value, buffer);
+        out.append(buffer, std::size_t(last - buffer));
+    }
+};
+
+/*!
+\brief Internal, appends a coordinate to a string
+\details Doubles and floats are written locale independently, with the
+    shortest representation reading back as the same value if precision
+    is negative or rounded to at most precision decimal digits otherwise.
+*/
+template <typename T>
+inline void append(T const& value, int precision, std::string& out)
+{
+    formatter<T>::apply(value, precision, out);
+}
+
+}} // namespace detail::format_number
+#endif // DOXYGEN_NO_DETAIL
+
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_DETAIL_FORMAT_NUMBER_HPP
@@ -0,0 +1,767 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_SVG_LOD_MAPPER_HPP
+#define BOOST_GEOMETRY_IO_SVG_LOD_MAPPER_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <ostream>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/mpl/assert.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/detail/interior_iterator.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/algorithms/is_empty.hpp>
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry/io/detail/format_number.hpp>
+#include <boost/geometry/strategies/transform/map_transformer.hpp>
+#include <boost/geometry/util/select_most_precise.hpp>
+#include <boost/geometry/views/detail/indexed_point_view.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Output of svg_lod_mapper writing to a C file
+\ingroup svg
+*/
+class svg_file_output
+{
+public:
+    explicit svg_file_output(std::FILE* file)
+        : m_file(file)
+    {}
+
+    void write(char const* data, std::size_t size) const
+    {
+        std::fwrite(data, 1, size, m_file);
+    }
+
+private:
+    std::FILE* m_file;
+};
+
+/*!
+\brief Output of svg_lod_mapper writing blocks to a stream, without
+    formatting
+\ingroup svg
+*/
+class svg_stream_output
+{
+public:
+    explicit svg_stream_output(std::ostream& stream)
+        : m_stream(&stream)
+    {}
+
+    void write(char const* data, std::size_t size) const
+    {
+        m_stream->write(data, static_cast<std::streamsize>(size));
+    }
+
+private:
+    std::ostream* m_stream;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace svg
+{
+
+struct pixel
+{
+    pixel()
+        : x(0), y(0)
+    {}
+
+    boost::int64_t x, y;
+
+    bool operator==(pixel const& other) const
+    {
+        return x == other.x && y == other.y;
+    }
+};
+
+/*!
+\brief Internal, writes geometries snapped to pixels to a string buffer
+\details Consecutive vertices snapped to the same pixel and vertices in the
+    middle of straight lines of pixels are dropped while the vertices are
+    visited. Elements and rings collapsing to less than the vertices they
+    need are removed from the end of the buffer.
+*/
+template <typename Transformer>
+class lod_writer
+{
+public:
+    lod_writer(std::string& buffer, Transformer const& transformer,
+               double resolution)
+        : m_buffer(buffer)
+        , m_transformer(transformer)
+        , m_resolution(resolution)
+        , m_decimals(decimals(resolution))
+    {}
+
+    std::string& buffer() { return m_buffer; }
+
+    template <typename Point>
+    pixel snap(Point const& point) const
+    {
+        model::point<double, 2, cs::cartesian> mapped;
+        m_transformer.apply(point, mapped);
+
+        pixel result;
+        result.x = round(get<0>(mapped) / m_resolution);
+        result.y = round(get<1>(mapped) / m_resolution);
+        return result;
+    }
+
+    void coordinate(boost::int64_t value)
+    {
+        if (m_resolution == 1.0)
+        {
+            format_number::append(value, -1, m_buffer);
+        }
+        else
+        {
+            // Rounded, the shortest representation of e.g. 3 * 0.1 would be
+            // 0.30000000000000004
+            format_number::append(static_cast<double>(value) * m_resolution,
+                                  m_decimals, m_buffer);
+        }
+    }
+
+    void vertex(pixel const& p, char const* separator)
+    {
+        m_buffer += separator;
+        coordinate(p.x);
+        m_buffer += ',';
+        coordinate(p.y);
+    }
+
+    /*!
+    \brief Writes the vertices of a range
+    \param prefix written before the first vertex
+    \param separator written before the second vertex
+    \param minimum minimum number of vertices, the range is removed
+        from the buffer if less vertices are kept
+    \return false if the range was removed
+    */
+    template <typename Range>
+    bool range(Range const& range, char const* prefix, char const* separator,
+               std::size_t minimum)
+    {
+        typedef typename boost::range_iterator<Range const>::type iterator;
+
+        iterator it = boost::begin(range);
+        iterator const end = boost::end(range);
+        if (it == end)
+        {
+            return false;
+        }
+
+        std::size_t const start = m_buffer.size();
+        pixel const first = snap(*it);
+        vertex(first, prefix);
+
+        // The last vertex is written once the next one doesn't continue
+        // the same straight line
+        std::size_t count = 1;
+        pixel previous = first;
+        pixel last = first;
+        for (++it; it != end; ++it)
+        {
+            pixel const p = snap(*it);
+            if (p == last)
+            {
+                continue;
+            }
+            if (is_continuation(previous, last, p))
+            {
+                last = p;
+                continue;
+            }
+            if (! (last == previous))
+            {
+                vertex(last, count == 1 ? separator : " ");
+                count++;
+            }
+            previous = last;
+            last = p;
+        }
+        if (! (last == previous))
+        {
+            vertex(last, count == 1 ? separator : " ");
+            count++;
+        }
+
+        if (count < minimum)
+        {
+            m_buffer.resize(start);
+            return false;
+        }
+        return true;
+    }
+
+private:
+    // Number of decimals of the resolution, writing its multiples exactly
+    static int decimals(double resolution)
+    {
+        if (! (resolution > 0.0) || (boost::math::isinf)(resolution))
+        {
+            return 0;
+        }
+
+        // resolution = digits * 10^k, its shortest representation
+        char digits[20];
+        int length = 0;
+        int k = 0;
+        format_number::grisu2(resolution, digits, length, k);
+        while (length > 1 && digits[length - 1] == '0')
+        {
+            --length;
+            ++k;
+        }
+        return k >= 0 ? 0 : -k < 17 ? -k : 17;
+    }
+
+    static boost::int64_t round(double value)
+    {
+        // larger values are far outside of the map
+        static const double limit = 1 << 30;
+        double const rounded = std::floor(value + 0.5);
+        return static_cast<boost::int64_t>(rounded < -limit ? -limit
+                                         : rounded > limit ? limit
+                                         : rounded);
+    }
+
+    // q continues the line from p1 to p2 in the same direction
+    static bool is_continuation(pixel const& p1, pixel const& p2, pixel const& q)
+    {
+        boost::int64_t const dx1 = p2.x - p1.x;
+        boost::int64_t const dy1 = p2.y - p1.y;
+        boost::int64_t const dx2 = q.x - p2.x;
+        boost::int64_t const dy2 = q.y - p2.y;
+        return dx1 * dy2 == dy1 * dx2
+            && dx1 * dx2 + dy1 * dy2 > 0;
+    }
+
+    std::string& m_buffer;
+    Transformer const& m_transformer;
+    double m_resolution;
+    int m_decimals;
+};
+
+// A ring needs 3 distinct vertices to enclose an area, a closed ring
+// keeps its closing vertex
+template <typename Ring>
+struct min_ring_vertices
+{
+    static const std::size_t value
+        = geometry::closure<Ring>::value == closed ? 4 : 3;
+};
+
+template <typename Writer>
+inline void style_suffix(Writer& writer, std::string const& style, char const* extra)
+{
+    writer.buffer() += "\" style=\"";
+    writer.buffer() += style;
+    writer.buffer() += extra;
+    writer.buffer() += "\"/>";
+}
+
+template <typename Point, typename Writer>
+inline void lod_circle(Point const& point, Writer& writer,
+                       std::string const& style, double size)
+{
+    pixel const p = writer.snap(point);
+    writer.buffer() += "<circle cx=\"";
+    writer.coordinate(p.x);
+    writer.buffer() += "\" cy=\"";
+    writer.coordinate(p.y);
+    writer.buffer() += "\" r=\"";
+    format_number::append(size < 0 ? 5.0 : size, -1, writer.buffer());
+    style_suffix(writer, style, "");
+}
+
+// Rings of a polygon written in a path, an exterior ring collapsed with
+// the rounding removes the whole polygon
+struct lod_polygon_rings
+{
+    template <typename Polygon, typename Writer>
+    static inline bool apply(Polygon const& polygon, Writer& writer)
+    {
+        typedef typename ring_type<Polygon>::type ring_type;
+        static const std::size_t minimum = min_ring_vertices<ring_type>::value;
+
+        if (! writer.range(exterior_ring(polygon), " M ", " L ", minimum))
+        {
+            return false;
+        }
+        writer.buffer() += " z";
+
+        typename interior_return_type<Polygon const>::type
+            rings = interior_rings(polygon);
+        for (typename detail::interior_iterator<Polygon const>::type
+                it = boost::begin(rings); it != boost::end(rings); ++it)
+        {
+            if (writer.range(*it, " M ", " L ", minimum))
+            {
+                writer.buffer() += " z";
+            }
+        }
+        return true;
+    }
+};
+
+}} // namespace detail::svg
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Geometry, typename Tag = typename tag<Geometry>::type>
+struct svg_lod_map
+{
+    BOOST_MPL_ASSERT_MSG
+        (
+            false, NOT_OR_NOT_YET_IMPLEMENTED_FOR_THIS_GEOMETRY_TYPE
+            , (Geometry)
+        );
+};
+
+template <typename Point>
+struct svg_lod_map<Point, point_tag>
+{
+    template <typename Writer>
+    static inline void apply(Point const& point, Writer& writer,
+                             std::string const& style, double size)
+    {
+        detail::svg::lod_circle(point, writer, style, size);
+    }
+};
+
+// Points of a multi point snapped to the same pixel are written once
+template <typename MultiPoint>
+struct svg_lod_map<MultiPoint, multi_point_tag>
+{
+    template <typename Writer>
+    static inline void apply(MultiPoint const& multi_point, Writer& writer,
+                             std::string const& style, double size)
+    {
+        detail::svg::pixel last;
+        bool first = true;
+        for (typename boost::range_iterator<MultiPoint const>::type
+                it = boost::begin(multi_point); it != boost::end(multi_point); ++it)
+        {
+            detail::svg::pixel const p = writer.snap(*it);
+            if (first || ! (p == last))
+            {
+                detail::svg::lod_circle(*it, writer, style, size);
+            }
+            last = p;
+            first = false;
+        }
+    }
+};
+
+template <typename Segment>
+struct svg_lod_map<Segment, segment_tag>
+{
+    template <typename Writer>
+    static inline void apply(Segment const& segment, Writer& writer,
+                             std::string const& style, double )
+    {
+        detail::svg::pixel const p1
+            = writer.snap(detail::indexed_point_view<Segment const, 0>(segment));
+        detail::svg::pixel const p2
+            = writer.snap(detail::indexed_point_view<Segment const, 1>(segment));
+        writer.buffer() += "<line x1=\"";
+        writer.coordinate(p1.x);
+        writer.buffer() += "\" y1=\"";
+        writer.coordinate(p1.y);
+        writer.buffer() += "\" x2=\"";
+        writer.coordinate(p2.x);
+        writer.buffer() += "\" y2=\"";
+        writer.coordinate(p2.y);
+        detail::svg::style_suffix(writer, style, "");
+    }
+};
+
+// The y axis is mirrored, so the upper left corner comes from the maximum
+template <typename Box>
+struct svg_lod_map<Box, box_tag>
+{
+    template <typename Writer>
+    static inline void apply(Box const& box, Writer& writer,
+                             std::string const& style, double )
+    {
+        detail::svg::pixel const p1
+            = writer.snap(detail::indexed_point_view<Box const, 0>(box));
+        detail::svg::pixel const p2
+            = writer.snap(detail::indexed_point_view<Box const, 1>(box));
+        boost::int64_t const x = (std::min)(p1.x, p2.x);
+        boost::int64_t const y = (std::min)(p1.y, p2.y);
+        // Prevent invisible boxes, as write does
+        boost::int64_t const width = (std::max)(boost::int64_t(1), (std::max)(p1.x, p2.x) - x);
+        boost::int64_t const height = (std::max)(boost::int64_t(1), (std::max)(p1.y, p2.y) - y);
+        writer.buffer() += "<rect x=\"";
+        writer.coordinate(x);
+        writer.buffer() += "\" y=\"";
+        writer.coordinate(y);
+        writer.buffer() += "\" width=\"";
+        writer.coordinate(width);
+        writer.buffer() += "\" height=\"";
+        writer.coordinate(height);
+        detail::svg::style_suffix(writer, style, "");
+    }
+};
+
+template <typename Linestring>
+struct svg_lod_map<Linestring, linestring_tag>
+{
+    template <typename Writer>
+    static inline void apply(Linestring const& linestring, Writer& writer,
+                             std::string const& style, double )
+    {
+        std::size_t const start = writer.buffer().size();
+        writer.buffer() += "<polyline points=\"";
+        if (writer.range(linestring, "", " ", 2))
+        {
+            detail::svg::style_suffix(writer, style, ";fill:none");
+        }
+        else
+        {
+            writer.buffer().resize(start);
+        }
+    }
+};
+
+template <typename Ring>
+struct svg_lod_map<Ring, ring_tag>
+{
+    template <typename Writer>
+    static inline void apply(Ring const& ring, Writer& writer,
+                             std::string const& style, double )
+    {
+        std::size_t const start = writer.buffer().size();
+        writer.buffer() += "<polygon points=\"";
+        if (writer.range(ring, "", " ",
+                detail::svg::min_ring_vertices<Ring>::value))
+        {
+            detail::svg::style_suffix(writer, style, "");
+        }
+        else
+        {
+            writer.buffer().resize(start);
+        }
+    }
+};
+
+// All linestrings are written in one path
+template <typename MultiLinestring>
+struct svg_lod_map<MultiLinestring, multi_linestring_tag>
+{
+    template <typename Writer>
+    static inline void apply(MultiLinestring const& multi, Writer& writer,
+                             std::string const& style, double )
+    {
+        std::size_t const start = writer.buffer().size();
+        writer.buffer() += "<path d=\"";
+        bool written = false;
+        for (typename boost::range_iterator<MultiLinestring const>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            written = writer.range(*it, " M ", " L ", 2) || written;
+        }
+        if (written)
+        {
+            detail::svg::style_suffix(writer, style, ";fill:none");
+        }
+        else
+        {
+            writer.buffer().resize(start);
+        }
+    }
+};
+
+template <typename Polygon>
+struct svg_lod_map<Polygon, polygon_tag>
+{
+    template <typename Writer>
+    static inline void apply(Polygon const& polygon, Writer& writer,
+                             std::string const& style, double )
+    {
+        std::size_t const start = writer.buffer().size();
+        writer.buffer() += "<g fill-rule=\"evenodd\"><path d=\"";
+        if (detail::svg::lod_polygon_rings::apply(polygon, writer))
+        {
+            detail::svg::style_suffix(writer, style, "");
+            writer.buffer() += "</g>";
+        }
+        else
+        {
+            writer.buffer().resize(start);
+        }
+    }
+};
+
+// All polygons are written in one path, they don't overlap
+template <typename MultiPolygon>
+struct svg_lod_map<MultiPolygon, multi_polygon_tag>
+{
+    template <typename Writer>
+    static inline void apply(MultiPolygon const& multi, Writer& writer,
+                             std::string const& style, double )
+    {
+        std::size_t const start = writer.buffer().size();
+        writer.buffer() += "<g fill-rule=\"evenodd\"><path d=\"";
+        bool written = false;
+        for (typename boost::range_iterator<MultiPolygon const>::type
+                it = boost::begin(multi); it != boost::end(multi); ++it)
+        {
+            written = detail::svg::lod_polygon_rings::apply(*it, writer) || written;
+        }
+        if (written)
+        {
+            detail::svg::style_suffix(writer, style, "");
+            writer.buffer() += "</g>";
+        }
+        else
+        {
+            writer.buffer().resize(start);
+        }
+    }
+};
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Helper class to create SVG maps of large geometries
+\details Works as svg_mapper, but the geometries are snapped to the pixels
+    of the map while they are written: vertices falling in the same pixel
+    as the previous one or in the middle of a straight line of pixels are
+    dropped, and linestrings and rings smaller than a pixel are not
+    written. The SVG is formatted in a buffer without iostreams, which is
+    written to the output by blocks.
+\tparam Point Point type, for input geometries.
+\tparam Output Type of the output, having a member function
+    write(char const* data, std::size_t size), e.g. svg_file_output or
+    svg_stream_output
+\tparam SameScale Boolean flag indicating if horizontal and vertical scale
+    should be the same. The default value is true
+\ingroup svg
+
+\qbk{[heading Example]
+\code
+std::FILE* file = std::fopen("countries.svg", "wb");
+{
+    svg_lod_mapper<point_type, svg_file_output> mapper(svg_file_output(file), 1000, 1000);
+    mapper.add(countries);
+    mapper.map(countries, "fill:rgb(153,204,0);stroke:black");
+}
+std::fclose(file);
+\endcode
+}
+*/
+template
+<
+    typename Point,
+    typename Output = svg_stream_output,
+    bool SameScale = true
+>
+class svg_lod_mapper : boost::noncopyable
+{
+    typedef typename geometry::select_most_precise
+        <
+            typename coordinate_type<Point>::type,
+            double
+        >::type calculation_type;
+
+    typedef strategy::transform::map_transformer
+        <
+            calculation_type, 2, 2, true, SameScale
+        > transformer_type;
+
+    typedef detail::svg::lod_writer<transformer_type> writer_type;
+
+    // size of the blocks written to the output
+    static const std::size_t block_size = 1 << 16;
+
+public :
+
+    /*!
+    \brief Constructor, initializing the SVG map
+    \param output Output to which the SVG is written
+    \param width Width of the SVG map (in SVG pixels)
+    \param height Height of the SVG map (in SVG pixels)
+    \param resolution Size of the pixels to which the geometries are
+        snapped, in SVG pixels, e.g. 0.5 to keep more details when zooming
+    \param width_height Optional information to increase width and/or height
+    */
+    svg_lod_mapper(Output const& output
+        , double width
+        , double height
+        , double resolution = 1.0
+        , std::string const& width_height = "width=\"100%\" height=\"100%\"")
+        : m_output(output)
+        , m_width(width)
+        , m_height(height)
+        , m_resolution(resolution)
+        , m_width_height(width_height)
+    {
+        assign_inverse(m_bounding_box);
+        m_buffer.reserve(2 * block_size);
+    }
+
+    /*!
+    \brief Destructor, closes the SVG and writes the rest of the buffer
+    */
+    ~svg_lod_mapper()
+    {
+        m_buffer += "</svg>\n";
+        flush();
+    }
+
+    /*!
+    \brief Adds a geometry to the transformation matrix. After doing this,
+        the specified geometry can be mapped fully into the SVG map
+    \tparam Geometry \tparam_geometry
+    \param geometry \param_geometry
+    */
+    template <typename Geometry>
+    void add(Geometry const& geometry)
+    {
+        if (! geometry::is_empty(geometry))
+        {
+            expand(m_bounding_box,
+                return_envelope
+                    <
+                        model::box<Point>
+                    >(geometry));
+        }
+    }
+
+    /*!
+    \brief Maps a geometry into the SVG map using the specified style
+    \tparam Geometry \tparam_geometry
+    \param geometry \param_geometry
+    \param style String containing verbatim SVG style information
+    \param size Optional size (used for SVG points) in SVG pixels. For linestrings,
+        specify linewidth in the SVG style information
+    */
+    template <typename Geometry>
+    void map(Geometry const& geometry, std::string const& style,
+                double size = -1.0)
+    {
+        init_matrix();
+        writer_type writer(m_buffer, *m_matrix, m_resolution);
+        dispatch::svg_lod_map<Geometry>::apply(geometry, writer, style, size);
+        m_buffer += '\n';
+        if (m_buffer.size() >= block_size)
+        {
+            flush();
+        }
+    }
+
+    /*!
+    \brief Adds a text to the SVG map
+    \tparam TextPoint \tparam_point
+    \param point Location of the text (in map units)
+    \param s The text itself, written verbatim
+    \param style String containing verbatim SVG style information, of the text
+    \param offset_x Offset in SVG pixels, defaults to 0
+    \param offset_y Offset in SVG pixels, defaults to 0
+    */
+    template <typename TextPoint>
+    void text(TextPoint const& point, std::string const& s,
+                std::string const& style,
+                double offset_x = 0.0, double offset_y = 0.0)
+    {
+        init_matrix();
+        model::point<double, 2, cs::cartesian> map_point;
+        m_matrix->apply(point, map_point);
+        m_buffer += "<text style=\"";
+        m_buffer += style;
+        m_buffer += "\" x=\"";
+        detail::format_number::append(get<0>(map_point) + offset_x, 2, m_buffer);
+        m_buffer += "\" y=\"";
+        detail::format_number::append(get<1>(map_point) + offset_y, 2, m_buffer);
+        m_buffer += "\">";
+        m_buffer += s;
+        m_buffer += "</text>\n";
+    }
+
+private :
+    void init_matrix()
+    {
+        if (! m_matrix)
+        {
+            m_matrix.reset(new transformer_type(m_bounding_box,
+                            m_width, m_height));
+
+            m_buffer += "<?xml version=\"1.0\" standalone=\"no\"?>\n"
+                "<!DOCTYPE svg PUBLIC \"-//W3C//DTD SVG 1.1//EN\"\n"
+                "\"http://www.w3.org/Graphics/SVG/1.1/DTD/svg11.dtd\">\n"
+                "<svg ";
+            m_buffer += m_width_height;
+            m_buffer += " version=\"1.1\"\n"
+                "xmlns=\"http://www.w3.org/2000/svg\"\n"
+                "xmlns:xlink=\"http://www.w3.org/1999/xlink\">\n";
+        }
+    }
+
+    void flush()
+    {
+        if (! m_buffer.empty())
+        {
+            m_output.write(m_buffer.data(), m_buffer.size());
+            m_buffer.clear();
+        }
+    }
+
+    Output m_output;
+    model::box<Point> m_bounding_box;
+    boost::scoped_ptr<transformer_type> m_matrix;
+    double m_width, m_height;
+    double m_resolution;
+    std::string m_width_height;
+    std::string m_buffer;
+};
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_IO_SVG_LOD_MAPPER_HPP
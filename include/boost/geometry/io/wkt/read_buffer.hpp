@@ -0,0 +1,1213 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_READ_BUFFER_HPP
+#define BOOST_GEOMETRY_IO_WKT_READ_BUFFER_HPP
+
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <string>
+
+#include <boost/cstdint.hpp>
+#include <boost/lexical_cast.hpp>
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/size.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/type_traits/is_floating_point.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/remove_reference.hpp>
+
+#include <boost/geometry/algorithms/assign.hpp>
+#include <boost/geometry/algorithms/clear.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/mutable_range.hpp>
+#include <boost/geometry/core/point_type.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/io/wkt/detail/prefix.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+
+#include <boost/geometry/util/coordinate_cast.hpp>
+#include <boost/geometry/util/range.hpp>
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Exception showing things wrong with WKT parsing of a buffer
+\details Contains the offset of the character at which the parsing failed.
+\ingroup wkt
+*/
+struct read_wkt_buffer_exception : public read_wkt_exception
+{
+    read_wkt_buffer_exception(std::string const& msg,
+                              std::size_t offset,
+                              std::string const& wkt)
+        : read_wkt_exception(msg + " at offset "
+                                + boost::lexical_cast<std::string>(offset),
+                             wkt)
+        , m_offset(offset)
+    {}
+
+    virtual ~read_wkt_buffer_exception() throw() {}
+
+    std::size_t offset() const
+    {
+        return m_offset;
+    }
+
+private :
+    std::size_t m_offset;
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+inline bool is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+inline bool is_alpha(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+inline bool is_space(char c)
+{
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+// The end of a token is a white space, a separator or the end of the buffer
+inline bool is_separator(char c)
+{
+    return is_space(c) || c == ',' || c == '(' || c == ')';
+}
+
+// Powers of ten which are exactly representable in long double on
+// platforms having 64-bit significands
+template <typename T>
+inline T exact_power_of_ten(int n)
+{
+    static const long double powers[] =
+    {
+        1e0L, 1e1L, 1e2L, 1e3L, 1e4L, 1e5L, 1e6L, 1e7L, 1e8L, 1e9L,
+        1e10L, 1e11L, 1e12L, 1e13L, 1e14L, 1e15L, 1e16L, 1e17L, 1e18L, 1e19L,
+        1e20L, 1e21L, 1e22L, 1e23L, 1e24L, 1e25L, 1e26L, 1e27L
+    };
+    return T(powers[n]);
+}
+
+// The greatest power of ten which is exact in T, i.e. 5^n < 2^digits
+template <typename T>
+struct max_exact_power_of_ten
+{
+    static const int digits = std::numeric_limits<T>::digits;
+    static const int value = digits >= 64 ? 27
+                           : digits >= 53 ? 22
+                           : digits >= 24 ? 10
+                           : 0;
+};
+
+/*!
+\brief Internal, converts a decimal number if it can be done exactly
+\details The significand of the number has to be exactly representable in T
+    as well as the power of ten, so the conversion needs one multiplication
+    or division and gives the correctly rounded result (Clinger's fast path).
+    Returns false for other numbers, e.g. with more than 19 significant
+    digits, with big exponents, nan or inf. They are converted by the caller.
+*/
+template <typename T>
+inline bool parse_exact_number(char const* it, char const* end, T& value)
+{
+    bool negative = false;
+    if (it != end && (*it == '-' || *it == '+'))
+    {
+        negative = *it == '-';
+        ++it;
+    }
+
+    boost::uint64_t significand = 0;
+    int digits = 0;
+    int exponent = 0;
+    bool has_digits = false;
+
+    for ( ; it != end && is_digit(*it) ; ++it)
+    {
+        has_digits = true;
+        if (significand == 0 && *it == '0')
+        {
+            continue;
+        }
+        if (++digits > 19)
+        {
+            return false;
+        }
+        significand = significand * 10 + (*it - '0');
+    }
+
+    if (it != end && *it == '.')
+    {
+        for (++it ; it != end && is_digit(*it) ; ++it)
+        {
+            has_digits = true;
+            --exponent;
+            if (significand == 0 && *it == '0')
+            {
+                continue;
+            }
+            if (++digits > 19)
+            {
+                return false;
+            }
+            significand = significand * 10 + (*it - '0');
+        }
+    }
+
+    if (! has_digits)
+    {
+        return false;
+    }
+
+    if (it != end && (*it == 'e' || *it == 'E'))
+    {
+        ++it;
+        bool negative_exponent = false;
+        if (it != end && (*it == '-' || *it == '+'))
+        {
+            negative_exponent = *it == '-';
+            ++it;
+        }
+        if (it == end || ! is_digit(*it))
+        {
+            return false;
+        }
+        int e = 0;
+        for ( ; it != end && is_digit(*it) ; ++it)
+        {
+            if (e < 10000)
+            {
+                e = e * 10 + (*it - '0');
+            }
+        }
+        exponent += negative_exponent ? -e : e;
+    }
+
+    if (it != end)
+    {
+        return false;
+    }
+
+    static const int max_power = max_exact_power_of_ten<T>::value;
+    static const int significand_digits = std::numeric_limits<T>::digits;
+    if (significand_digits < 64
+        && significand > (boost::uint64_t(1) << (significand_digits < 64 ? significand_digits : 0)))
+    {
+        return false;
+    }
+
+    if (significand == 0)
+    {
+        exponent = 0;
+    }
+    if (exponent < -max_power || exponent > max_power)
+    {
+        return false;
+    }
+
+    value = T(significand);
+    if (exponent < 0)
+    {
+        value /= exact_power_of_ten<T>(-exponent);
+    }
+    else if (exponent > 0)
+    {
+        value *= exact_power_of_ten<T>(exponent);
+    }
+
+    if (negative)
+    {
+        value = -value;
+    }
+
+    return true;
+}
+
+/*!
+\brief Internal, converts an integer if it fits in T
+*/
+template <typename T>
+inline bool parse_exact_integer(char const* it, char const* end, T& value)
+{
+    bool negative = false;
+    if (it != end && (*it == '-' || *it == '+'))
+    {
+        negative = *it == '-';
+        ++it;
+    }
+
+    if (it == end || (negative && ! std::numeric_limits<T>::is_signed))
+    {
+        return false;
+    }
+
+    // accumulated as negative number to handle the minimum value
+    T const min_value = std::numeric_limits<T>::is_signed
+                      ? (std::numeric_limits<T>::min)()
+                      : T(0);
+    T result = 0;
+    for ( ; it != end ; ++it)
+    {
+        if (! is_digit(*it))
+        {
+            return false;
+        }
+
+        T const digit = T(*it - '0');
+        if (std::numeric_limits<T>::is_signed)
+        {
+            if (result < (min_value + digit) / 10)
+            {
+                return false;
+            }
+            result = T(result * 10 - digit);
+        }
+        else
+        {
+            if (result > T(((std::numeric_limits<T>::max)() - digit) / 10))
+            {
+                return false;
+            }
+            result = T(result * 10 + digit);
+        }
+    }
+
+    if (std::numeric_limits<T>::is_signed && ! negative)
+    {
+        if (result < -(std::numeric_limits<T>::max)())
+        {
+            return false;
+        }
+        result = -result;
+    }
+
+    value = result;
+    return true;
+}
+
+template
+<
+    typename T,
+    bool IsFloatingPoint = boost::is_floating_point<T>::value,
+    bool IsIntegral = boost::is_integral<T>::value
+>
+struct number_parser
+{
+    static inline bool apply(char const*, char const*, T&)
+    {
+        return false;
+    }
+};
+
+template <typename T>
+struct number_parser<T, true, false>
+{
+    static inline bool apply(char const* it, char const* end, T& value)
+    {
+        return parse_exact_number(it, end, value);
+    }
+};
+
+template <typename T>
+struct number_parser<T, false, true>
+{
+    static inline bool apply(char const* it, char const* end, T& value)
+    {
+        return parse_exact_integer(it, end, value);
+    }
+};
+
+
+/*!
+\brief Internal, single pass reader of characters of a WKT buffer
+\details Nothing is allocated, unless a number can not be converted exactly
+    and coordinate_cast is used or the parsing fails.
+*/
+class buffer_scanner
+{
+public:
+    buffer_scanner(char const* first, char const* last)
+        : m_first(first)
+        , m_record(first)
+        , m_it(first)
+        , m_last(last)
+        , m_measured(false)
+    {}
+
+    // The next geometry starts at the current position. It is used as
+    // context in the error messages.
+    void start_record()
+    {
+        skip_spaces();
+        m_record = m_it;
+    }
+
+    // Moves past the end of the current line
+    void skip_line()
+    {
+        while (m_it != m_last && *m_it != '\n')
+        {
+            ++m_it;
+        }
+        if (m_it != m_last)
+        {
+            ++m_it;
+        }
+    }
+
+    // Measures are read after all coordinates of a point and ignored
+    bool is_measured() const
+    {
+        return m_measured;
+    }
+
+    void set_measured(bool measured)
+    {
+        m_measured = measured;
+    }
+
+    char const* position() const
+    {
+        return m_it;
+    }
+
+    std::size_t offset() const
+    {
+        return std::size_t(m_it - m_first);
+    }
+
+    // Returns the next non-space character or 0 at the end
+    char peek()
+    {
+        skip_spaces();
+        return m_it != m_last ? *m_it : 0;
+    }
+
+    bool is_end()
+    {
+        return peek() == 0;
+    }
+
+    bool check(char c)
+    {
+        if (peek() == c)
+        {
+            ++m_it;
+            return true;
+        }
+        return false;
+    }
+
+    void expect(char c)
+    {
+        if (! check(c))
+        {
+            char const msg[] = { 'E', 'x', 'p', 'e', 'c', 't', 'e', 'd', ' ',
+                                 '\'', c, '\'', '\0' };
+            fail(msg);
+        }
+    }
+
+    void check_end()
+    {
+        if (! is_end())
+        {
+            fail("Too many tokens");
+        }
+    }
+
+    // Consumes the next word if it is equal to the keyword, ignoring case
+    bool check_keyword(const char* keyword)
+    {
+        skip_spaces();
+        char const* it = m_it;
+        for ( ; *keyword != 0 ; ++keyword, ++it)
+        {
+            if (it == m_last || to_upper(*it) != to_upper(*keyword))
+            {
+                return false;
+            }
+        }
+
+        if (it != m_last && is_alpha(*it))
+        {
+            return false;
+        }
+
+        m_it = it;
+        return true;
+    }
+
+    // The next token is a coordinate if it doesn't start with a separator
+    bool is_coordinate()
+    {
+        char const c = peek();
+        return c != 0 && ! is_separator(c);
+    }
+
+    template <typename T>
+    void read_coordinate(T& value)
+    {
+        skip_spaces();
+        char const* const first = m_it;
+        char const* last = m_it;
+        while (last != m_last && ! is_separator(*last))
+        {
+            ++last;
+        }
+
+        if (first == last)
+        {
+            fail("Expected coordinate");
+        }
+
+        if (! number_parser<T>::apply(first, last, value))
+        {
+            try
+            {
+                value = coordinate_cast<T>::apply(std::string(first, last));
+            }
+            catch(std::exception const& e)
+            {
+                fail(e.what());
+            }
+            catch(...)
+            {
+                fail("");
+            }
+        }
+
+        m_it = last;
+    }
+
+    void fail(std::string const& msg) const
+    {
+        std::size_t const context = 100;
+        char const* const last = m_last - m_record > std::ptrdiff_t(context)
+                               ? m_record + context
+                               : m_last;
+        BOOST_THROW_EXCEPTION(read_wkt_buffer_exception(msg, offset(),
+                                                        std::string(m_record, last)));
+    }
+
+private:
+    static char to_upper(char c)
+    {
+        return c >= 'a' && c <= 'z' ? char(c - 'a' + 'A') : c;
+    }
+
+    void skip_spaces()
+    {
+        while (m_it != m_last && is_space(*m_it))
+        {
+            ++m_it;
+        }
+    }
+
+    char const* m_first;
+    char const* m_record;
+    char const* m_it;
+    char const* m_last;
+    bool m_measured;
+};
+
+
+template <typename Point,
+          std::size_t Dimension = 0,
+          std::size_t DimensionCount = geometry::dimension<Point>::value>
+struct buffer_parsing_assigner
+{
+    static inline void apply(buffer_scanner& scanner, Point& point)
+    {
+        typedef typename coordinate_type<Point>::type coordinate_type;
+
+        // Initialize missing coordinates to default constructor (zero)
+        if (scanner.is_coordinate())
+        {
+            coordinate_type value;
+            scanner.read_coordinate(value);
+            set<Dimension>(point, value);
+        }
+        else if (scanner.peek() == '(')
+        {
+            scanner.fail("Expected coordinate");
+        }
+        else
+        {
+            set<Dimension>(point, coordinate_type());
+        }
+
+        buffer_parsing_assigner<Point, Dimension + 1, DimensionCount>::apply(scanner, point);
+    }
+};
+
+template <typename Point, std::size_t DimensionCount>
+struct buffer_parsing_assigner<Point, DimensionCount, DimensionCount>
+{
+    static inline void apply(buffer_scanner& scanner, Point&)
+    {
+        if (scanner.is_measured() && scanner.is_coordinate())
+        {
+            typename coordinate_type<Point>::type measure;
+            scanner.read_coordinate(measure);
+        }
+
+        if (scanner.is_coordinate())
+        {
+            scanner.fail("Too many coordinates");
+        }
+    }
+};
+
+
+// Geometry is a value-type or reference-type
+template <typename Geometry>
+struct buffer_container_appender
+{
+    typedef typename geometry::point_type<Geometry>::type point_type;
+
+    static inline void apply(buffer_scanner& scanner, Geometry out)
+    {
+        scanner.expect('(');
+
+        // Clearing the points keeps the memory of the container
+        range::clear(out);
+        stateful_range_appender<Geometry> appender;
+
+        // Parse points until closing parenthesis
+        while (scanner.peek() != ')' && ! scanner.is_end())
+        {
+            point_type point;
+
+            buffer_parsing_assigner<point_type>::apply(scanner, point);
+
+            bool const is_next_expected = scanner.check(',');
+
+            appender.append(out, point, is_next_expected);
+        }
+
+        scanner.expect(')');
+    }
+};
+
+/*!
+\brief Internal, parses a point from a string like this "(x y)"
+\note used for parsing points and multi-points
+*/
+template <typename P>
+struct buffer_point_parser
+{
+    static inline void apply(buffer_scanner& scanner, P& point)
+    {
+        scanner.expect('(');
+        buffer_parsing_assigner<P>::apply(scanner, point);
+        scanner.expect(')');
+    }
+};
+
+template <typename P>
+struct buffer_noparenthesis_point_parser
+{
+    static inline void apply(buffer_scanner& scanner, P& point)
+    {
+        buffer_parsing_assigner<P>::apply(scanner, point);
+    }
+};
+
+template <typename Geometry>
+struct buffer_linestring_parser
+{
+    static inline void apply(buffer_scanner& scanner, Geometry& geometry)
+    {
+        buffer_container_appender<Geometry&>::apply(scanner, geometry);
+    }
+};
+
+template <typename Ring>
+struct buffer_ring_parser
+{
+    static inline void apply(buffer_scanner& scanner, Ring& ring)
+    {
+        // A ring should look like polygon((x y,x y,x y...))
+        scanner.expect('(');
+        buffer_container_appender<Ring&>::apply(scanner, ring);
+        scanner.expect(')');
+    }
+};
+
+/*!
+\brief Internal, makes room for the element at index count
+\details The container is grown geometrically, so reading n elements
+    resizes it a logarithmic number of times. The parsers shrink it to
+    the number of elements read afterwards.
+*/
+template <typename Container>
+inline void buffer_grow(Container& container, std::size_t count)
+{
+    if (count >= boost::size(container))
+    {
+        std::size_t const size = count < 2 ? 4 : 2 * count;
+        traits::resize<Container>::apply(container, size);
+    }
+}
+
+/*!
+\brief Internal, parses a polygon from a string like this "((x y,x y),(x y,x y))"
+\note Interior rings are parsed in place into the existing elements of the
+    container of interior rings, which is grown geometrically and resized
+    to the number of rings read. So the rings of a polygon read again keep
+    their memory.
+*/
+template <typename Polygon>
+struct buffer_polygon_parser
+{
+    typedef typename ring_return_type<Polygon>::type ring_return_type;
+    typedef buffer_container_appender<ring_return_type> appender;
+    typedef typename boost::remove_reference
+        <
+            typename traits::interior_mutable_type<Polygon>::type
+        >::type interior_type;
+
+    static inline void apply(buffer_scanner& scanner, Polygon& poly)
+    {
+        scanner.expect('(');
+
+        typename traits::interior_mutable_type<Polygon>::type
+            interiors = interior_rings(poly);
+
+        bool is_first = true;
+        std::size_t count = 0;
+
+        // Stop at ")"
+        while (scanner.peek() != ')' && ! scanner.is_end())
+        {
+            if (is_first)
+            {
+                appender::apply(scanner, exterior_ring(poly));
+                is_first = false;
+            }
+            else
+            {
+                buffer_grow(interiors, count);
+                appender::apply(scanner, *(boost::begin(interiors) + count));
+                count++;
+            }
+
+            // Skip "," after ring is parsed
+            scanner.check(',');
+        }
+
+        if (is_first)
+        {
+            range::clear(exterior_ring(poly));
+        }
+        traits::resize<interior_type>::apply(interiors, count);
+
+        scanner.expect(')');
+    }
+};
+
+
+/*!
+\brief Internal, parses the name and the optional Z, M and EMPTY words
+\return false if the geometry is empty
+*/
+template <typename Geometry>
+inline bool buffer_initialize(buffer_scanner& scanner,
+                              const char* geometry_name)
+{
+    if (! scanner.check_keyword(geometry_name))
+    {
+        scanner.fail(std::string("Should start with '") + geometry_name + "'");
+    }
+
+    bool has_empty = false, has_z = false, has_m = false;
+
+    while (true)
+    {
+        if (scanner.check_keyword("Z"))
+        {
+            has_z = true;
+        }
+        else if (scanner.check_keyword("M"))
+        {
+            has_m = true;
+        }
+        else if (scanner.check_keyword("ZM") || scanner.check_keyword("MZ"))
+        {
+            has_z = true;
+            has_m = true;
+        }
+        else if (scanner.check_keyword("EMPTY"))
+        {
+            has_empty = true;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+// Silence warning C4127: conditional expression is constant
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable : 4127)
+#endif
+
+    if (has_z && dimension<Geometry>::type::value < 3)
+    {
+        scanner.fail("Z only allowed for 3 or more dimensions");
+    }
+
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+
+    // M values are ignored at all.
+    scanner.set_measured(has_m);
+
+    return ! has_empty;
+}
+
+
+template <typename Geometry, template<typename> class Parser, typename PrefixPolicy>
+struct buffer_geometry_parser
+{
+    static inline void apply(buffer_scanner& scanner, Geometry& geometry)
+    {
+        // The parsers fill the geometry in place
+        if (buffer_initialize<Geometry>(scanner, PrefixPolicy::apply()))
+        {
+            Parser<Geometry>::apply(scanner, geometry);
+        }
+        else
+        {
+            geometry::clear(geometry);
+        }
+    }
+};
+
+
+template <typename MultiGeometry, template<typename> class Parser, typename PrefixPolicy>
+struct buffer_multi_parser
+{
+    static inline void apply(buffer_scanner& scanner, MultiGeometry& geometry)
+    {
+        std::size_t count = 0;
+
+        if (buffer_initialize<MultiGeometry>(scanner, PrefixPolicy::apply()))
+        {
+            scanner.expect('(');
+
+            // Parse sub-geometries in place into the existing elements
+            while (scanner.peek() != ')' && ! scanner.is_end())
+            {
+                buffer_grow(geometry, count);
+                Parser
+                    <
+                        typename boost::range_value<MultiGeometry>::type
+                    >::apply(scanner, *(boost::begin(geometry) + count));
+                count++;
+
+                // Skip "," after multi-element is parsed
+                scanner.check(',');
+            }
+
+            scanner.expect(')');
+        }
+
+        traits::resize<MultiGeometry>::apply(geometry, count);
+    }
+};
+
+
+template <typename MultiGeometry, typename PrefixPolicy>
+struct buffer_multi_point_parser
+{
+    typedef typename boost::range_value<MultiGeometry>::type point_type;
+
+    static inline void apply(buffer_scanner& scanner, MultiGeometry& geometry)
+    {
+        traits::clear<MultiGeometry>::apply(geometry);
+
+        if (buffer_initialize<MultiGeometry>(scanner, PrefixPolicy::apply()))
+        {
+            scanner.expect('(');
+
+            // If first point definition starts with "(" then parse points as (x y)
+            // otherwise as "x y"
+            bool const using_brackets = scanner.peek() == '(';
+
+            while (scanner.peek() != ')' && ! scanner.is_end())
+            {
+                traits::resize<MultiGeometry>::apply(geometry, boost::size(geometry) + 1);
+
+                if (using_brackets)
+                {
+                    buffer_point_parser<point_type>::apply(scanner,
+                                                           *(boost::end(geometry) - 1));
+                }
+                else
+                {
+                    buffer_noparenthesis_point_parser<point_type>::apply(scanner,
+                                                           *(boost::end(geometry) - 1));
+                }
+
+                // Skip "," after point is parsed
+                scanner.check(',');
+            }
+
+            scanner.expect(')');
+        }
+    }
+};
+
+
+/*!
+\brief Supports box parsing, see box_parser
+\note Only the points which are used are stored
+*/
+template <typename Box>
+struct buffer_box_parser
+{
+    typedef typename point_type<Box>::type point_type;
+
+    static inline void apply(buffer_scanner& scanner, Box& box)
+    {
+        bool should_close = false;
+        if (scanner.check_keyword("POLYGON"))
+        {
+            bool is_empty = false;
+            while (true)
+            {
+                if (scanner.check_keyword("EMPTY"))
+                {
+                    is_empty = true;
+                }
+                else if (! (scanner.check_keyword("Z") || scanner.check_keyword("M")
+                            || scanner.check_keyword("ZM") || scanner.check_keyword("MZ")))
+                {
+                    break;
+                }
+            }
+            if (is_empty)
+            {
+                assign_zero(box);
+                return;
+            }
+            scanner.expect('(');
+            should_close = true;
+        }
+        else if (! scanner.check_keyword("BOX"))
+        {
+            scanner.fail("Should start with 'POLYGON' or 'BOX'");
+        }
+
+        scanner.expect('(');
+
+        // In case of 4 or 5 points, we do not check the other ones, just
+        // take the opposite corner which is always 2
+        point_type first, second, third, other;
+        std::size_t n = 0;
+        while (scanner.peek() != ')' && ! scanner.is_end())
+        {
+            point_type& point = n == 0 ? first
+                              : n == 1 ? second
+                              : n == 2 ? third
+                              : other;
+            buffer_parsing_assigner<point_type>::apply(scanner, point);
+            ++n;
+            scanner.check(',');
+        }
+
+        scanner.expect(')');
+
+        if (should_close)
+        {
+            scanner.expect(')');
+        }
+
+        if (n != 2 && n != 4 && n != 5)
+        {
+            scanner.fail("Box should have 2,4 or 5 points");
+        }
+
+        geometry::detail::assign_point_to_index<min_corner>(first, box);
+        geometry::detail::assign_point_to_index<max_corner>(n == 2 ? second : third, box);
+    }
+};
+
+
+/*!
+\brief Supports segment parsing, see segment_parser
+*/
+template <typename Segment>
+struct buffer_segment_parser
+{
+    typedef typename point_type<Segment>::type point_type;
+
+    static inline void apply(buffer_scanner& scanner, Segment& segment)
+    {
+        if (! scanner.check_keyword("SEGMENT")
+            && ! scanner.check_keyword("LINESTRING"))
+        {
+            scanner.fail("Should start with 'LINESTRING' or 'SEGMENT'");
+        }
+
+        scanner.expect('(');
+
+        point_type points[2];
+        std::size_t n = 0;
+        while (scanner.peek() != ')' && ! scanner.is_end())
+        {
+            point_type point;
+            buffer_parsing_assigner<point_type>::apply(scanner, point);
+            if (n < 2)
+            {
+                points[n] = point;
+            }
+            ++n;
+            scanner.check(',');
+        }
+
+        scanner.expect(')');
+
+        if (n != 2)
+        {
+            scanner.fail("Segment should have 2 points");
+        }
+
+        geometry::detail::assign_point_to_index<0>(points[0], segment);
+        geometry::detail::assign_point_to_index<1>(points[1], segment);
+    }
+};
+
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+
+#ifndef DOXYGEN_NO_DISPATCH
+namespace dispatch
+{
+
+template <typename Tag, typename Geometry>
+struct read_wkt_buffer {};
+
+
+template <typename Point>
+struct read_wkt_buffer<point_tag, Point>
+    : detail::wkt::buffer_geometry_parser
+        <
+            Point,
+            detail::wkt::buffer_point_parser,
+            detail::wkt::prefix_point
+        >
+{};
+
+template <typename L>
+struct read_wkt_buffer<linestring_tag, L>
+    : detail::wkt::buffer_geometry_parser
+        <
+            L,
+            detail::wkt::buffer_linestring_parser,
+            detail::wkt::prefix_linestring
+        >
+{};
+
+template <typename Ring>
+struct read_wkt_buffer<ring_tag, Ring>
+    : detail::wkt::buffer_geometry_parser
+        <
+            Ring,
+            detail::wkt::buffer_ring_parser,
+            detail::wkt::prefix_polygon
+        >
+{};
+
+template <typename Geometry>
+struct read_wkt_buffer<polygon_tag, Geometry>
+    : detail::wkt::buffer_geometry_parser
+        <
+            Geometry,
+            detail::wkt::buffer_polygon_parser,
+            detail::wkt::prefix_polygon
+        >
+{};
+
+template <typename MultiGeometry>
+struct read_wkt_buffer<multi_point_tag, MultiGeometry>
+    : detail::wkt::buffer_multi_point_parser
+        <
+            MultiGeometry,
+            detail::wkt::prefix_multipoint
+        >
+{};
+
+template <typename MultiGeometry>
+struct read_wkt_buffer<multi_linestring_tag, MultiGeometry>
+    : detail::wkt::buffer_multi_parser
+        <
+            MultiGeometry,
+            detail::wkt::buffer_linestring_parser,
+            detail::wkt::prefix_multilinestring
+        >
+{};
+
+template <typename MultiGeometry>
+struct read_wkt_buffer<multi_polygon_tag, MultiGeometry>
+    : detail::wkt::buffer_multi_parser
+        <
+            MultiGeometry,
+            detail::wkt::buffer_polygon_parser,
+            detail::wkt::prefix_multipolygon
+        >
+{};
+
+// Box (Non-OGC)
+template <typename Box>
+struct read_wkt_buffer<box_tag, Box>
+    : detail::wkt::buffer_box_parser<Box>
+{};
+
+// Segment (Non-OGC)
+template <typename Segment>
+struct read_wkt_buffer<segment_tag, Segment>
+    : detail::wkt::buffer_segment_parser<Segment>
+{};
+
+
+} // namespace dispatch
+#endif // DOXYGEN_NO_DISPATCH
+
+
+/*!
+\brief Parses OGC Well-Known Text (\ref WKT) stored in a buffer into a geometry
+\details The characters are read in a single pass and the coordinates are
+    converted in place, without tokenizing the text and allocating strings.
+    The geometry is filled in place, so the memory of a geometry reused for
+    many calls is reused as well. Numbers having at most 19 significant
+    digits and small exponents are converted directly, other ones with
+    the same conversion as read_wkt(). Errors are reported by throwing
+    read_wkt_buffer_exception containing the offset of the error.
+\ingroup wkt
+\tparam Geometry \tparam_geometry
+\param first pointer to the first character of \ref WKT
+\param last pointer past the last character of \ref WKT
+\param geometry \param_geometry output geometry
+*/
+template <typename Geometry>
+inline void read_wkt(char const* first, char const* last, Geometry& geometry)
+{
+    geometry::concepts::check<Geometry>();
+
+    detail::wkt::buffer_scanner scanner(first, last);
+    dispatch::read_wkt_buffer<typename tag<Geometry>::type, Geometry>::apply(scanner, geometry);
+    scanner.check_end();
+}
+
+
+/*!
+\brief Reads consecutive \ref WKT geometries from a buffer
+\details The geometries are separated by white spaces, e.g. stored one per
+    line. Each call of next() reads one geometry, without tokenizing the
+    text and allocating strings. The same geometry may be passed to all
+    calls, then its memory is reused and stays the same for all records.
+    The buffer may be e.g. a memory mapped file, its pages are then read
+    only when the geometries are parsed. Parsing errors are reported by
+    throwing read_wkt_buffer_exception containing the offset of the error
+    in the buffer. Then the reader may continue at the next line.
+\ingroup wkt
+\qbk{
+[heading Example]
+\code
+wkt_reader reader(text.data(), text.data() + text.size());
+polygon_type polygon;
+while (reader.next(polygon))
+{
+    process(polygon);
+}
+\endcode
+}
+*/
+class wkt_reader
+{
+public:
+    /*!
+    \brief Constructs the reader of \ref WKT stored in [first, last)
+    \details The characters are not copied.
+    */
+    wkt_reader(char const* first, char const* last)
+        : m_scanner(first, last)
+    {}
+
+    /*!
+    \brief Reads the next geometry
+    \return false if there are no more geometries
+    */
+    template <typename Geometry>
+    bool next(Geometry& geometry)
+    {
+        geometry::concepts::check<Geometry>();
+
+        m_scanner.start_record();
+        if (m_scanner.is_end())
+        {
+            return false;
+        }
+
+        dispatch::read_wkt_buffer
+            <
+                typename tag<Geometry>::type, Geometry
+            >::apply(m_scanner, geometry);
+        return true;
+    }
+
+    /*!
+    \brief Moves to the next line, e.g. after a parsing error
+    */
+    void skip_line()
+    {
+        m_scanner.skip_line();
+    }
+
+    //! Offset of the current position in the buffer
+    std::size_t offset() const
+    {
+        return m_scanner.offset();
+    }
+
+private:
+    detail::wkt::buffer_scanner m_scanner;
+};
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKT_READ_BUFFER_HPP
@@ -15,7 +15,9 @@
 #define BOOST_GEOMETRY_IO_WKT_WKT_HPP
 
 #include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/read_buffer.hpp>
 #include <boost/geometry/io/wkt/write.hpp>
+#include <boost/geometry/io/wkt/write_buffer.hpp>
 
 // BSG 2011-02-03
 // We don't include stream.hpp by default. That tries to stream anything not known
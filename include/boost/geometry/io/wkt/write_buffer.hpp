@@ -0,0 +1,141 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_IO_WKT_WRITE_BUFFER_HPP
+#define BOOST_GEOMETRY_IO_WKT_WRITE_BUFFER_HPP
+
+#include <string>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/iterator.hpp>
+#include <boost/range/value_type.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+#include <boost/geometry/geometries/concepts/check.hpp>
+
+#include <boost/geometry/io/detail/format_number.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace wkt
+{
+
+/*!
+\brief Internal, output of the WKT writers appending to a string
+\details Used instead of a std::ostream, coordinates are formatted
+    with format_number
+*/
+class string_sink
+{
+public:
+    string_sink(std::string& buffer, int precision)
+        : m_buffer(buffer)
+        , m_precision(precision)
+    {}
+
+    string_sink& operator<<(const char* s)
+    {
+        m_buffer += s;
+        return *this;
+    }
+
+    template <typename T>
+    string_sink& operator<<(T const& value)
+    {
+        format_number::append(value, m_precision, m_buffer);
+        return *this;
+    }
+
+private:
+    std::string& m_buffer;
+    int m_precision;
+};
+
+template <typename Geometry>
+struct default_force_closure
+{
+    // Boost.Geometry, by default, closes polygons explictly, but not rings
+    static const bool value = ! boost::is_same
+        <
+            typename tag<Geometry>::type,
+            ring_tag
+        >::value;
+};
+
+}} // namespace detail::wkt
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Appends the \ref WKT of a geometry to a string
+\details The coordinates are written without a stream and independently
+    of the locale. The memory of the string is reused, e.g. if it is
+    cleared between calls.
+\ingroup wkt
+\tparam Geometry \tparam_geometry
+\param geometry \param_geometry
+\param buffer string to which the \ref WKT is appended
+\param precision maximum number of decimal digits of the coordinates.
+    If it is negative the shortest representation reading back as the
+    same value is written.
+*/
+template <typename Geometry>
+inline void write_wkt(Geometry const& geometry, std::string& buffer,
+                      int precision = -1)
+{
+    concepts::check<Geometry const>();
+
+    detail::wkt::string_sink sink(buffer, precision);
+    dispatch::devarianted_wkt<Geometry>::apply(sink, geometry,
+        detail::wkt::default_force_closure<Geometry>::value);
+}
+
+/*!
+\brief Appends the \ref WKT of all geometries of a range to a string
+\details The geometries are separated by separator, e.g. one geometry
+    per line.
+\ingroup wkt
+\tparam Geometries range of geometries
+\param geometries range of geometries
+\param buffer string to which the \ref WKT is appended
+\param precision maximum number of decimal digits of the coordinates, or
+    negative for the shortest representation reading back as the same value
+\param separator characters written between geometries
+*/
+template <typename Geometries>
+inline void write_wkt_range(Geometries const& geometries, std::string& buffer,
+                            int precision = -1, const char* separator = "\n")
+{
+    typedef typename boost::range_iterator<Geometries const>::type iterator_type;
+    typedef typename boost::range_value<Geometries>::type geometry_type;
+
+    concepts::check<geometry_type const>();
+
+    detail::wkt::string_sink sink(buffer, precision);
+    for (iterator_type it = boost::begin(geometries); it != boost::end(geometries); ++it)
+    {
+        if (it != boost::begin(geometries))
+        {
+            sink << separator;
+        }
+        dispatch::devarianted_wkt<geometry_type>::apply(sink, *it,
+            detail::wkt::default_force_closure<geometry_type>::value);
+    }
+}
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_IO_WKT_WRITE_BUFFER_HPP
@@ -14,6 +14,7 @@
 #define BOOST_GEOMETRY_SRS_PROJECTION_HPP
 
 
+#include <cstddef>
 #include <string>
 
 #include <boost/geometry/algorithms/convert.hpp>
@@ -446,6 +447,8 @@ class projection
     typedef proj_wrapper<Proj, CT> base_t;
 
 public:
+    typedef typename projections::detail::promote_to_double<CT>::type calculation_type;
+
     projection()
     {}
 
@@ -487,6 +490,27 @@ public:
                     projections::detail::inverse_point_projection_policy
                 >::apply(xy, ll, base_t::proj());
     }
+
+    /// Forward projection of count points given as separate arrays of
+    /// longitudes and latitudes in radians. The parameters are read and the
+    /// projection is chosen once for all points. Points which can't be
+    /// projected are set to HUGE_VAL and false is returned.
+    inline bool forward(calculation_type const* lons, calculation_type const* lats,
+                        calculation_type* xs, calculation_type* ys,
+                        std::size_t count) const
+    {
+        return base_t::proj().forward_n(lons, lats, xs, ys, count);
+    }
+
+    /// Inverse projection of count points given as separate arrays of
+    /// x and y, longitudes and latitudes are written in radians. Points which
+    /// can't be projected are set to HUGE_VAL and false is returned.
+    inline bool inverse(calculation_type const* xs, calculation_type const* ys,
+                        calculation_type* lons, calculation_type* lats,
+                        std::size_t count) const
+    {
+        return base_t::proj().inverse_n(xs, ys, lons, lats, count);
+    }
 };
 
 } // namespace projections
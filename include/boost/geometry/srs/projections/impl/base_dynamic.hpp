@@ -13,6 +13,7 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_IMPL_BASE_DYNAMIC_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_IMPL_BASE_DYNAMIC_HPP
 
+#include <cstddef>
 #include <string>
 
 #include <boost/geometry/srs/projections/exception.hpp>
@@ -70,6 +71,16 @@ public :
         }
     }
 
+    /// Forward projection of count points, longitudes and latitudes in radians,
+    /// points which can't be projected are set to HUGE_VAL
+    virtual bool forward_n(CT const* lons, CT const* lats, CT* xs, CT* ys,
+                           std::size_t count) const = 0;
+
+    /// Inverse projection of count points, longitudes and latitudes in radians,
+    /// points which can't be projected are set to HUGE_VAL
+    virtual bool inverse_n(CT const* xs, CT const* ys, CT* lons, CT* lats,
+                           std::size_t count) const = 0;
+
     /// Forward projection using lon / lat and x / y separately
     virtual void fwd(CT const& lp_lon, CT const& lp_lat, CT& xy_x, CT& xy_y) const = 0;
 
@@ -117,6 +128,19 @@ public:
         BOOST_THROW_EXCEPTION(projection_not_invertible_exception(params().id.name));
     }
 
+    // the points are projected by the projection itself, without virtual
+    // calls for each point
+    virtual bool forward_n(CT const* lons, CT const* lats, CT* xs, CT* ys,
+                           std::size_t count) const
+    {
+        return m_proj.forward_n(lons, lats, xs, ys, count);
+    }
+
+    virtual bool inverse_n(CT const* , CT const* , CT* , CT* , std::size_t ) const
+    {
+        BOOST_THROW_EXCEPTION(projection_not_invertible_exception(params().id.name));
+    }
+
     virtual std::string name() const { return m_proj.name(); }
 
     virtual P const& params() const { return m_proj.params(); }
@@ -152,6 +176,12 @@ public:
     {
         this->m_proj.inv(xy_x, xy_y, lp_lon, lp_lat);
     }
+
+    virtual bool inverse_n(CT const* xs, CT const* ys, CT* lons, CT* lats,
+                           std::size_t count) const
+    {
+        return this->m_proj.inverse_n(xs, ys, lons, lats, count);
+    }
 };
 
 } // namespace detail
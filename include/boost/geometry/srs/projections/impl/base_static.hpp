@@ -19,6 +19,7 @@
 #endif // defined(_MSC_VER)
 
 
+#include <cstddef>
 #include <string>
 
 #include <boost/geometry/core/tags.hpp>
@@ -85,6 +86,13 @@ public:
         }
     }
 
+    template <typename T>
+    inline bool forward_n(T const* lons, T const* lats, T* xs, T* ys,
+                          std::size_t count) const
+    {
+        return pj_fwd_n(m_prj, m_par, lons, lats, xs, ys, count);
+    }
+
     template <typename XY, typename LL>
     inline bool inverse(XY const& , LL& ) const
     {
@@ -94,6 +102,15 @@ public:
         return false;
     }
 
+    template <typename T>
+    inline bool inverse_n(T const* , T const* , T* , T* , std::size_t ) const
+    {
+        BOOST_MPL_ASSERT_MSG((false),
+                             PROJECTION_IS_NOT_INVERTABLE,
+                             (Prj));
+        return false;
+    }
+
     inline std::string name() const
     {
         return this->m_par.id.name;
@@ -127,6 +144,13 @@ public :
             return false;
         }
     }
+
+    template <typename T>
+    inline bool inverse_n(T const* xs, T const* ys, T* lons, T* lats,
+                          std::size_t count) const
+    {
+        return pj_inv_n(this->m_prj, this->m_par, xs, ys, lons, lats, count);
+    }
 };
 
 } // namespace detail
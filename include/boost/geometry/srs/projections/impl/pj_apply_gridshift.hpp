@@ -232,22 +232,45 @@ inline bool grid_disjoint(T const& lam, T const& phi,
 }
 
 template <typename T>
-inline pj_gi * find_grid(T const& lam,
-                         T const& phi,
-                         std::vector<pj_gi>::iterator first,
-                         std::vector<pj_gi>::iterator last)
+inline bool grid_matches(T const& lam, T const& phi, pj_gi const& gi)
 {
+    // skip tables that don't match our point at all
+    // and vertical grids
+    return ! grid_disjoint(lam, phi, gi.ct)
+        && gi.format != pj_gi::gtx;
+}
+
+// the first child containing the point, or its child if any
+template <typename T>
+inline pj_gi * find_child_grid(T const& lam,
+                               T const& phi,
+                               pj_gi & parent)
+{
+    std::vector<pj_gi> & children = parent.children;
     pj_gi * gip = NULL;
 
-    for( ; first != last ; ++first )
+    if (parent.children_index.empty())
     {
-        // skip tables that don't match our point at all.
-        if (! grid_disjoint(lam, phi, first->ct))
+        for (std::size_t i = 0 ; i < children.size() ; ++i)
         {
-            // skip vertical grids
-            if (first->format != pj_gi::gtx)
+            if (grid_matches(lam, phi, children[i]))
             {
-                gip = boost::addressof(*first);
+                gip = boost::addressof(children[i]);
+                break;
+            }
+        }
+    }
+    else
+    {
+        // check only the children intersecting the cell of the point
+        pj_gi_index const& index = parent.children_index;
+        std::size_t const c = index.cell(lam, phi);
+        for (std::size_t i = index.offsets[c] ; i < index.offsets[c + 1] ; ++i)
+        {
+            pj_gi & child = children[index.positions[i]];
+            if (grid_matches(lam, phi, child))
+            {
+                gip = boost::addressof(child);
                 break;
             }
         }
@@ -258,7 +281,7 @@ inline pj_gi * find_grid(T const& lam,
         return gip;
 
     // Otherwise use the child, first checking it's children
-    pj_gi * child = find_grid(lam, phi, first->children.begin(), first->children.end());
+    pj_gi * child = find_child_grid(lam, phi, *gip);
     if (child != NULL)
         gip = child;
 
@@ -278,15 +301,10 @@ inline pj_gi * find_grid(T const& lam,
     {
         pj_gi & gi = grids[gridindexes[i]];
 
-        // skip tables that don't match our point at all.
-        if (! grid_disjoint(lam, phi, gi.ct))
+        if (grid_matches(lam, phi, gi))
         {
-            // skip vertical grids
-            if (gi.format != pj_gi::gtx)
-            {
-                gip = boost::addressof(gi);
-                break;
-            }
+            gip = boost::addressof(gi);
+            break;
         }
     }
 
@@ -294,7 +312,7 @@ inline pj_gi * find_grid(T const& lam,
         return gip;
 
     // If we have child nodes, check to see if any of them apply.
-    pj_gi * child = find_grid(lam, phi, gip->children.begin(), gip->children.end());
+    pj_gi * child = find_child_grid(lam, phi, *gip);
     if (child != NULL)
         gip = child;
 
@@ -39,9 +39,13 @@
 #ifndef BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_FWD_HPP
 #define BOOST_GEOMETRY_PROJECTIONS_IMPL_PJ_FWD_HPP
 
+#include <cmath>
+#include <cstddef>
+
 #include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/util/math.hpp>
 
+#include <boost/geometry/srs/projections/exception.hpp>
 #include <boost/geometry/srs/projections/impl/adjlon.hpp>
 #include <boost/geometry/srs/projections/impl/projects.hpp>
 
@@ -95,6 +99,84 @@ inline void pj_fwd(Prj const& prj, P const& par, LL const& ll, XY& xy)
     geometry::set<1>(xy, par.fr_meter * (par.a * y + par.y0));
 }
 
+/* forward projection of count points given as separate arrays of
+   longitudes and latitudes in radians, the parameters are read once,
+   points which can't be projected are set to HUGE_VAL. The loop is
+   resumed after the point throwing projection_exception, so the
+   exception handler is only entered for points which fail. */
+template <typename Prj, typename P, typename T>
+inline bool pj_fwd_n(Prj const& prj, P const& par,
+                     T const* lons, T const* lats, T* xs, T* ys,
+                     std::size_t count)
+{
+    typedef typename P::type calc_t;
+    static const calc_t EPS = 1.0e-12;
+
+    calc_t const half_pi = geometry::math::half_pi<calc_t>();
+    calc_t const lam0 = par.lam0;
+    calc_t const rone_es = par.rone_es;
+    calc_t const a = par.a;
+    calc_t const x0 = par.x0;
+    calc_t const y0 = par.y0;
+    calc_t const fr_meter = par.fr_meter;
+    bool const geoc = par.geoc;
+    bool const over = par.over;
+
+    bool result = true;
+    std::size_t i = 0;
+    while (i < count)
+    {
+        try
+        {
+            for ( ; i < count; ++i)
+            {
+                calc_t lp_lon = lons[i];
+                calc_t lp_lat = lats[i];
+                calc_t const t = geometry::math::abs(lp_lat) - half_pi;
+
+                /* check for forward and latitude or longitude overange */
+                if (t > EPS || geometry::math::abs(lp_lon) > 10.)
+                {
+                    xs[i] = ys[i] = HUGE_VAL;
+                    result = false;
+                    continue;
+                }
+
+                if (geometry::math::abs(t) <= EPS)
+                {
+                    lp_lat = lp_lat < 0. ? -half_pi : half_pi;
+                }
+                else if (geoc)
+                {
+                    lp_lat = atan(rone_es * tan(lp_lat));
+                }
+
+                lp_lon -= lam0;    /* compute del lp.lam */
+                if (! over)
+                {
+                    lp_lon = adjlon(lp_lon); /* post_forward del longitude */
+                }
+
+                calc_t x = 0;
+                calc_t y = 0;
+
+                prj.fwd(lp_lon, lp_lat, x, y);
+
+                xs[i] = fr_meter * (a * x + x0);
+                ys[i] = fr_meter * (a * y + y0);
+            }
+        }
+        catch(projection_exception const&)
+        {
+            xs[i] = ys[i] = HUGE_VAL;
+            result = false;
+            ++i;
+        }
+    }
+
+    return result;
+}
+
 } // namespace detail
 }}} // namespace boost::geometry::projections
 
@@ -49,6 +49,7 @@
 #include <boost/cstdint.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <string>
 #include <vector>
 
@@ -157,6 +158,140 @@ struct pj_gi_load
 
 };
 
+// Extent of a grid, enlarged by the epsilon used in grid_disjoint()
+inline void pj_gi_extent(pj_ctable const& ct,
+                         pj_ctable::lp_t & min, pj_ctable::lp_t & max)
+{
+    double epsilon = (fabs(ct.del.phi)+fabs(ct.del.lam))/10000.0;
+    min.lam = ct.ll.lam - epsilon;
+    min.phi = ct.ll.phi - epsilon;
+    max.lam = ct.ll.lam + (ct.lim.lam-1) * ct.del.lam + epsilon;
+    max.phi = ct.ll.phi + (ct.lim.phi-1) * ct.del.phi + epsilon;
+}
+
+// Regular cells covering the children of a grid. Each cell stores the
+// positions of the children intersecting it in increasing order, so the
+// first child containing a point is the first one of the cell of this
+// point containing it. Points outside are assigned to the border cells.
+struct pj_gi_index
+{
+    pj_gi_index()
+    {
+        ll.lam = ll.phi = 0;
+        del.lam = del.phi = 0;
+        lim.lam = lim.phi = 0;
+    }
+
+    bool empty() const
+    {
+        return offsets.empty();
+    }
+
+    template <typename T>
+    inline std::size_t cell(T const& lam, T const& phi) const
+    {
+        return std::size_t(cell(phi, ll.phi, del.phi, lim.phi)) * lim.lam
+             + cell(lam, ll.lam, del.lam, lim.lam);
+    }
+
+    // positions of the children in cell c are stored in
+    // positions[offsets[c]], ..., positions[offsets[c+1]-1]
+    std::vector<std::size_t> offsets;
+    std::vector<std::size_t> positions;
+
+    inline void swap(pj_gi_index & r)
+    {
+        std::swap(ll, r.ll);
+        std::swap(del, r.del);
+        std::swap(lim, r.lim);
+        offsets.swap(r.offsets);
+        positions.swap(r.positions);
+    }
+
+    template <typename Grids>
+    inline void build(Grids const& grids)
+    {
+        std::size_t const count = grids.size();
+
+        pj_ctable::lp_t min, max;
+        pj_gi_extent(grids[0].ct, min, max);
+        for (std::size_t i = 1 ; i < count ; ++i)
+        {
+            pj_ctable::lp_t mn, mx;
+            pj_gi_extent(grids[i].ct, mn, mx);
+            min.lam = (std::min)(min.lam, mn.lam);
+            min.phi = (std::min)(min.phi, mn.phi);
+            max.lam = (std::max)(max.lam, mx.lam);
+            max.phi = (std::max)(max.phi, mx.phi);
+        }
+
+        boost::int32_t const side = (boost::int32_t)ceil(sqrt(double(count)));
+        ll = min;
+        lim.lam = lim.phi = side;
+        del.lam = (max.lam - min.lam) / side;
+        del.phi = (max.phi - min.phi) / side;
+
+        // count the children of each cell, then store their positions
+        std::vector<std::size_t> counts(std::size_t(side) * side + 1, 0);
+        for (int pass = 0 ; pass < 2 ; ++pass)
+        {
+            for (std::size_t i = 0 ; i < count ; ++i)
+            {
+                pj_ctable::lp_t mn, mx;
+                pj_gi_extent(grids[i].ct, mn, mx);
+                boost::int32_t const lam0 = cell(mn.lam, ll.lam, del.lam, lim.lam);
+                boost::int32_t const lam1 = cell(mx.lam, ll.lam, del.lam, lim.lam);
+                boost::int32_t const phi0 = cell(mn.phi, ll.phi, del.phi, lim.phi);
+                boost::int32_t const phi1 = cell(mx.phi, ll.phi, del.phi, lim.phi);
+                for (boost::int32_t phi = phi0 ; phi <= phi1 ; ++phi)
+                {
+                    for (boost::int32_t lam = lam0 ; lam <= lam1 ; ++lam)
+                    {
+                        std::size_t const c = std::size_t(phi) * side + lam;
+                        if (pass == 0)
+                        {
+                            ++counts[c + 1];
+                        }
+                        else
+                        {
+                            positions[offsets[c] + counts[c]++] = i;
+                        }
+                    }
+                }
+            }
+
+            if (pass == 0)
+            {
+                for (std::size_t c = 1 ; c < counts.size() ; ++c)
+                {
+                    counts[c] += counts[c - 1];
+                }
+                offsets.swap(counts);
+                positions.resize(offsets.back());
+                counts.assign(offsets.size(), 0);
+            }
+        }
+    }
+
+private:
+    template <typename T>
+    static inline boost::int32_t cell(T const& v, double ll, double del,
+                                      boost::int32_t lim)
+    {
+        double const f = del > 0 ? (v - ll) / del : 0;
+        // also for NaN
+        if (! (f > 0))
+            return 0;
+        if (f >= lim)
+            return lim - 1;
+        return (boost::int32_t)f;
+    }
+
+    pj_ctable::lp_t ll;
+    pj_ctable::lp_t del;
+    pj_ctable::ilp_t lim;
+};
+
 struct pj_gi
     : pj_gi_load
 {
@@ -168,11 +303,13 @@ struct pj_gi
     {}
 
     std::vector<pj_gi> children;
+    pj_gi_index children_index; // empty if there are a few children
 
     inline void swap(pj_gi & r)
     {
         pj_gi_load::swap(r);
         children.swap(r.children);
+        children_index.swap(r.children_index);
     }
 };
 
@@ -442,6 +579,27 @@ inline bool pj_gridinfo_load(IStream & is, pj_gi_load & gi)
     }
 }
 
+/************************************************************************/
+/*                      pj_gridinfo_index_children()                    */
+/*                                                                      */
+/*      Index the children of the grids having many of them.            */
+/************************************************************************/
+
+inline void pj_gridinfo_index_children(pj_gi & gi)
+{
+    static const std::size_t min_indexed_count = 8;
+
+    if (gi.children.size() >= min_indexed_count)
+    {
+        gi.children_index.build(gi.children);
+    }
+
+    for (std::size_t i = 0 ; i < gi.children.size() ; ++i)
+    {
+        pj_gridinfo_index_children(gi.children[i]);
+    }
+}
+
 /************************************************************************/
 /*                        pj_gridinfo_parent()                          */
 /*                                                                      */
@@ -613,6 +771,11 @@ inline bool pj_gridinfo_init_ntv2(std::string const& gridname,
         is.seekg(gs_count * 16, std::ios::cur);
     }
 
+    for (std::size_t i = gridinfo_orig_size ; i < gridinfo.size() ; ++i)
+    {
+        pj_gridinfo_index_children(gridinfo[i]);
+    }
+
     return true;
 }
 
@@ -40,7 +40,10 @@
 #define BOOST_GEOMETRY_PROJECTIONS_PJ_INV_HPP
 
 
+#include <cmath>
+#include <cstddef>
 
+#include <boost/geometry/srs/projections/exception.hpp>
 #include <boost/geometry/srs/projections/impl/adjlon.hpp>
 #include <boost/geometry/core/radian_access.hpp>
 #include <boost/geometry/util/math.hpp>
@@ -76,6 +79,64 @@ inline void pj_inv(PRJ const& prj, PAR const& par, XY const& xy, LL& ll)
     geometry::set_from_radian<1>(ll, lat);
 }
 
+/* inverse projection of count points given as separate arrays of x and y,
+   longitudes and latitudes are written in radians, the parameters are read
+   once, points which can't be projected are set to HUGE_VAL. The loop is
+   resumed after the point throwing projection_exception. */
+template <typename PRJ, typename PAR, typename T>
+inline bool pj_inv_n(PRJ const& prj, PAR const& par,
+                     T const* xs, T const* ys, T* lons, T* lats,
+                     std::size_t count)
+{
+    typedef typename PAR::type calc_t;
+    static const calc_t EPS = 1.0e-12;
+
+    calc_t const half_pi = geometry::math::half_pi<calc_t>();
+    calc_t const to_meter = par.to_meter;
+    calc_t const x0 = par.x0;
+    calc_t const y0 = par.y0;
+    calc_t const ra = par.ra;
+    calc_t const lam0 = par.lam0;
+    calc_t const one_es = par.one_es;
+    bool const geoc = par.geoc;
+    bool const over = par.over;
+
+    bool result = true;
+    std::size_t i = 0;
+    while (i < count)
+    {
+        try
+        {
+            for ( ; i < count; ++i)
+            {
+                /* descale and de-offset */
+                calc_t const xy_x = (xs[i] * to_meter - x0) * ra;
+                calc_t const xy_y = (ys[i] * to_meter - y0) * ra;
+                calc_t lon = 0, lat = 0;
+
+                prj.inv(xy_x, xy_y, lon, lat); /* inverse project */
+
+                lon += lam0; /* reduce from del lp.lam */
+                if (!over)
+                    lon = adjlon(lon); /* adjust longitude to CM */
+                if (geoc && geometry::math::abs(geometry::math::abs(lat)-half_pi) > EPS)
+                    lat = atan(one_es * tan(lat));
+
+                lons[i] = lon;
+                lats[i] = lat;
+            }
+        }
+        catch(projection_exception const&)
+        {
+            lons[i] = lats[i] = HUGE_VAL;
+            result = false;
+            ++i;
+        }
+    }
+
+    return result;
+}
+
 } // namespace detail
 }}} // namespace boost::geometry::projections
 
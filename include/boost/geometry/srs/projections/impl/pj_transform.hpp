@@ -53,6 +53,7 @@
 
 #include <cstring>
 #include <cmath>
+#include <vector>
 
 
 namespace boost { namespace geometry { namespace projections
@@ -124,6 +125,11 @@ struct range_wrapper
         : m_range(range)
     {}
 
+    template <typename ZBuffer>
+    range_wrapper(Range & range, ZBuffer & )
+        : m_range(range)
+    {}
+
     range_type & get_range() { return m_range; }
 
     coord_t get_z(std::size_t i) { return detail::get_z(range::at(m_range, i)); }
@@ -140,10 +146,14 @@ struct range_wrapper<Range, true>
     typedef typename boost::range_value<Range>::type point_type;
     typedef typename coordinate_type<point_type>::type coord_t;
 
-    range_wrapper(Range & range)
+    // the z values are stored in the buffer passed by the caller, so it
+    // can be reused for many ranges
+    range_wrapper(Range & range, std::vector<coord_t> & zs)
         : m_range(range)
-        , m_zs(boost::size(range), coord_t(0))
-    {}
+        , m_zs(zs)
+    {
+        m_zs.assign(boost::size(range), coord_t(0));
+    }
 
     range_type & get_range() { return m_range; }
 
@@ -152,7 +162,7 @@ struct range_wrapper<Range, true>
 
 private:
     Range & m_range;
-    std::vector<coord_t> m_zs;
+    std::vector<coord_t> & m_zs;
 };
 
 // -----------------------------------------------------------
@@ -225,13 +235,15 @@ template <
     typename DstPrj2,
     typename Par,
     typename Range,
-    typename Grids
+    typename Grids,
+    typename ZBuffer
 >
 inline bool pj_transform(SrcPrj const& srcprj, Par const& srcdefn,
                          DstPrj2 const& dstprj, Par const& dstdefn,
                          Range & range,
                          Grids const& srcgrids,
-                         Grids const& dstgrids)
+                         Grids const& dstgrids,
+                         ZBuffer & zs)
 
 {
     typedef typename boost::range_value<Range>::type point_type;
@@ -418,7 +430,7 @@ inline bool pj_transform(SrcPrj const& srcprj, Par const& srcdefn,
 /* -------------------------------------------------------------------- */
 /*      Convert datums if needed, and possible.                         */
 /* -------------------------------------------------------------------- */
-    if ( ! pj_datum_transform( srcdefn, dstdefn, range, srcgrids, dstgrids ) )
+    if ( ! pj_datum_transform( srcdefn, dstdefn, range, srcgrids, dstgrids, zs ) )
     {
         result = false;
     }
@@ -604,6 +616,27 @@ inline bool pj_transform(SrcPrj const& srcprj, Par const& srcdefn,
     return result;
 }
 
+template <
+    typename SrcPrj,
+    typename DstPrj2,
+    typename Par,
+    typename Range,
+    typename Grids
+>
+inline bool pj_transform(SrcPrj const& srcprj, Par const& srcdefn,
+                         DstPrj2 const& dstprj, Par const& dstdefn,
+                         Range & range,
+                         Grids const& srcgrids,
+                         Grids const& dstgrids)
+{
+    typedef typename boost::range_value<Range>::type point_type;
+    typedef typename coordinate_type<point_type>::type coord_t;
+
+    std::vector<coord_t> zs;
+    return pj_transform(srcprj, srcdefn, dstprj, dstdefn, range,
+                        srcgrids, dstgrids, zs);
+}
+
 /************************************************************************/
 /*                     pj_geodetic_to_geocentric()                      */
 /************************************************************************/
@@ -880,12 +913,13 @@ inline bool pj_datum_check_error(int err)
 /*      coordinates in radians in the destination datum.                */
 /************************************************************************/
 
-template <typename Par, typename Range, typename Grids>
+template <typename Par, typename Range, typename Grids, typename ZBuffer>
 inline bool pj_datum_transform(Par const& srcdefn,
                                Par const& dstdefn,
                                Range & range,
                                Grids const& srcgrids,
-                               Grids const& dstgrids)
+                               Grids const& dstgrids,
+                               ZBuffer & zs)
 
 {
     typedef typename Par::type calc_t;
@@ -922,12 +956,6 @@ inline bool pj_datum_transform(Par const& srcdefn,
     dst_a = dstdefn.a_orig;
     dst_es = dstdefn.es_orig;
 
-/* -------------------------------------------------------------------- */
-/*      Create a temporary Z array if one is not provided.              */
-/* -------------------------------------------------------------------- */
-    
-    range_wrapper<Range> z_range(range);
-
 /* -------------------------------------------------------------------- */
 /*      If this datum requires grid shifts, then apply it to geodetic   */
 /*      coordinates.                                                    */
@@ -962,6 +990,11 @@ inline bool pj_datum_transform(Par const& srcdefn,
         || dstdefn.datum_type == datum_7param)
     {
 /* -------------------------------------------------------------------- */
+/*      Create a temporary Z array if one is not provided.              */
+/* -------------------------------------------------------------------- */
+        range_wrapper<Range> z_range(range, zs);
+
+/* -------------------------------------------------------------------- */
 /*      Convert to geocentric coordinates.                              */
 /* -------------------------------------------------------------------- */
         int err = pj_geodetic_to_geocentric( src_a, src_es, z_range );
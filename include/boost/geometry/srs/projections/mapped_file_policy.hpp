@@ -0,0 +1,186 @@
+// Boost.Geometry
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_SRS_PROJECTIONS_MAPPED_FILE_POLICY_HPP
+#define BOOST_GEOMETRY_SRS_PROJECTIONS_MAPPED_FILE_POLICY_HPP
+
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <ios>
+#include <string>
+
+#include <boost/interprocess/exceptions.hpp>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+namespace projections { namespace detail
+{
+
+// Input stream reading a read-only memory mapped file, with the subset of
+// the std::ifstream interface used to read the grid files.
+// The pages of the file are read by the system only when they are accessed,
+// e.g. for the headers and the subgrids which are used, and are shared by
+// all processes mapping the same file.
+class mapped_file_istream
+{
+public:
+    mapped_file_istream()
+        : m_data(NULL)
+        , m_size(0)
+        , m_pos(0)
+        , m_gcount(0)
+        , m_fail(false)
+    {}
+
+    void open(std::string const& filename)
+    {
+        namespace ipc = boost::interprocess;
+
+        try
+        {
+            ipc::file_mapping mapping(filename.c_str(), ipc::read_only);
+            ipc::mapped_region region(mapping, ipc::read_only);
+            m_region.swap(region);
+        }
+        catch (ipc::interprocess_exception const&)
+        {
+            m_fail = true;
+            return;
+        }
+
+        m_data = static_cast<char const*>(m_region.get_address());
+        m_size = m_region.get_size();
+        m_pos = 0;
+        m_gcount = 0;
+        m_fail = false;
+    }
+
+    bool is_open() const
+    {
+        return m_data != NULL;
+    }
+
+    mapped_file_istream & read(char * s, std::streamsize n)
+    {
+        m_gcount = 0;
+
+        if (m_fail || ! is_open())
+        {
+            m_fail = true;
+            return *this;
+        }
+
+        std::size_t const count = (std::min)(std::size_t(n), m_size - m_pos);
+        std::memcpy(s, m_data + m_pos, count);
+        m_pos += count;
+        m_gcount = std::streamsize(count);
+
+        if (count < std::size_t(n))
+        {
+            m_fail = true;
+        }
+
+        return *this;
+    }
+
+    mapped_file_istream & seekg(std::streamoff off)
+    {
+        return seek(off);
+    }
+
+    mapped_file_istream & seekg(std::streamoff off, std::ios_base::seekdir dir)
+    {
+        if (dir == std::ios_base::cur)
+        {
+            off += std::streamoff(m_pos);
+        }
+        else if (dir == std::ios_base::end)
+        {
+            off += std::streamoff(m_size);
+        }
+
+        return seek(off);
+    }
+
+    std::streampos tellg() const
+    {
+        return m_fail ? std::streampos(-1) : std::streampos(m_pos);
+    }
+
+    std::streamsize gcount() const
+    {
+        return m_gcount;
+    }
+
+    bool fail() const
+    {
+        return m_fail;
+    }
+
+private:
+    mapped_file_istream & seek(std::streamoff off)
+    {
+        if (! m_fail)
+        {
+            if (off < 0 || std::size_t(off) > m_size)
+            {
+                m_fail = true;
+            }
+            else
+            {
+                m_pos = std::size_t(off);
+            }
+        }
+
+        return *this;
+    }
+
+    boost::interprocess::mapped_region m_region;
+    char const* m_data;
+    std::size_t m_size;
+    std::size_t m_pos;
+    std::streamsize m_gcount;
+    bool m_fail;
+};
+
+}} // namespace projections::detail
+
+
+namespace srs
+{
+
+/*!
+    \brief Stream policy reading the grid files through memory mapping
+    \details May be used instead of ifstream_policy in grids_storage.
+        Only the parts of the files which are used are read, and the
+        pages are shared with the other processes reading the same files.
+    \ingroup projection
+*/
+struct mapped_file_policy
+{
+    typedef projections::detail::mapped_file_istream stream_type;
+
+    static inline void open(stream_type & is, std::string const& gridname)
+    {
+        is.open(gridname);
+    }
+};
+
+} // namespace srs
+
+
+}} // namespace boost::geometry
+
+
+#endif // BOOST_GEOMETRY_SRS_PROJECTIONS_MAPPED_FILE_POLICY_HPP
@@ -12,6 +12,7 @@
 
 
 #include <string>
+#include <vector>
 
 #include <boost/geometry/algorithms/convert.hpp>
 
@@ -288,6 +289,21 @@ private:
     OutGeometry & m_out;
 };
 
+// Buffer of z values used by pj_transform() for 2D points if datums are
+// transformed. The same buffer is used for all ranges of a geometry.
+template <typename Geometry, typename CT>
+struct transform_z_buffer
+{
+    typedef std::vector
+        <
+            typename select_most_precise
+                <
+                    typename geometry::coordinate_type<Geometry>::type,
+                    CT
+                >::type
+        > type;
+};
+
 template <typename CT>
 struct transform_range
 {
@@ -302,6 +318,23 @@ struct transform_range
                              Proj2 const& proj2, Par2 const& par2,
                              RangeIn const& in, RangeOut & out,
                              Grids const& grids1, Grids const& grids2)
+    {
+        typename transform_z_buffer<RangeOut, CT>::type zs;
+        return apply(proj1, par1, proj2, par2, in, out, grids1, grids2, zs);
+    }
+
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename RangeIn, typename RangeOut,
+        typename Grids, typename ZBuffer
+    >
+    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                             Proj2 const& proj2, Par2 const& par2,
+                             RangeIn const& in, RangeOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             ZBuffer & zs)
     {
         // NOTE: this has to be consistent with pj_transform()
         bool const input_angles = !par1.is_geocent && par1.is_latlong;
@@ -311,7 +344,7 @@ struct transform_range
         bool res = true;
         try
         {
-            res = pj_transform(proj1, par1, proj2, par2, wrapper.get(), grids1, grids2);
+            res = pj_transform(proj1, par1, proj2, par2, wrapper.get(), grids1, grids2, zs);
         }
         catch (projection_exception const&)
         {
@@ -328,7 +361,7 @@ struct transform_range
     }
 };
 
-template <typename Policy>
+template <typename Policy, typename CT>
 struct transform_multi
 {
     template
@@ -342,6 +375,23 @@ struct transform_multi
                              Proj2 const& proj2, Par2 const& par2,
                              MultiIn const& in, MultiOut & out,
                              Grids const& grids1, Grids const& grids2)
+    {
+        typename transform_z_buffer<MultiOut, CT>::type zs;
+        return apply(proj1, par1, proj2, par2, in, out, grids1, grids2, zs);
+    }
+
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename MultiIn, typename MultiOut,
+        typename Grids, typename ZBuffer
+    >
+    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                             Proj2 const& proj2, Par2 const& par2,
+                             MultiIn const& in, MultiOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             ZBuffer & zs)
     {
         if (! same_object(in, out))
             range::resize(out, boost::size(in));
@@ -349,7 +399,7 @@ struct transform_multi
         return apply(proj1, par1, proj2, par2,
                      boost::begin(in), boost::end(in),
                      boost::begin(out),
-                     grids1, grids2);
+                     grids1, grids2, zs);
     }
 
 private:
@@ -358,17 +408,18 @@ private:
         typename Proj1, typename Par1,
         typename Proj2, typename Par2,
         typename InIt, typename OutIt,
-        typename Grids
+        typename Grids, typename ZBuffer
     >
     static inline bool apply(Proj1 const& proj1, Par1 const& par1,
                              Proj2 const& proj2, Par2 const& par2,
                              InIt in_first, InIt in_last, OutIt out_first,
-                             Grids const& grids1, Grids const& grids2)
+                             Grids const& grids1, Grids const& grids2,
+                             ZBuffer & zs)
     {
         bool res = true;
         for ( ; in_first != in_last ; ++in_first, ++out_first )
         {
-            if ( ! Policy::apply(proj1, par1, proj2, par2, *in_first, *out_first, grids1, grids2) )
+            if ( ! Policy::apply(proj1, par1, proj2, par2, *in_first, *out_first, grids1, grids2, zs) )
             {
                 res = false;
             }
@@ -499,7 +550,7 @@ struct transform<Linestring, CT, linestring_tag>
 
 template <typename MultiLinestring, typename CT>
 struct transform<MultiLinestring, CT, multi_linestring_tag>
-    : transform_multi<transform_range<CT> >
+    : transform_multi<transform_range<CT>, CT>
 {};
 
 template <typename Ring, typename CT>
@@ -521,6 +572,23 @@ struct transform<Polygon, CT, polygon_tag>
                              Proj2 const& proj2, Par2 const& par2,
                              PolygonIn const& in, PolygonOut & out,
                              Grids const& grids1, Grids const& grids2)
+    {
+        typename transform_z_buffer<PolygonOut, CT>::type zs;
+        return apply(proj1, par1, proj2, par2, in, out, grids1, grids2, zs);
+    }
+
+    template
+    <
+        typename Proj1, typename Par1,
+        typename Proj2, typename Par2,
+        typename PolygonIn, typename PolygonOut,
+        typename Grids, typename ZBuffer
+    >
+    static inline bool apply(Proj1 const& proj1, Par1 const& par1,
+                             Proj2 const& proj2, Par2 const& par2,
+                             PolygonIn const& in, PolygonOut & out,
+                             Grids const& grids1, Grids const& grids2,
+                             ZBuffer & zs)
     {
         bool r1 = transform_range
                     <
@@ -528,14 +596,14 @@ struct transform<Polygon, CT, polygon_tag>
                     >::apply(proj1, par1, proj2, par2,
                              geometry::exterior_ring(in),
                              geometry::exterior_ring(out),
-                             grids1, grids2);
+                             grids1, grids2, zs);
         bool r2 = transform_multi
                     <
-                        transform_range<CT>
+                        transform_range<CT>, CT
                      >::apply(proj1, par1, proj2, par2,
                               geometry::interior_rings(in),
                               geometry::interior_rings(out),
-                              grids1, grids2);
+                              grids1, grids2, zs);
         return r1 && r2;
     }
 };
@@ -549,7 +617,8 @@ struct transform<MultiPolygon, CT, multi_polygon_tag>
                     typename boost::range_value<MultiPolygon>::type,
                     CT,
                     polygon_tag
-                >
+                >,
+            CT
         >
 {};
 
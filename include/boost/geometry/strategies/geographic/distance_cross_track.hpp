@@ -118,6 +118,76 @@ public :
                                   m_spheroid)).distance;
     }
 
+    /*!
+    \brief Quantities of a segment independent of the point, e.g. its
+        length and azimuths, calculated once by prepare() and used for
+        the distances of many points to the same segment
+    */
+    template <typename CT>
+    struct prepared_segment
+    {
+        prepared_segment()
+            : lon1(0), lat1(0), lon2(0), lat2(0)
+            , meridian_not_crossing_pole(false)
+            , meridian_crossing_pole(false)
+            , equatorial(false)
+            , earth_radius(0)
+            , d3(0), a12(0), a21(0)
+        {}
+
+        // endpoints in radian, ordered by longitude
+        CT lon1;
+        CT lat1;
+        CT lon2;
+        CT lat2;
+
+        bool meridian_not_crossing_pole;
+        bool meridian_crossing_pole;
+        bool equatorial;
+
+        CT earth_radius;
+        CT d3; // length
+        CT a12; // azimuth at p1
+        CT a21; // azimuth at p2 towards p1
+    };
+
+    template <typename PointOfSegment>
+    inline prepared_segment
+        <
+            typename return_type<PointOfSegment, PointOfSegment>::type
+        >
+    prepare(PointOfSegment const& sp1, PointOfSegment const& sp2) const
+    {
+        typedef typename geometry::detail::cs_angular_units
+            <
+                PointOfSegment
+            >::type units_type;
+        typedef typename return_type
+            <
+                PointOfSegment, PointOfSegment
+            >::type calc_t;
+
+        return prepare_segment
+            (
+                math::as_radian<units_type>(calc_t(get<0>(sp1))),
+                math::as_radian<units_type>(calc_t(get<1>(sp1))),
+                math::as_radian<units_type>(calc_t(get<0>(sp2))),
+                math::as_radian<units_type>(calc_t(get<1>(sp2))),
+                m_spheroid
+            );
+    }
+
+    template <typename Point, typename CT>
+    inline CT apply(Point const& p, prepared_segment<CT> const& segment) const
+    {
+        typedef typename geometry::detail::cs_angular_units<Point>::type units_type;
+
+        return (apply_prepared(segment,
+                               math::as_radian<units_type>(CT(get<0>(p))),
+                               math::as_radian<units_type>(CT(get<1>(p))),
+                               m_spheroid)).distance;
+    }
+
     // points on a meridian not crossing poles
     template <typename CT>
     inline CT vertical_or_meridian(CT lat1, CT lat2) const
@@ -205,39 +275,20 @@ private :
         return g4 - pi/2;
     }
 
-    template <typename Units, typename CT>
-    result_distance_point_segment<CT>
-    static inline apply(CT lon1, CT lat1, //p1
-                        CT lon2, CT lat2, //p2
-                        CT lon3, CT lat3, //query point p3
-                        Spheroid const& spheroid)
+    template <typename CT>
+    static inline prepared_segment<CT>
+    prepare_segment(CT lon1, CT lat1, //p1
+                    CT lon2, CT lat2, //p2
+                    Spheroid const& spheroid)
     {
-        typedef typename FormulaPolicy::template inverse<CT, true, true, false, true, true>
-                inverse_distance_azimuth_quantities_type;
-        typedef typename FormulaPolicy::template inverse<CT, false, true, false, false, false>
-                inverse_azimuth_type;
         typedef typename FormulaPolicy::template inverse<CT, false, true, true, false, false>
                 inverse_azimuth_reverse_type;
-        typedef typename FormulaPolicy::template direct<CT, true, false, false, false>
-                direct_distance_type;
 
-        CT const earth_radius = geometry::formula::mean_radius<CT>(spheroid);
-
-        result_distance_point_segment<CT> result;
-
-        // Constants
-        //CT const f = geometry::formula::flattening<CT>(spheroid);
         CT const pi = math::pi<CT>();
-        CT const half_pi = pi / CT(2);
         CT const c0 = CT(0);
 
-        // Convert to radians
-        lon1 = math::as_radian<Units>(lon1);
-        lat1 = math::as_radian<Units>(lat1);
-        lon2 = math::as_radian<Units>(lon2);
-        lat2 = math::as_radian<Units>(lat2);
-        lon3 = math::as_radian<Units>(lon3);
-        lat3 = math::as_radian<Units>(lat3);
+        prepared_segment<CT> segment;
+        segment.earth_radius = geometry::formula::mean_radius<CT>(spheroid);
 
         if (lon1 > lon2)
         {
@@ -250,8 +301,6 @@ private :
         std::cout << "," << lat1 * math::r2d<CT>();
         std::cout << "),(" << lon2 * math::r2d<CT>();
         std::cout << "," << lat2 * math::r2d<CT>();
-        std::cout << ")\np=(" << lon3 * math::r2d<CT>();
-        std::cout << "," << lat3 * math::r2d<CT>();
         std::cout << ")" << std::endl;
 #endif
 
@@ -263,14 +312,106 @@ private :
         typedef typename formula::meridian_inverse<CT>
                                             meridian_inverse;
 
-        bool meridian_not_crossing_pole =
+        segment.meridian_not_crossing_pole =
               meridian_inverse::meridian_not_crossing_pole
                                                             (lat1, lat2, diff);
 
-        bool meridian_crossing_pole =
+        segment.meridian_crossing_pole =
               meridian_inverse::meridian_crossing_pole(diff);
 
-        if (math::equals(lat1, c0) && math::equals(lat2, c0) && !meridian_crossing_pole)
+        segment.equatorial = math::equals(lat1, c0) && math::equals(lat2, c0)
+                          && ! segment.meridian_crossing_pole;
+
+        if ( ! segment.equatorial
+          && (segment.meridian_not_crossing_pole || segment.meridian_crossing_pole)
+          && std::abs(lat1) > std::abs(lat2))
+        {
+#ifdef BOOST_GEOMETRY_DEBUG_GEOGRAPHIC_CROSS_TRACK
+            std::cout << "Meridian segment not crossing pole" << std::endl;
+#endif
+            std::swap(lat1,lat2);
+        }
+
+        segment.lon1 = lon1;
+        segment.lat1 = lat1;
+        segment.lon2 = lon2;
+        segment.lat2 = lat2;
+
+        if (segment.equatorial || segment.meridian_crossing_pole)
+        {
+            return segment;
+        }
+
+        segment.d3 = geometry::strategy::distance::geographic<FormulaPolicy, Spheroid, CT>
+                ::apply(lon1, lat1, lon2, lat2, spheroid);
+
+        if (geometry::math::equals(segment.d3, c0))
+        {
+            return segment;
+        }
+
+        // Compute a12 (GEO)
+        geometry::formula::result_inverse<CT> res12 =
+                inverse_azimuth_reverse_type::apply(lon1, lat1, lon2, lat2, spheroid);
+        segment.a12 = res12.azimuth;
+        segment.a21 = res12.reverse_azimuth - pi;
+
+        return segment;
+    }
+
+    template <typename Units, typename CT>
+    result_distance_point_segment<CT>
+    static inline apply(CT lon1, CT lat1, //p1
+                        CT lon2, CT lat2, //p2
+                        CT lon3, CT lat3, //query point p3
+                        Spheroid const& spheroid)
+    {
+        // Convert to radians
+        lon1 = math::as_radian<Units>(lon1);
+        lat1 = math::as_radian<Units>(lat1);
+        lon2 = math::as_radian<Units>(lon2);
+        lat2 = math::as_radian<Units>(lat2);
+        lon3 = math::as_radian<Units>(lon3);
+        lat3 = math::as_radian<Units>(lat3);
+
+        return apply_prepared(prepare_segment(lon1, lat1, lon2, lat2, spheroid),
+                              lon3, lat3, spheroid);
+    }
+
+    template <typename CT>
+    result_distance_point_segment<CT>
+    static inline apply_prepared(prepared_segment<CT> const& segment,
+                                 CT lon3, CT lat3, //query point p3 in radian
+                                 Spheroid const& spheroid)
+    {
+        typedef typename FormulaPolicy::template inverse<CT, true, true, false, true, true>
+                inverse_distance_azimuth_quantities_type;
+        typedef typename FormulaPolicy::template inverse<CT, false, true, false, false, false>
+                inverse_azimuth_type;
+        typedef typename FormulaPolicy::template direct<CT, true, false, false, false>
+                direct_distance_type;
+
+        CT const lon1 = segment.lon1;
+        CT const lat1 = segment.lat1;
+        CT const lon2 = segment.lon2;
+        CT const lat2 = segment.lat2;
+        CT const earth_radius = segment.earth_radius;
+
+        result_distance_point_segment<CT> result;
+
+        // Constants
+        //CT const f = geometry::formula::flattening<CT>(spheroid);
+        CT const pi = math::pi<CT>();
+        CT const half_pi = pi / CT(2);
+        CT const c0 = CT(0);
+
+#ifdef BOOST_GEOMETRY_DEBUG_GEOGRAPHIC_CROSS_TRACK
+        std::cout << "p=(" << lon3 * math::r2d<CT>();
+        std::cout << "," << lat3 * math::r2d<CT>();
+        std::cout << ")" << std::endl;
+#endif
+
+        if (segment.equatorial)
         {
 #ifdef BOOST_GEOMETRY_DEBUG_GEOGRAPHIC_CROSS_TRACK
             std::cout << "Equatorial segment" << std::endl;
@@ -292,15 +433,7 @@ private :
             return non_iterative_case(lon3, lat1, lon3, lat3, spheroid);
         }
 
-        if ( (meridian_not_crossing_pole || meridian_crossing_pole ) && std::abs(lat1) > std::abs(lat2))
-        {
-#ifdef BOOST_GEOMETRY_DEBUG_GEOGRAPHIC_CROSS_TRACK
-            std::cout << "Meridian segment not crossing pole" << std::endl;
-#endif
-            std::swap(lat1,lat2);
-        }
-
-        if (meridian_crossing_pole)
+        if (segment.meridian_crossing_pole)
         {
 #ifdef BOOST_GEOMETRY_DEBUG_GEOGRAPHIC_CROSS_TRACK
             std::cout << "Meridian segment crossing pole" << std::endl;
@@ -327,8 +460,7 @@ private :
         CT d1 = geometry::strategy::distance::geographic<FormulaPolicy, Spheroid, CT>
                 ::apply(lon1, lat1, lon3, lat3, spheroid);
 
-        CT d3 = geometry::strategy::distance::geographic<FormulaPolicy, Spheroid, CT>
-                ::apply(lon1, lat1, lon2, lat2, spheroid);
+        CT const d3 = segment.d3;
 
         if (geometry::math::equals(d3, c0))
         {
@@ -342,16 +474,13 @@ private :
         CT d2 = geometry::strategy::distance::geographic<FormulaPolicy, Spheroid, CT>
                 ::apply(lon2, lat2, lon3, lat3, spheroid);
 
-        // Compute a12 (GEO)
-        geometry::formula::result_inverse<CT> res12 =
-                inverse_azimuth_reverse_type::apply(lon1, lat1, lon2, lat2, spheroid);
-        CT a12 = res12.azimuth;
+        CT const a12 = segment.a12;
         CT a13 = inverse_azimuth_type::apply(lon1, lat1, lon3, lat3, spheroid).azimuth;
 
         CT a312 = a13 - a12;
 
         // TODO: meridian case optimization
-        if (geometry::math::equals(a312, c0) && meridian_not_crossing_pole)
+        if (geometry::math::equals(a312, c0) && segment.meridian_not_crossing_pole)
         {
             boost::tuple<CT,CT> minmax_elem = boost::minmax(lat1, lat2);
             if (lat3 >= minmax_elem.template get<0>() &&
@@ -384,7 +513,7 @@ private :
             return non_iterative_case(lon1, lat1, lon3, lat3, spheroid);
         }
 
-        CT a21 = res12.reverse_azimuth - pi;
+        CT const a21 = segment.a21;
         CT a23 = inverse_azimuth_type::apply(lon2, lat2, lon3, lat3, spheroid).azimuth;
 
         CT a321 = a23 - a21;
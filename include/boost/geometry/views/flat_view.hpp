@@ -0,0 +1,619 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_GEOMETRY_VIEWS_FLAT_VIEW_HPP
+#define BOOST_GEOMETRY_VIEWS_FLAT_VIEW_HPP
+
+#include <cstddef>
+
+#include <boost/cstdint.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/mpl/int.hpp>
+#include <boost/static_assert.hpp>
+
+#include <boost/geometry/core/access.hpp>
+#include <boost/geometry/core/closure.hpp>
+#include <boost/geometry/core/coordinate_dimension.hpp>
+#include <boost/geometry/core/coordinate_system.hpp>
+#include <boost/geometry/core/coordinate_type.hpp>
+#include <boost/geometry/core/cs.hpp>
+#include <boost/geometry/core/exterior_ring.hpp>
+#include <boost/geometry/core/interior_rings.hpp>
+#include <boost/geometry/core/point_order.hpp>
+#include <boost/geometry/core/ring_type.hpp>
+#include <boost/geometry/core/tag.hpp>
+#include <boost/geometry/core/tags.hpp>
+
+
+namespace boost { namespace geometry
+{
+
+/*!
+\brief Point of a flat coordinate buffer
+\details The coordinates of the points are stored one after another,
+    e.g. x0 y0 x1 y1... The point has the layout of the coordinates of one
+    point, the flat views present the buffer as an array of these points
+    so the algorithms iterate through the buffer with pointers.
+\tparam CoordinateType type of the coordinates stored
+\tparam DimensionCount number of coordinates accessed
+\tparam CoordinateSystem coordinate system, e.g. cs::cartesian
+\tparam Stride number of coordinates stored per point, e.g. 3 to access
+    x and y of points stored with x, y and z
+*/
+template
+<
+    typename CoordinateType = double,
+    std::size_t DimensionCount = 2,
+    typename CoordinateSystem = cs::cartesian,
+    std::size_t Stride = DimensionCount
+>
+struct flat_point
+{
+    BOOST_STATIC_ASSERT(DimensionCount >= 1 && DimensionCount <= Stride);
+
+    typedef CoordinateType coordinate_type;
+    static const std::size_t stride = Stride;
+
+    template <std::size_t K>
+    CoordinateType const& get() const
+    {
+        BOOST_STATIC_ASSERT(K < DimensionCount);
+        return m_values[K];
+    }
+
+    template <std::size_t K>
+    void set(CoordinateType const& value)
+    {
+        BOOST_STATIC_ASSERT(K < DimensionCount);
+        m_values[K] = value;
+    }
+
+    CoordinateType m_values[Stride];
+};
+
+
+#ifndef DOXYGEN_NO_DETAIL
+namespace detail { namespace flat
+{
+
+// The buffers of the coordinates and of the ring offsets of polygons
+template <typename CoordinateType, typename Offset>
+struct buffers
+{
+    buffers()
+        : coordinates(0)
+        , ring_offsets(0)
+    {}
+
+    buffers(CoordinateType const* c, Offset const* r)
+        : coordinates(c)
+        , ring_offsets(r)
+    {}
+
+    CoordinateType const* coordinates;
+    Offset const* ring_offsets;
+};
+
+// Points following each other in the buffer
+template <typename Point>
+class points_view
+{
+    typedef typename Point::coordinate_type coordinate_type;
+
+    BOOST_STATIC_ASSERT(sizeof(Point) == Point::stride * sizeof(coordinate_type));
+
+public:
+    typedef Point const* iterator;
+    typedef Point const* const_iterator;
+
+    points_view()
+        : m_first(0)
+        , m_count(0)
+    {}
+
+    points_view(coordinate_type const* first, std::size_t count)
+        : m_first(reinterpret_cast<Point const*>(first))
+        , m_count(count)
+    {}
+
+    // Points from index begin to end, used by the multi-geometries
+    template <typename Offset>
+    points_view(buffers<coordinate_type, Offset> const& b, Offset begin, Offset end)
+        : m_first(reinterpret_cast<Point const*>(b.coordinates) + begin)
+        , m_count(std::size_t(end - begin))
+    {}
+
+    const_iterator begin() const { return m_first; }
+    const_iterator end() const { return m_first + m_count; }
+    std::size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+
+private:
+    Point const* m_first;
+    std::size_t m_count;
+};
+
+// Refers to the buffers rather than to the view, the views are returned
+// by value and may be destroyed before their iterators
+template <typename Part, typename CoordinateType, typename Offset>
+class part_iterator
+    : public boost::iterator_facade
+        <
+            part_iterator<Part, CoordinateType, Offset>,
+            Part, // value type
+            boost::random_access_traversal_tag,
+            Part // reference type
+        >
+{
+public:
+    typedef std::ptrdiff_t difference_type;
+
+    part_iterator()
+        : m_offsets(0)
+    {}
+
+    part_iterator(buffers<CoordinateType, Offset> const& b, Offset const* offsets)
+        : m_buffers(b)
+        , m_offsets(offsets)
+    {}
+
+private:
+    friend class boost::iterator_core_access;
+
+    inline Part dereference() const
+    {
+        return Part(m_buffers, m_offsets[0], m_offsets[1]);
+    }
+
+    inline void increment() { ++m_offsets; }
+    inline void decrement() { --m_offsets; }
+    inline void advance(difference_type n) { m_offsets += n; }
+
+    inline difference_type distance_to(part_iterator const& other) const
+    {
+        return other.m_offsets - m_offsets;
+    }
+
+    inline bool equal(part_iterator const& other) const
+    {
+        return m_offsets == other.m_offsets;
+    }
+
+    buffers<CoordinateType, Offset> m_buffers;
+    Offset const* m_offsets;
+};
+
+// Part i consists of the elements from offsets[i] to offsets[i + 1]
+template <typename Part, typename CoordinateType, typename Offset>
+class parts_view
+{
+public:
+    typedef part_iterator<Part, CoordinateType, Offset> iterator;
+    typedef part_iterator<Part, CoordinateType, Offset> const_iterator;
+
+    parts_view()
+        : m_offsets(0)
+        , m_count(0)
+    {}
+
+    parts_view(buffers<CoordinateType, Offset> const& b,
+               Offset const* offsets, std::size_t count)
+        : m_buffers(b)
+        , m_offsets(offsets)
+        , m_count(count)
+    {}
+
+    Part at(std::size_t i) const
+    {
+        return Part(m_buffers, m_offsets[i], m_offsets[i + 1]);
+    }
+
+    const_iterator begin() const { return const_iterator(m_buffers, m_offsets); }
+    const_iterator end() const { return const_iterator(m_buffers, m_offsets + m_count); }
+    std::size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+
+private:
+    buffers<CoordinateType, Offset> m_buffers;
+    Offset const* m_offsets;
+    std::size_t m_count;
+};
+
+}} // namespace detail::flat
+#endif // DOXYGEN_NO_DETAIL
+
+
+/*!
+\brief Linestring presenting the points of a flat coordinate buffer,
+    used directly by the algorithms
+\details The coordinates are not copied and must outlive the view.
+\qbk{
+[heading Example]
+\code
+double const coordinates[] = { 0, 0, 3, 4, 3, 5 };
+flat_linestring_view<> view(coordinates, 3);
+double const len = boost::geometry::length(view); // 6
+\endcode
+}
+*/
+template <typename Point = flat_point<> >
+class flat_linestring_view
+    : public detail::flat::points_view<Point>
+{
+    typedef detail::flat::points_view<Point> base_type;
+    typedef typename Point::coordinate_type coordinate_type;
+
+public:
+    flat_linestring_view()
+    {}
+
+    flat_linestring_view(coordinate_type const* coordinates, std::size_t count)
+        : base_type(coordinates, count)
+    {}
+
+    template <typename Offset>
+    flat_linestring_view(detail::flat::buffers<coordinate_type, Offset> const& b,
+                         Offset begin, Offset end)
+        : base_type(b, begin, end)
+    {}
+};
+
+/*!
+\brief Ring presenting the points of a flat coordinate buffer
+\details The orientation and the closure of the stored ring are defined
+    by ClockWise and Closed.
+*/
+template <typename Point = flat_point<>, bool ClockWise = true, bool Closed = true>
+class flat_ring_view
+    : public detail::flat::points_view<Point>
+{
+    typedef detail::flat::points_view<Point> base_type;
+    typedef typename Point::coordinate_type coordinate_type;
+
+public:
+    flat_ring_view()
+    {}
+
+    flat_ring_view(coordinate_type const* coordinates, std::size_t count)
+        : base_type(coordinates, count)
+    {}
+
+    template <typename Offset>
+    flat_ring_view(detail::flat::buffers<coordinate_type, Offset> const& b,
+                   Offset begin, Offset end)
+        : base_type(b, begin, end)
+    {}
+};
+
+/*!
+\brief Multi-point presenting the points of a flat coordinate buffer
+*/
+template <typename Point = flat_point<> >
+class flat_multi_point_view
+    : public detail::flat::points_view<Point>
+{
+    typedef detail::flat::points_view<Point> base_type;
+    typedef typename Point::coordinate_type coordinate_type;
+
+public:
+    flat_multi_point_view()
+    {}
+
+    flat_multi_point_view(coordinate_type const* coordinates, std::size_t count)
+        : base_type(coordinates, count)
+    {}
+
+    template <typename Offset>
+    flat_multi_point_view(detail::flat::buffers<coordinate_type, Offset> const& b,
+                          Offset begin, Offset end)
+        : base_type(b, begin, end)
+    {}
+};
+
+/*!
+\brief Polygon presenting a flat coordinate buffer and the offsets of its
+    rings, used directly by the algorithms
+\details Ring i consists of the points from ring_offsets[i] to
+    ring_offsets[i + 1], counted from the start of the coordinates, so
+    ring_offsets has num_rings + 1 elements. The first ring is the
+    exterior ring. Neither the coordinates nor the offsets are copied.
+\qbk{
+[heading Example]
+\code
+double const coordinates[] = { 0, 0, 0, 4, 4, 4, 4, 0, 0, 0,
+                               1, 1, 2, 1, 2, 2, 1, 1 };
+boost::int32_t const ring_offsets[] = { 0, 5, 9 };
+flat_polygon_view<> view(coordinates, ring_offsets, 2);
+double const a = boost::geometry::area(view); // 15.5
+\endcode
+}
+*/
+template
+<
+    typename Point = flat_point<>,
+    bool ClockWise = true,
+    bool Closed = true,
+    typename Offset = boost::int32_t
+>
+class flat_polygon_view
+{
+    typedef typename Point::coordinate_type coordinate_type;
+    typedef detail::flat::buffers<coordinate_type, Offset> buffers_type;
+
+public:
+    typedef flat_ring_view<Point, ClockWise, Closed> ring_view_type;
+    typedef detail::flat::parts_view
+        <
+            ring_view_type, coordinate_type, Offset
+        > interior_view_type;
+
+    flat_polygon_view()
+        : m_num_rings(0)
+    {}
+
+    flat_polygon_view(coordinate_type const* coordinates,
+                      Offset const* ring_offsets, std::size_t num_rings)
+        : m_buffers(coordinates, ring_offsets)
+        , m_num_rings(num_rings)
+    {}
+
+    // Rings from index begin to end, used by the multi-polygons
+    flat_polygon_view(buffers_type const& b, Offset begin, Offset end)
+        : m_buffers(b.coordinates, b.ring_offsets + begin)
+        , m_num_rings(std::size_t(end - begin))
+    {}
+
+    ring_view_type exterior() const
+    {
+        return m_num_rings == 0
+            ? ring_view_type()
+            : ring_view_type(m_buffers, m_buffers.ring_offsets[0],
+                             m_buffers.ring_offsets[1]);
+    }
+
+    interior_view_type interiors() const
+    {
+        return m_num_rings <= 1
+            ? interior_view_type()
+            : interior_view_type(m_buffers, m_buffers.ring_offsets + 1,
+                                 m_num_rings - 1);
+    }
+
+private:
+    buffers_type m_buffers;
+    std::size_t m_num_rings;
+};
+
+/*!
+\brief Multi-linestring presenting a flat coordinate buffer and the
+    offsets of its linestrings
+\details Linestring i consists of the points from offsets[i] to
+    offsets[i + 1]. The view is also a random access range of linestrings,
+    e.g. a column of linestrings.
+*/
+template <typename Point = flat_point<>, typename Offset = boost::int32_t>
+class flat_multi_linestring_view
+    : public detail::flat::parts_view
+        <
+            flat_linestring_view<Point>, typename Point::coordinate_type, Offset
+        >
+{
+    typedef typename Point::coordinate_type coordinate_type;
+    typedef detail::flat::parts_view
+        <
+            flat_linestring_view<Point>, coordinate_type, Offset
+        > base_type;
+
+public:
+    flat_multi_linestring_view()
+    {}
+
+    flat_multi_linestring_view(coordinate_type const* coordinates,
+                               Offset const* offsets, std::size_t count)
+        : base_type(detail::flat::buffers<coordinate_type, Offset>(coordinates, 0),
+                    offsets, count)
+    {}
+};
+
+/*!
+\brief Multi-polygon presenting a flat coordinate buffer and the offsets
+    of its polygons and rings
+\details Polygon i consists of the rings from polygon_offsets[i] to
+    polygon_offsets[i + 1], ring j of the points from ring_offsets[j] to
+    ring_offsets[j + 1]. This is the layout of a column of polygons in
+    e.g. GeoArrow, the view is a random access range of its polygons.
+\qbk{
+[heading Example]
+\code
+// column of polygons with interleaved coordinates
+flat_multi_polygon_view<> column(coordinates, ring_offsets, geometry_offsets, count);
+for (std::size_t i = 0; i < count; i++)
+{
+    double const a = boost::geometry::area(column.at(i));
+}
+\endcode
+}
+*/
+template
+<
+    typename Point = flat_point<>,
+    bool ClockWise = true,
+    bool Closed = true,
+    typename Offset = boost::int32_t
+>
+class flat_multi_polygon_view
+    : public detail::flat::parts_view
+        <
+            flat_polygon_view<Point, ClockWise, Closed, Offset>,
+            typename Point::coordinate_type, Offset
+        >
+{
+    typedef typename Point::coordinate_type coordinate_type;
+    typedef detail::flat::parts_view
+        <
+            flat_polygon_view<Point, ClockWise, Closed, Offset>,
+            coordinate_type, Offset
+        > base_type;
+
+public:
+    flat_multi_polygon_view()
+    {}
+
+    flat_multi_polygon_view(coordinate_type const* coordinates,
+                            Offset const* ring_offsets,
+                            Offset const* polygon_offsets, std::size_t count)
+        : base_type(detail::flat::buffers<coordinate_type, Offset>(coordinates, ring_offsets),
+                    polygon_offsets, count)
+    {}
+};
+
+
+#ifndef DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+namespace traits
+{
+
+template <typename CoordinateType, std::size_t DimensionCount, typename CoordinateSystem, std::size_t Stride>
+struct tag<flat_point<CoordinateType, DimensionCount, CoordinateSystem, Stride> >
+{
+    typedef point_tag type;
+};
+
+template <typename CoordinateType, std::size_t DimensionCount, typename CoordinateSystem, std::size_t Stride>
+struct coordinate_type<flat_point<CoordinateType, DimensionCount, CoordinateSystem, Stride> >
+{
+    typedef CoordinateType type;
+};
+
+template <typename CoordinateType, std::size_t DimensionCount, typename CoordinateSystem, std::size_t Stride>
+struct coordinate_system<flat_point<CoordinateType, DimensionCount, CoordinateSystem, Stride> >
+{
+    typedef CoordinateSystem type;
+};
+
+template <typename CoordinateType, std::size_t DimensionCount, typename CoordinateSystem, std::size_t Stride>
+struct dimension<flat_point<CoordinateType, DimensionCount, CoordinateSystem, Stride> >
+    : boost::mpl::int_<DimensionCount>
+{};
+
+template <typename CoordinateType, std::size_t DimensionCount, typename CoordinateSystem, std::size_t Stride, std::size_t Dimension>
+struct access<flat_point<CoordinateType, DimensionCount, CoordinateSystem, Stride>, Dimension>
+{
+    static inline CoordinateType get(
+        flat_point<CoordinateType, DimensionCount, CoordinateSystem, Stride> const& p)
+    {
+        return p.template get<Dimension>();
+    }
+
+    static inline void set(
+        flat_point<CoordinateType, DimensionCount, CoordinateSystem, Stride>& p,
+        CoordinateType const& value)
+    {
+        p.template set<Dimension>(value);
+    }
+};
+
+template <typename Point>
+struct tag<flat_linestring_view<Point> >
+{
+    typedef linestring_tag type;
+};
+
+template <typename Point>
+struct tag<flat_multi_point_view<Point> >
+{
+    typedef multi_point_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct tag<flat_ring_view<Point, ClockWise, Closed> >
+{
+    typedef ring_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct point_order<flat_ring_view<Point, ClockWise, Closed> >
+{
+    static const order_selector value = ClockWise ? clockwise : counterclockwise;
+};
+
+template <typename Point, bool ClockWise, bool Closed>
+struct closure<flat_ring_view<Point, ClockWise, Closed> >
+{
+    static const closure_selector value = Closed ? closed : open;
+};
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+struct tag<flat_polygon_view<Point, ClockWise, Closed, Offset> >
+{
+    typedef polygon_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+struct ring_const_type<flat_polygon_view<Point, ClockWise, Closed, Offset> >
+{
+    typedef typename flat_polygon_view<Point, ClockWise, Closed, Offset>::ring_view_type type;
+};
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+struct ring_mutable_type<flat_polygon_view<Point, ClockWise, Closed, Offset> >
+{
+    typedef typename flat_polygon_view<Point, ClockWise, Closed, Offset>::ring_view_type type;
+};
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+struct interior_const_type<flat_polygon_view<Point, ClockWise, Closed, Offset> >
+{
+    typedef typename flat_polygon_view<Point, ClockWise, Closed, Offset>::interior_view_type type;
+};
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+struct interior_mutable_type<flat_polygon_view<Point, ClockWise, Closed, Offset> >
+{
+    typedef typename flat_polygon_view<Point, ClockWise, Closed, Offset>::interior_view_type type;
+};
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+struct exterior_ring<flat_polygon_view<Point, ClockWise, Closed, Offset> >
+{
+    typedef flat_polygon_view<Point, ClockWise, Closed, Offset> polygon_type;
+
+    static inline typename polygon_type::ring_view_type get(polygon_type const& p)
+    {
+        return p.exterior();
+    }
+};
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+struct interior_rings<flat_polygon_view<Point, ClockWise, Closed, Offset> >
+{
+    typedef flat_polygon_view<Point, ClockWise, Closed, Offset> polygon_type;
+
+    static inline typename polygon_type::interior_view_type get(polygon_type const& p)
+    {
+        return p.interiors();
+    }
+};
+
+template <typename Point, typename Offset>
+struct tag<flat_multi_linestring_view<Point, Offset> >
+{
+    typedef multi_linestring_tag type;
+};
+
+template <typename Point, bool ClockWise, bool Closed, typename Offset>
+struct tag<flat_multi_polygon_view<Point, ClockWise, Closed, Offset> >
+{
+    typedef multi_polygon_tag type;
+};
+
+} // namespace traits
+#endif // DOXYGEN_NO_TRAITS_SPECIALIZATIONS
+
+}} // namespace boost::geometry
+
+#endif // BOOST_GEOMETRY_VIEWS_FLAT_VIEW_HPP
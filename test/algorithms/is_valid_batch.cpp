@@ -0,0 +1,117 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Licensed under the Boost Software License version 1.0.
+// http://www.boost.org/users/license.html
+
+#ifndef BOOST_TEST_MODULE
+#define BOOST_TEST_MODULE test_is_valid_batch
+#endif
+
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <boost/test/included/unit_test.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/validity_failure_type.hpp>
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+#include <boost/geometry/strategies/strategies.hpp>
+
+#include <from_wkt.hpp>
+
+
+namespace bg = ::boost::geometry;
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::linestring<point_type>              linestring_type;
+typedef bg::model::ring<point_type>                    ring_type;
+typedef bg::model::polygon<point_type>                 polygon_type;
+typedef bg::model::multi_polygon<polygon_type>         multi_polygon_type;
+
+
+template <typename Geometry>
+void test_batch(std::vector<std::string> const& wkts)
+{
+    std::vector<Geometry> geometries;
+    for (std::size_t i = 0; i < wkts.size(); ++i)
+    {
+        geometries.push_back(from_wkt<Geometry>(wkts[i]));
+    }
+
+    std::vector<bg::validity_failure_type> failures;
+    bg::is_valid_batch(geometries, std::back_inserter(failures));
+
+    BOOST_CHECK_EQUAL(failures.size(), geometries.size());
+
+    for (std::size_t i = 0; i < geometries.size() && i < failures.size(); ++i)
+    {
+        bg::validity_failure_type expected;
+        bg::is_valid(geometries[i], expected);
+        BOOST_CHECK_MESSAGE(failures[i] == expected,
+            "geometry: " << wkts[i]
+            << " expected failure: " << expected
+            << " detected: " << failures[i]);
+    }
+
+    // the batch is repeated with the same results
+    std::vector<bg::validity_failure_type> failures2;
+    bg::is_valid_batch(geometries, std::back_inserter(failures2),
+                       bg::default_strategy());
+    BOOST_CHECK(failures == failures2);
+}
+
+
+BOOST_AUTO_TEST_CASE( test_is_valid_batch_linestring )
+{
+    std::vector<std::string> wkts;
+    wkts.push_back("LINESTRING(0 0,1 1)");
+    wkts.push_back("LINESTRING(0 0)");
+    wkts.push_back("LINESTRING(0 0,0 0)");
+    wkts.push_back("LINESTRING(0 0,2 2,1 1)");
+    test_batch<linestring_type>(wkts);
+}
+
+BOOST_AUTO_TEST_CASE( test_is_valid_batch_ring )
+{
+    std::vector<std::string> wkts;
+    wkts.push_back("POLYGON((0 0,0 1,1 1,1 0,0 0))");
+    wkts.push_back("POLYGON((0 0,1 1,1 0,0 1,0 0))");
+    wkts.push_back("POLYGON((0 0,1 0,1 1,0 1,0 0))");
+    wkts.push_back("POLYGON((0 0,0 1,1 1,1 0))");
+    wkts.push_back("POLYGON((0 0,0 2,2 2,2 0,0 0))");
+    wkts.push_back("POLYGON((0 0,0 10,0 20,0 0))");
+    test_batch<ring_type>(wkts);
+}
+
+BOOST_AUTO_TEST_CASE( test_is_valid_batch_polygon )
+{
+    std::vector<std::string> wkts;
+    wkts.push_back("POLYGON((0 0,0 10,10 10,10 0,0 0))");
+    wkts.push_back("POLYGON((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 2,1 1))");
+    wkts.push_back("POLYGON((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 2,1 1),(1 1,2 1,2 2,1 2,1 1))");
+    wkts.push_back("POLYGON((0 0,0 10,10 10,10 0,0 0),(11 11,12 11,12 12,11 12,11 11))");
+    wkts.push_back("POLYGON((0 0,0 10,10 10,10 0,0 0),(0 5,5 10,10 5,5 0,0 5))");
+    wkts.push_back("POLYGON((0 0,0 10,10 10,10 0,0 0),(1 1,8 1,8 8,1 8,1 1),(2 2,3 2,3 3,2 3,2 2))");
+    wkts.push_back("POLYGON((0 0,10 10,0 10,10 0,0 0))");
+    wkts.push_back("POLYGON((0 0,0 10,10 10,10 0,0 0))");
+    test_batch<polygon_type>(wkts);
+}
+
+BOOST_AUTO_TEST_CASE( test_is_valid_batch_multipolygon )
+{
+    std::vector<std::string> wkts;
+    wkts.push_back("MULTIPOLYGON(((0 0,0 1,1 1,1 0,0 0)),((2 2,2 3,3 3,3 2,2 2)))");
+    wkts.push_back("MULTIPOLYGON(((0 0,0 2,2 2,2 0,0 0)),((1 1,1 3,3 3,3 1,1 1)))");
+    wkts.push_back("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((1 1,1 2,2 2,2 1,1 1)))");
+    wkts.push_back("MULTIPOLYGON(((0 0,0 1,1 1,1 0,0 0)),((1 0,1 1,2 1,2 0,1 0)))");
+    wkts.push_back("MULTIPOLYGON()");
+    wkts.push_back("MULTIPOLYGON(((0 0,0 1,1 1,1 0,0 0)),((0 0,1 1,1 0,0 1,0 0)))");
+    test_batch<multi_polygon_type>(wkts);
+}
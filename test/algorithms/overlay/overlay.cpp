@@ -141,7 +141,7 @@ struct map_visitor
         for (typename Clusters::const_iterator it = clusters.begin(); it != clusters.end(); ++it)
         {
             std::cout << " CLUSTER " << it->first << ": ";
-            for (typename std::set<bg::signed_size_type>::const_iterator sit
+            for (typename bg::detail::overlay::turn_index_set::const_iterator sit
                  = it->second.turn_indices.begin();
                  sit != it->second.turn_indices.end(); ++sit)
             {
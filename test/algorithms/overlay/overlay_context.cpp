@@ -0,0 +1,116 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2019 Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/difference.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/sym_difference.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename MultiPolygon, typename Geometry1, typename Geometry2,
+          typename Strategy>
+void check_overlays(std::string const& caseid,
+                    Geometry1 const& geometry1, Geometry2 const& geometry2,
+                    bg::overlay_context& context, Strategy const& strategy)
+{
+    bg::overlay_context_strategy<Strategy> const context_strategy
+        = bg::with_overlay_context(context, strategy);
+
+    MultiPolygon expected, result;
+
+    bg::intersection(geometry1, geometry2, expected, strategy);
+    bg::intersection(geometry1, geometry2, result, context_strategy);
+    BOOST_CHECK_MESSAGE(boost::size(result) == boost::size(expected),
+                        caseid << " intersection count");
+    BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+
+    bg::clear(expected);
+    bg::clear(result);
+    bg::union_(geometry1, geometry2, expected, strategy);
+    bg::union_(geometry1, geometry2, result, context_strategy);
+    BOOST_CHECK_MESSAGE(boost::size(result) == boost::size(expected),
+                        caseid << " union count");
+    BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+
+    bg::clear(expected);
+    bg::clear(result);
+    bg::difference(geometry1, geometry2, expected, strategy);
+    bg::difference(geometry1, geometry2, result, context_strategy);
+    BOOST_CHECK_MESSAGE(boost::size(result) == boost::size(expected),
+                        caseid << " difference count");
+    BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+
+    bg::clear(expected);
+    bg::clear(result);
+    bg::sym_difference(geometry1, geometry2, expected, strategy);
+    bg::sym_difference(geometry1, geometry2, result, context_strategy);
+    BOOST_CHECK_MESSAGE(boost::size(result) == boost::size(expected),
+                        caseid << " sym_difference count");
+    BOOST_CHECK_CLOSE(bg::area(result), bg::area(expected), 0.0001);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::box<P> box;
+
+    typedef bg::strategy::intersection::cartesian_segments<> strategy_type;
+    strategy_type const strategy;
+
+    polygon star, with_hole;
+    bg::read_wkt("POLYGON((0 0,2 4,0 8,4 6,8 8,6 4,8 0,4 2,0 0))", star);
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))",
+                 with_hole);
+
+    // One context reused for inputs of different sizes, as in tile clipping
+    bg::overlay_context context;
+
+    for (int i = 0; i < 8; i++)
+    {
+        box const tile(P(i, i / 2), P(i + 3, i / 2 + 3));
+        std::ostringstream caseid;
+        caseid << "tile_" << i;
+        check_overlays<multi_polygon>(caseid.str() + "_star", tile, star,
+                                      context, strategy);
+        check_overlays<multi_polygon>(caseid.str() + "_hole", tile, with_hole,
+                                      context, strategy);
+        check_overlays<multi_polygon>(caseid.str() + "_polygons", star,
+                                      with_hole, context, strategy);
+    }
+
+    // Empty input
+    check_overlays<multi_polygon>("empty", polygon(), star, context, strategy);
+
+    context.release();
+    check_overlays<multi_polygon>("released", star, with_hole,
+                                  context, strategy);
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
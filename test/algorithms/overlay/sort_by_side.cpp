@@ -79,7 +79,7 @@ std::vector<std::size_t> gather_cluster_properties(
          mit != clusters.end(); ++mit)
     {
         cluster_info& cinfo = mit->second;
-        std::set<signed_size_type> const& ids = cinfo.turn_indices;
+        turn_index_set const& ids = cinfo.turn_indices;
         if (ids.empty())
         {
             return result;
@@ -89,7 +89,7 @@ std::vector<std::size_t> gather_cluster_properties(
         point_type turn_point; // should be all the same for all turns in cluster
 
         bool first = true;
-        for (typename std::set<signed_size_type>::const_iterator sit = ids.begin();
+        for (turn_index_set::const_iterator sit = ids.begin();
              sit != ids.end(); ++sit)
         {
             signed_size_type turn_index = *sit;
@@ -411,6 +411,26 @@ void test_multi_polygon_multi_polygon()
     test_geometry<mpoly, mpoly>("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((0 20,0 30,10 30,10 20,0 20)))",
                                 "MULTIPOLYGON(((5 5,5 6,6 6,6 5,5 5)))",
                                 "212FF1FF2");
+
+    // disjoint envelopes, no turns are calculated
+    test_geometry<mpoly, mpoly>("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2)),((0 20,0 30,10 30,10 20,0 20)))",
+                                "MULTIPOLYGON(((20 0,20 10,30 10,30 0,20 0)))",
+                                "FF2FF1212");
+    // the envelope of the second geometry sticks out, it's not within
+    test_geometry<mpoly, mpoly>("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)))",
+                                "MULTIPOLYGON(((5 5,5 15,6 15,6 5,5 5)))",
+                                "212101212");
+
+    // several components without turns, located using the rtree
+    test_geometry<mpoly, mpoly>("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((20 0,20 10,30 10,30 0,20 0)),((40 0,40 10,50 10,50 0,40 0)))",
+                                "MULTIPOLYGON(((2 2,2 4,4 4,4 2,2 2)),((22 2,22 4,24 4,24 2,22 2)),((60 0,60 1,61 1,61 0,60 0)))",
+                                "212FF1212");
+    test_geometry<mpoly, mpoly>("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(4 4,7 4,7 7,4 7,4 4)),((20 0,20 10,30 10,30 0,20 0)))",
+                                "MULTIPOLYGON(((5 5,5 6,6 6,6 5,5 5)),((22 2,22 4,24 4,24 2,22 2)),((1 1,1 2,2 2,2 1,1 1)))",
+                                "212FF1212");
+    test_geometry<mpoly, mpoly>("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(4 4,7 4,7 7,4 7,4 4)),((20 0,20 10,30 10,30 0,20 0)))",
+                                "MULTIPOLYGON(((5 5,5 6,6 6,6 5,5 5)),((32 2,32 4,34 4,34 2,32 2)))",
+                                "FF2FF1212");
 }
 
 template <typename P>
@@ -472,6 +472,14 @@ void test_multi_linestring_multi_polygon()
                               "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)))",
                               "FF1FF0212");
 
+    // several linestrings without turns, located using the rtree
+    test_geometry<mls, mpoly>("MULTILINESTRING((2 2,3 3),(22 2,23 3),(60 0,61 1))",
+                              "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((20 0,20 10,30 10,30 0,20 0)),((40 0,40 10,50 10,50 0,40 0)))",
+                              "1F10F0212");
+    test_geometry<mls, mpoly>("MULTILINESTRING((2 2,3 3),(22 2,23 3))",
+                              "MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0)),((20 0,20 10,30 10,30 0,20 0)),((40 0,40 10,50 10,50 0,40 0)))",
+                              "1FF0FF212");
+
     test_geometry<mls, mpoly>("MULTILINESTRING((5 5,0 5),(5 5,5 0),(10 10,10 5,5 5,5 10,10 10))",
                               "MULTIPOLYGON(((0 0,0 5,5 5,5 0,0 0)),((5 5,5 10,10 10,10 5,5 5)),((5 5,10 1,10 0,5 5)))",
                               "F1FF0F212");
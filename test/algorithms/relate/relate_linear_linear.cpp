@@ -392,6 +392,11 @@ void test_multi_linestring_multi_linestring()
     test_geometry<mls, mls>("MULTILINESTRING((0 0,0 0,18 0,18 0,19 0,19 0,19 0,30 0,30 0))",
                             "MULTILINESTRING((0 10,5 0,20 0,20 0,30 0))",
                             "1F1F00102");
+
+    // disjoint envelopes, including a point-like linestring
+    test_geometry<mls, mls>("MULTILINESTRING((0 0,10 0),(5 5,5 5))",
+                            "MULTILINESTRING((20 0,30 0,30 10,20 0))",
+                            "FF1FF01F2");
     test_geometry<mls, mls>("MULTILINESTRING((0 0,0 0,18 0,18 0,19 0,19 0,19 0,30 0,30 0))",
                             //"MULTILINESTRING((0 10,5 0,20 0,20 0,30 0),(1 10,1 10,1 0,1 0,1 -10),(2 0,2 0),(3 0,3 0,3 0),(0 0,0 0,0 10,0 10),(30 0,30 0,31 0,31 0))",
                             "MULTILINESTRING((0 10,5 0,20 0,20 0,30 0),(1 10,1 10,1 0,1 0,1 -10),(0 0,0 0,0 10,0 10),(30 0,30 0,31 0,31 0))",
@@ -0,0 +1,182 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2019 Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/clip_to_grid.hpp>
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+// Compares the cells with intersections calculated separately
+template <typename Geometry, typename Box, typename Cells>
+void check_cells(std::string const& caseid, Geometry const& geometry,
+                 Box const& extent, std::size_t columns, std::size_t rows,
+                 Cells const& cells, double expected_total)
+{
+    typedef typename boost::range_value<Cells>::type multi_type;
+
+    BOOST_CHECK_EQUAL(cells.size(), columns * rows);
+
+    double total = 0;
+    for (std::size_t row = 0; row < rows; row++)
+    {
+        for (std::size_t column = 0; column < columns; column++)
+        {
+            multi_type const& cell = cells[row * columns + column];
+
+            Box tile;
+            bg::set<bg::min_corner, 0>(tile, bg::get<bg::min_corner, 0>(extent)
+                + (bg::get<bg::max_corner, 0>(extent) - bg::get<bg::min_corner, 0>(extent))
+                    * column / columns);
+            bg::set<bg::max_corner, 0>(tile, bg::get<bg::min_corner, 0>(extent)
+                + (bg::get<bg::max_corner, 0>(extent) - bg::get<bg::min_corner, 0>(extent))
+                    * (column + 1) / columns);
+            bg::set<bg::min_corner, 1>(tile, bg::get<bg::min_corner, 1>(extent)
+                + (bg::get<bg::max_corner, 1>(extent) - bg::get<bg::min_corner, 1>(extent))
+                    * row / rows);
+            bg::set<bg::max_corner, 1>(tile, bg::get<bg::min_corner, 1>(extent)
+                + (bg::get<bg::max_corner, 1>(extent) - bg::get<bg::min_corner, 1>(extent))
+                    * (row + 1) / rows);
+
+            multi_type expected;
+            bg::intersection(geometry, tile, expected);
+
+            double const size = bg::area(cell) + bg::length(cell);
+            double const expected_size = bg::area(expected) + bg::length(expected);
+            BOOST_CHECK_MESSAGE(bg::math::abs(size - expected_size) < 1.0e-9,
+                                caseid << " cell " << column << " " << row
+                                << " : " << size << " expected: " << expected_size);
+            total += size;
+        }
+    }
+
+    BOOST_CHECK_CLOSE(total, expected_total, 0.0001);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+    typedef bg::model::box<P> box;
+
+    polygon star, with_hole, large;
+    bg::read_wkt("POLYGON((0 0,2 4,0 8,4 6,8 8,6 4,8 0,4 2,0 0))", star);
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))",
+                 with_hole);
+    bg::read_wkt("POLYGON((-100 -100,-100 100,100 100,100 -100,-100 -100))",
+                 large);
+    bg::correct(star);
+
+    std::vector<multi_polygon> cells;
+
+    bg::clip_to_grid(star, box(P(-1, -1), P(9, 9)), 10, 10, cells);
+    check_cells("star", star, box(P(-1, -1), P(9, 9)), 10, 10, cells,
+                bg::area(star));
+
+    // Cells inside the hole and inside the polygon, not touching the boundary
+    bg::clip_to_grid(with_hole, box(P(-2, -2), P(12, 12)), 14, 14, cells);
+    check_cells("with_hole", with_hole, box(P(-2, -2), P(12, 12)), 14, 14,
+                cells, 64.0);
+
+    bg::clip_to_grid(with_hole, box(P(-0.5, 0.3), P(7.5, 9.1)), 7, 3, cells);
+    check_cells("with_hole_partly", with_hole, box(P(-0.5, 0.3), P(7.5, 9.1)),
+                7, 3, cells, 7.5 * 8.8 - 5.5 * 6.0);
+
+    // The grid is completely inside the polygon
+    bg::clip_to_grid(large, box(P(0, 0), P(4, 4)), 4, 4, cells);
+    check_cells("enclosing", large, box(P(0, 0), P(4, 4)), 4, 4, cells, 16.0);
+
+    // The polygon is completely outside of the grid
+    bg::clip_to_grid(star, box(P(20, 20), P(24, 24)), 4, 4, cells);
+    check_cells("outside", star, box(P(20, 20), P(24, 24)), 4, 4, cells, 0.0);
+
+    // Empty grid
+    bg::clip_to_grid(star, box(P(0, 0), P(4, 4)), 0, 0, cells);
+    BOOST_CHECK(cells.empty());
+
+    multi_polygon multi;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0)),((6 0,6 4,10 4,10 0,6 0)))",
+                 multi);
+    bg::clip_to_grid(multi, box(P(0, 0), P(10, 4)), 5, 2, cells);
+    check_cells("multi", multi, box(P(0, 0), P(10, 4)), 5, 2, cells, 32.0);
+
+    // Many vertices and a hole, none on the lines of the grid, clipped
+    // from the sections touching each cell
+    polygon circle;
+    for (int i = 0; i <= 360; i++)
+    {
+        double const angle = -i * bg::math::pi<double>() / 180.0;
+        bg::append(circle.outer(), P(5 + 4.5 * cos(angle), 5 + 4.5 * sin(angle)));
+    }
+    circle.inners().resize(1);
+    for (int i = 0; i <= 90; i++)
+    {
+        double const angle = i * bg::math::pi<double>() / 45.0;
+        bg::append(circle.inners().back(), P(5.1 + 2 * cos(angle), 4.9 + 2 * sin(angle)));
+    }
+    bg::clip_to_grid(circle, box(P(0.13, 0.07), P(9.91, 9.83)), 13, 11, cells);
+    check_cells("circle", circle, box(P(0.13, 0.07), P(9.91, 9.83)), 13, 11,
+                cells, bg::area(circle));
+
+    // An island in the hole
+    multi_polygon island;
+    bg::read_wkt("MULTIPOLYGON(((4.5 4.5,4.5 5.5,5.5 5.5,5.5 4.5,4.5 4.5)))", island);
+    island.push_back(circle);
+    bg::clip_to_grid(island, box(P(0.13, 0.07), P(9.91, 9.83)), 7, 9, cells);
+    check_cells("island", island, box(P(0.13, 0.07), P(9.91, 9.83)), 7, 9,
+                cells, bg::area(island));
+
+    // Counter clockwise input is converted
+    bg::model::polygon<P, false> ccw;
+    bg::convert(circle, ccw);
+    bg::clip_to_grid(ccw, box(P(0.13, 0.07), P(9.91, 9.83)), 5, 3, cells);
+    check_cells("ccw", ccw, box(P(0.13, 0.07), P(9.91, 9.83)), 5, 3,
+                cells, bg::area(circle));
+
+    linestring ls;
+    bg::read_wkt("LINESTRING(0.5 0.5,7.5 0.5,7.5 7.5,3.5 3.5)", ls);
+    std::vector<multi_linestring> linear_cells;
+    bg::clip_to_grid(ls, box(P(0, 0), P(8, 8)), 4, 4, linear_cells);
+    check_cells("linestring", ls, box(P(0, 0), P(8, 8)), 4, 4, linear_cells,
+                bg::length(ls));
+
+    linestring spiral;
+    for (int i = 0; i < 200; i++)
+    {
+        bg::append(spiral, P(5 + i * 0.02 * cos(i * 0.3), 5 + i * 0.02 * sin(i * 0.3)));
+    }
+    bg::clip_to_grid(spiral, box(P(0.13, 0.07), P(9.91, 9.83)), 9, 7, linear_cells);
+    check_cells("spiral", spiral, box(P(0.13, 0.07), P(9.91, 9.83)), 9, 7,
+                linear_cells, bg::length(spiral));
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
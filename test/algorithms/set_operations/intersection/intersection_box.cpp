@@ -0,0 +1,153 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2019 Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <sstream>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/convert.hpp>
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/num_interior_rings.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+
+// Compares the clipped result with the general overlay, which is used
+// for counter clockwise polygons
+template <typename Geometry, typename Box>
+void test_clip(std::string const& caseid, Geometry const& geometry,
+               Box const& box, std::size_t expected_count,
+               double expected_area = -1)
+{
+    typedef typename bg::point_type<Geometry>::type point_type;
+    typedef bg::model::polygon<point_type> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::polygon<point_type, false> ccw_polygon;
+    typedef bg::model::multi_polygon<ccw_polygon> ccw_multi_polygon;
+
+    multi_polygon clipped;
+    bg::intersection(geometry, box, clipped);
+
+    ccw_multi_polygon ccw_geometry, expected;
+    bg::convert(geometry, ccw_geometry);
+    bg::correct(ccw_geometry);
+    bg::intersection(ccw_geometry, box, expected);
+
+    BOOST_CHECK_MESSAGE(boost::size(clipped) == expected_count,
+                        caseid << " count: " << boost::size(clipped)
+                        << " expected: " << expected_count);
+    BOOST_CHECK_MESSAGE(boost::size(clipped) == boost::size(expected),
+                        caseid << " count differs from overlay");
+    BOOST_CHECK_MESSAGE(bg::num_interior_rings(clipped)
+                            == bg::num_interior_rings(expected),
+                        caseid << " holes differ from overlay");
+    BOOST_CHECK_CLOSE(bg::area(clipped), bg::area(expected), 0.0001);
+    if (expected_area >= 0)
+    {
+        BOOST_CHECK_CLOSE(bg::area(clipped), expected_area, 0.0001);
+    }
+
+    std::string message;
+    BOOST_CHECK_MESSAGE(bg::is_valid(clipped, message),
+                        caseid << " invalid: " << message
+                        << " " << bg::wkt(clipped));
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::box<P> box;
+
+    polygon star, with_hole, comb;
+    bg::read_wkt("POLYGON((0 0,2 4,0 8,4 6,8 8,6 4,8 0,4 2,0 0))", star);
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,8 2,8 8,2 8,2 2))",
+                 with_hole);
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,8 0,8 8,6 8,6 0,4 0,4 8,2 8,2 0,0 0))",
+                 comb);
+    bg::correct(star);
+
+    // Box inside, around, outside and in the hole
+    test_clip("inside", with_hole, box(P(0.5, 0.5), P(1.5, 1.5)), 1, 1.0);
+    test_clip("around", with_hole, box(P(-1, -1), P(11, 11)), 1, 64.0);
+    test_clip("outside", with_hole, box(P(11, 11), P(12, 12)), 0, 0.0);
+    test_clip("in_hole", with_hole, box(P(3, 3), P(7, 7)), 0, 0.0);
+    test_clip("hole_inside", with_hole, box(P(1, 1), P(9, 9)), 1, 28.0);
+
+    // The box crosses the hole, or the interior ring of the result
+    test_clip("crossing_hole", with_hole, box(P(1, 1), P(5, 5)), 1, 7.0);
+    test_clip("crossing_both", with_hole, box(P(-1, 1), P(5, 5)), 1, 11.0);
+
+    // Several pieces of one polygon
+    test_clip("comb_teeth", comb, box(P(1, -1), P(9, 5)), 3, 20.0);
+    test_clip("comb_back", comb, box(P(1, 7), P(9, 9)), 1, 12.0);
+
+    // Vertices on the box border, handled by the overlay
+    test_clip("on_border", with_hole, box(P(2, 2), P(8, 12)), 1);
+    test_clip("on_corner", star, box(P(4, 2), P(5, 3)), 1);
+
+    // Boxes without area give no output
+    test_clip("line_box", with_hole, box(P(1, 1), P(1, 5)), 0, 0.0);
+    test_clip("point_box", with_hole, box(P(1, 1), P(1, 1)), 0, 0.0);
+
+    // Boxes at many positions, as when clipping tiles
+    for (int i = 0; i < 12; i++)
+    {
+        for (int j = 0; j < 12; j++)
+        {
+            box const tile(P(i * 0.7 - 1.3, j * 0.7 - 1.3),
+                           P(i * 0.7 + 1.1, j * 0.7 + 0.9));
+            multi_polygon expected;
+            polygon ccw;
+            std::ostringstream caseid;
+            caseid << "tile_" << i << "_" << j;
+
+            bg::intersection(star, tile, expected);
+            test_clip(caseid.str() + "_star", star, tile,
+                      boost::size(expected));
+
+            bg::clear(expected);
+            bg::intersection(with_hole, tile, expected);
+            test_clip(caseid.str() + "_hole", with_hole, tile,
+                      boost::size(expected));
+
+            bg::clear(expected);
+            bg::intersection(comb, tile, expected);
+            test_clip(caseid.str() + "_comb", comb, tile,
+                      boost::size(expected));
+        }
+    }
+
+    // Multi polygons and rings
+    multi_polygon multi;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0)),((6 0,6 4,10 4,10 0,6 0)))",
+                 multi);
+    test_clip("multi", multi, box(P(1, 1), P(9, 3)), 2, 12.0);
+
+    ring r;
+    bg::read_wkt("POLYGON((0 0,0 4,4 4,4 0,0 0))", r);
+    test_clip("ring", r, box(P(1, 1), P(9, 3)), 1, 6.0);
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
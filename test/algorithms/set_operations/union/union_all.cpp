@@ -0,0 +1,147 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2019 Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/make.hpp>
+#include <boost/geometry/algorithms/num_interior_rings.hpp>
+#include <boost/geometry/algorithms/union.hpp>
+#include <boost/geometry/algorithms/union_all.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/geometries/point_xy.hpp>
+
+#include <boost/geometry/io/wkt/wkt.hpp>
+
+#include <boost/geometry/strategies/strategies.hpp>
+
+
+template <typename Polygon>
+Polygon make_square(double x, double y, double size)
+{
+    typedef typename bg::point_type<Polygon>::type point_type;
+    Polygon result;
+    bg::append(result.outer(), bg::make<point_type>(x, y));
+    bg::append(result.outer(), bg::make<point_type>(x, y + size));
+    bg::append(result.outer(), bg::make<point_type>(x + size, y + size));
+    bg::append(result.outer(), bg::make<point_type>(x + size, y));
+    bg::append(result.outer(), bg::make<point_type>(x, y));
+    return result;
+}
+
+template <typename MultiPolygon, typename Range>
+void test_one(std::string const& caseid, Range const& polygons,
+              std::size_t expected_count, std::size_t expected_holes,
+              double expected_area)
+{
+    MultiPolygon result;
+    bg::union_all(polygons, result);
+
+    BOOST_CHECK_MESSAGE(boost::size(result) == expected_count,
+                        caseid << " count: " << boost::size(result)
+                        << " expected: " << expected_count);
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(result), expected_holes);
+    BOOST_CHECK_CLOSE(bg::area(result), expected_area, 0.001);
+
+    std::string message;
+    BOOST_CHECK_MESSAGE(bg::is_valid(result, message),
+                        caseid << " not valid: " << message);
+
+    // Compare with the sequential accumulation
+    MultiPolygon sequential;
+    for (typename boost::range_iterator<Range const>::type it
+            = boost::begin(polygons); it != boost::end(polygons); ++it)
+    {
+        MultiPolygon temp;
+        bg::union_(sequential, *it, temp);
+        sequential = temp;
+    }
+    BOOST_CHECK_CLOSE(bg::area(result), bg::area(sequential), 0.001);
+}
+
+template <typename P>
+void test_all()
+{
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    {
+        std::vector<polygon> polygons;
+        multi_polygon result;
+        bg::union_all(polygons, result);
+        BOOST_CHECK(boost::empty(result));
+    }
+
+    {
+        std::vector<polygon> polygons(1, make_square<polygon>(0, 0, 2));
+        test_one<multi_polygon>("single", polygons, 1, 0, 4.0);
+    }
+
+    {
+        // Overlapping grid of squares, dissolving into one square
+        std::vector<polygon> polygons;
+        for (int i = 0; i < 10; i++)
+        {
+            for (int j = 0; j < 10; j++)
+            {
+                polygons.push_back(make_square<polygon>(i, j, 1.5));
+            }
+        }
+        test_one<multi_polygon>("grid", polygons, 1, 0, 10.5 * 10.5);
+    }
+
+    {
+        // Disjoint squares, concatenated without overlay
+        std::vector<polygon> polygons;
+        for (int i = 0; i < 7; i++)
+        {
+            polygons.push_back(make_square<polygon>(i * 3, (i % 2) * 5, 1));
+        }
+        test_one<multi_polygon>("disjoint", polygons, 7, 0, 7.0);
+    }
+
+    {
+        // Squares around a frame, creating one polygon with a hole,
+        // the upper right corner is not covered
+        std::vector<polygon> polygons;
+        for (int i = 0; i < 5; i++)
+        {
+            polygons.push_back(make_square<polygon>(i, 0, 1.5));
+            polygons.push_back(make_square<polygon>(i, 5, 1.5));
+            polygons.push_back(make_square<polygon>(0, i, 1.5));
+            polygons.push_back(make_square<polygon>(5, i, 1.5));
+        }
+        test_one<multi_polygon>("frame", polygons, 1, 1,
+                                6.5 * 6.5 - 3.5 * 3.5 - 1.0);
+    }
+
+    {
+        // Multi-polygons as input
+        std::vector<multi_polygon> multi_polygons(3);
+        bg::read_wkt("MULTIPOLYGON(((0 0,0 2,2 2,2 0,0 0)),((5 5,5 6,6 6,6 5,5 5)))",
+                     multi_polygons[0]);
+        bg::read_wkt("MULTIPOLYGON(((1 1,1 3,3 3,3 1,1 1)))", multi_polygons[1]);
+        bg::read_wkt("MULTIPOLYGON(((10 10,10 11,11 11,11 10,10 10)))",
+                     multi_polygons[2]);
+        test_one<multi_polygon>("multi", multi_polygons, 3, 0, 7.0 + 1.0 + 1.0);
+    }
+}
+
+
+int test_main(int, char* [])
+{
+    test_all<bg::model::d2::point_xy<double> >();
+
+    return 0;
+}
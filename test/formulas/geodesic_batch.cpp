@@ -0,0 +1,144 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2019 Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "test_formula.hpp"
+
+#include <boost/geometry/formulas/geodesic_batch.hpp>
+#include <boost/geometry/formulas/andoyer_inverse.hpp>
+#include <boost/geometry/formulas/thomas_inverse.hpp>
+#include <boost/geometry/formulas/vincenty_inverse.hpp>
+#include <boost/geometry/formulas/karney_direct.hpp>
+#include <boost/geometry/formulas/thomas_direct.hpp>
+#include <boost/geometry/formulas/vincenty_direct.hpp>
+
+#include <boost/geometry/srs/spheroid.hpp>
+
+
+struct coordinates
+{
+    coordinates()
+    {
+        double const d2r = bg::math::d2r<double>();
+        for (int lon = -180; lon <= 180; lon += 45)
+        {
+            for (int lat = -90; lat <= 90; lat += 30)
+            {
+                lons.push_back(lon * d2r);
+                lats.push_back(lat * d2r);
+            }
+        }
+    }
+
+    std::vector<double> lons;
+    std::vector<double> lats;
+};
+
+template <typename Result>
+void check_equal(Result const& result, Result const& expected)
+{
+    BOOST_CHECK_EQUAL(result.distance, expected.distance);
+    BOOST_CHECK_EQUAL(result.azimuth, expected.azimuth);
+    BOOST_CHECK_EQUAL(result.reverse_azimuth, expected.reverse_azimuth);
+    BOOST_CHECK_EQUAL(result.reduced_length, expected.reduced_length);
+    BOOST_CHECK_EQUAL(result.geodesic_scale, expected.geodesic_scale);
+}
+
+template <typename Inverse>
+void test_inverse()
+{
+    typedef bg::formula::inverse_batch<Inverse> batch_type;
+    typedef typename batch_type::result_type result_type;
+
+    bg::srs::spheroid<double> spheroid(6378137.0, 6356752.3142451793);
+    coordinates const c;
+
+    std::vector<double> lons2(c.lons.rbegin(), c.lons.rend());
+    std::vector<double> lats2(c.lats.begin(), c.lats.end());
+    std::rotate(lats2.begin(), lats2.begin() + 3, lats2.end());
+
+    std::vector<result_type> results;
+    batch_type::apply(c.lons, c.lats, lons2, lats2, spheroid,
+                      std::back_inserter(results));
+
+    BOOST_CHECK_EQUAL(results.size(), c.lons.size());
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        check_equal(results[i], Inverse::apply(c.lons[i], c.lats[i],
+                                               lons2[i], lats2[i],
+                                               spheroid));
+    }
+
+    std::vector<result_type> matrix;
+    batch_type::apply_matrix(c.lons, c.lats, lons2, lats2, spheroid,
+                             std::back_inserter(matrix));
+
+    BOOST_CHECK_EQUAL(matrix.size(), c.lons.size() * lons2.size());
+    for (std::size_t i = 0; i < c.lons.size(); ++i)
+    {
+        for (std::size_t j = 0; j < lons2.size(); ++j)
+        {
+            check_equal(matrix[i * lons2.size() + j],
+                        Inverse::apply(c.lons[i], c.lats[i],
+                                       lons2[j], lats2[j],
+                                       spheroid));
+        }
+    }
+}
+
+template <typename Direct>
+void test_direct()
+{
+    typedef bg::formula::direct_batch<Direct> batch_type;
+    typedef typename batch_type::result_type result_type;
+
+    bg::srs::spheroid<double> spheroid(6378137.0, 6356752.3142451793);
+    coordinates const c;
+
+    std::vector<double> distances, azimuths;
+    for (std::size_t i = 0; i < c.lons.size(); ++i)
+    {
+        distances.push_back(1000.0 + 10000.0 * i);
+        azimuths.push_back(-3.0 + 0.1 * i);
+    }
+
+    std::vector<result_type> results;
+    batch_type::apply(c.lons, c.lats, distances, azimuths, spheroid,
+                      std::back_inserter(results));
+
+    BOOST_CHECK_EQUAL(results.size(), c.lons.size());
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        result_type const expected = Direct::apply(c.lons[i], c.lats[i],
+                                                   distances[i], azimuths[i],
+                                                   spheroid);
+        BOOST_CHECK_EQUAL(results[i].lon2, expected.lon2);
+        BOOST_CHECK_EQUAL(results[i].lat2, expected.lat2);
+        BOOST_CHECK_EQUAL(results[i].reverse_azimuth, expected.reverse_azimuth);
+    }
+}
+
+int test_main(int, char*[])
+{
+    test_inverse<bg::formula::andoyer_inverse<double, true, false> >();
+    test_inverse<bg::formula::andoyer_inverse<double, true, true, true, true, true> >();
+    test_inverse<bg::formula::thomas_inverse<double, true, false> >();
+    test_inverse<bg::formula::thomas_inverse<double, true, true, true, true, true> >();
+    test_inverse<bg::formula::vincenty_inverse<double, true, true, true> >();
+
+    test_direct<bg::formula::vincenty_direct<double, true, true> >();
+    test_direct<bg::formula::thomas_direct<double, true, true, true> >();
+    test_direct<bg::formula::karney_direct<double, true, true> >();
+
+    return 0;
+}
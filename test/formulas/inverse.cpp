@@ -18,6 +18,7 @@
 #include <boost/geometry/formulas/vincenty_inverse.hpp>
 #include <boost/geometry/formulas/thomas_inverse.hpp>
 #include <boost/geometry/formulas/andoyer_inverse.hpp>
+#include <boost/geometry/formulas/karney_inverse.hpp>
 
 #include <boost/geometry/srs/spheroid.hpp>
 
@@ -75,6 +76,21 @@ void test_all(expected_results const& results)
     result_a.azimuth *= r2d;
     result_a.reverse_azimuth *= r2d;
     check_inverse("andoyer", results, result_a, results.andoyer, results.reference, 0.001);
+
+    bg::formula::result_inverse<double> result_k;
+
+    typedef bg::formula::karney_inverse<double, true, true, true, true, true> ka_t;
+    result_k = ka_t::apply(lon1r, lat1r, lon2r, lat2r, spheroid);
+    result_k.azimuth *= r2d;
+    result_k.reverse_azimuth *= r2d;
+    check_inverse("karney", results, result_k, results.reference, results.reference, 0.0000001);
+
+    // lower series order, less accurate
+    typedef bg::formula::karney_inverse<double, true, true, true, true, true, 4> ka4_t;
+    result_k = ka4_t::apply(lon1r, lat1r, lon2r, lat2r, spheroid);
+    result_k.azimuth *= r2d;
+    result_k.reverse_azimuth *= r2d;
+    check_inverse("karney4", results, result_k, results.reference, results.reference, 0.00001);
 }
 
 int test_main(int, char*[])
@@ -0,0 +1,176 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/append.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/svg/svg_lod_mapper.hpp>
+#include <boost/geometry/io/svg/svg_mapper.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+std::size_t count(std::string const& s, std::string const& what)
+{
+    std::size_t result = 0;
+    for (std::size_t pos = s.find(what); pos != std::string::npos;
+         pos = s.find(what, pos + 1))
+    {
+        result++;
+    }
+    return result;
+}
+
+template <typename Geometry>
+std::string map_lod(Geometry const& geometry, box_type const& extent,
+                    double resolution = 1.0)
+{
+    std::ostringstream out;
+    {
+        bg::svg_lod_mapper<point_type> mapper(bg::svg_stream_output(out),
+                                              100, 100, resolution);
+        mapper.add(extent);
+        mapper.map(geometry, "fill:red");
+    }
+    return out.str();
+}
+
+// The line of the element, between the header and the end
+std::string element(std::string const& svg)
+{
+    std::size_t const begin = svg.find("\n<", svg.find("xmlns:xlink")) + 1;
+    std::size_t const end = svg.find("\n", begin);
+    return svg.substr(begin, end - begin);
+}
+
+template <typename Geometry>
+void test_element(std::string const& wkt, std::string const& expected,
+                  double resolution = 1.0)
+{
+    Geometry geometry;
+    bg::read_wkt(wkt, geometry);
+    box_type const extent(point_type(0, 0), point_type(100, 100));
+    std::string const svg = map_lod(geometry, extent, resolution);
+    BOOST_CHECK_EQUAL(element(svg), expected);
+    BOOST_CHECK_EQUAL(count(svg, "</svg>"), 1u);
+}
+
+void test_large()
+{
+    // a circle of 100000 vertices in 1000 polygons of 100 pixels
+    multi_polygon_type multi;
+    for (int k = 0; k < 100; k++)
+    {
+        polygon_type polygon;
+        for (int i = 0; i <= 1000; i++)
+        {
+            double const angle = -2 * bg::math::pi<double>() * (i % 1000) / 1000;
+            bg::append(polygon, point_type(k * 10 + 4 * std::cos(angle),
+                                           4 * std::sin(angle)));
+        }
+        // tiny hole
+        bg::model::ring<point_type> hole;
+        bg::read_wkt("POLYGON((0 0,0.001 0,0.001 0.001,0 0))", hole);
+        polygon.inners().push_back(hole);
+        multi.push_back(polygon);
+    }
+
+    std::ostringstream full;
+    {
+        bg::svg_mapper<point_type> mapper(full, 1000, 1000);
+        mapper.add(multi);
+        mapper.map(multi, "fill:red");
+    }
+
+    std::ostringstream lod;
+    {
+        bg::svg_lod_mapper<point_type> mapper(bg::svg_stream_output(lod), 1000, 1000);
+        mapper.add(multi);
+        mapper.map(multi, "fill:red");
+    }
+
+    // one path, no holes, a few dozens of vertices per polygon
+    std::string const svg = lod.str();
+    BOOST_CHECK_EQUAL(count(svg, "<path"), 1u);
+    BOOST_CHECK_EQUAL(count(svg, " z"), 100u);
+    BOOST_CHECK(count(svg, ",") < 100u * 100u);
+    BOOST_CHECK(svg.size() * 20 < full.str().size());
+}
+
+void test_file()
+{
+    std::string const name = "svg_lod_test.svg";
+    std::FILE* file = std::fopen(name.c_str(), "wb");
+    BOOST_CHECK(file != 0);
+    if (file == 0)
+    {
+        return;
+    }
+    {
+        bg::svg_lod_mapper<point_type, bg::svg_file_output> mapper(bg::svg_file_output(file), 100, 100);
+        mapper.add(box_type(point_type(0, 0), point_type(10, 10)));
+        mapper.map(point_type(5, 5), "fill:red", 2);
+        mapper.text(point_type(5, 5), "center", "font-size:10px");
+    }
+    long const size = std::ftell(file);
+    std::fclose(file);
+    std::remove(name.c_str());
+    BOOST_CHECK(size > 0);
+}
+
+int test_main(int, char* [])
+{
+    // y axis downwards
+    test_element<point_type>("POINT(10 20)", "<circle cx=\"10\" cy=\"80\" r=\"5\" style=\"fill:red\"/>");
+    test_element<linestring_type>("LINESTRING(0 0,10.2 0.1,20 0,20 10)",
+        "<polyline points=\"0,100 20,100 20,90\" style=\"fill:red;fill:none\"/>");
+    test_element<linestring_type>("LINESTRING(0 0,0.2 0.1,0.4 0)", "</svg>");
+    test_element<polygon_type>("POLYGON((0 0,0 10,10 10,10 0,0 0),(2 2,2.1 2,2.1 2.1,2 2))",
+        "<g fill-rule=\"evenodd\"><path d=\" M 0,100 L 0,90 10,90 10,100 0,100 z\" style=\"fill:red\"/></g>");
+    test_element<polygon_type>("POLYGON((0 0,0 0.4,0.4 0.4,0.4 0,0 0))", "</svg>");
+    test_element<bg::model::ring<point_type> >("POLYGON((0 0,0 10,10 10,10 0,0 0))",
+        "<polygon points=\"0,100 0,90 10,90 10,100 0,100\" style=\"fill:red\"/>");
+    test_element<box_type>("BOX(10 10,20 20)",
+        "<rect x=\"10\" y=\"80\" width=\"10\" height=\"10\" style=\"fill:red\"/>");
+    test_element<bg::model::segment<point_type> >("SEGMENT(10 10,20 20)",
+        "<line x1=\"10\" y1=\"90\" x2=\"20\" y2=\"80\" style=\"fill:red\"/>");
+    test_element<bg::model::multi_point<point_type> >("MULTIPOINT((10 10),(10.2 10),(20 20))",
+        "<circle cx=\"10\" cy=\"90\" r=\"5\" style=\"fill:red\"/>"
+        "<circle cx=\"20\" cy=\"80\" r=\"5\" style=\"fill:red\"/>");
+    test_element<bg::model::multi_linestring<linestring_type> >(
+        "MULTILINESTRING((0 0,10 0),(0.1 0.1,0.2 0.2),(0 10,10 10))",
+        "<path d=\" M 0,100 L 10,100 M 0,90 L 10,90\" style=\"fill:red;fill:none\"/>");
+    // half pixels
+    test_element<linestring_type>("LINESTRING(0 0,10.2 0.1,20 0,20 10)",
+        "<polyline points=\"0,100 20,100 20,90\" style=\"fill:red;fill:none\"/>", 0.5);
+    test_element<linestring_type>("LINESTRING(0 0,0.5 0.5)",
+        "<polyline points=\"0,100 0.5,99.5\" style=\"fill:red;fill:none\"/>", 0.5);
+    // tenths of pixels are written with one decimal
+    test_element<linestring_type>("LINESTRING(0 0,0.3 0.7)",
+        "<polyline points=\"0,100 0.3,99.3\" style=\"fill:red;fill:none\"/>", 0.1);
+    // quarters of pixels, 0.35 is not exactly representable and snapped
+    // to 0.25, written with two decimals
+    test_element<linestring_type>("LINESTRING(0.35 0.1,0.8 0.6)",
+        "<polyline points=\"0.25,100 0.75,99.5\" style=\"fill:red;fill:none\"/>", 0.25);
+
+    test_large();
+    test_file();
+
+    return 0;
+}
@@ -0,0 +1,505 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/geometries/geometries.hpp>
+
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/io/wkt/read_buffer.hpp>
+#include <boost/geometry/io/wkt/write.hpp>
+#include <boost/geometry/io/wkt/write_buffer.hpp>
+
+#include <boost/lexical_cast.hpp>
+#include <boost/variant/variant.hpp>
+
+
+template <typename G>
+void read_buffer(std::string const& wkt, G& geometry)
+{
+    bg::read_wkt(wkt.data(), wkt.data() + wkt.size(), geometry);
+}
+
+// The buffer reader should give the same result as read_wkt
+template <typename G>
+void test_same(std::string const& wkt)
+{
+    G expected, geometry;
+    bg::read_wkt(wkt, expected);
+    read_buffer(wkt, geometry);
+
+    std::ostringstream out1, out2;
+    out1 << std::setprecision(20) << bg::wkt(expected);
+    out2 << std::setprecision(20) << bg::wkt(geometry);
+    BOOST_CHECK_MESSAGE(out1.str() == out2.str(),
+                        wkt << " read as " << out2.str()
+                        << " instead of " << out1.str());
+}
+
+template <typename G>
+void test_wrong(std::string const& wkt, std::size_t expected_offset)
+{
+    G geometry;
+    std::size_t offset = std::size_t(-1);
+    try
+    {
+        read_buffer(wkt, geometry);
+    }
+    catch(bg::read_wkt_buffer_exception const& e)
+    {
+        offset = e.offset();
+    }
+    BOOST_CHECK_MESSAGE(offset == expected_offset,
+                        wkt << " failed at " << offset
+                        << " instead of " << expected_offset);
+}
+
+template <typename T>
+void test_numbers()
+{
+    typedef bg::model::point<T, 2, bg::cs::cartesian> point;
+
+    // compare the fast path with the standard conversion
+    std::srand(1);
+    for (int i = 0; i < 2000; ++i)
+    {
+        double const v = (std::rand() - RAND_MAX / 2) * 1e-4
+                       * std::pow(10.0, std::rand() % 17 - 8);
+        std::ostringstream out;
+        out << "POINT(" << std::setprecision(std::rand() % 17 + 1) << v
+            << " " << std::setprecision(17) << v << ")";
+        test_same<point>(out.str());
+    }
+
+    test_same<point>("POINT(0.1 -0.3)");
+    test_same<point>("POINT(1e22 1e-22)");
+    test_same<point>("POINT(9007199254740993 3.4e38)");
+    test_same<point>("POINT(12345678901234567890123 0.000000000000000000000000001)");
+    test_same<point>("POINT(-0 +5)");
+    test_same<point>("POINT(.5 5.)");
+    test_same<point>("POINT(1E3 1e+3)");
+}
+
+template <typename P>
+void test_geometries()
+{
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+    typedef bg::model::polygon<P, true, false> open_polygon;
+    typedef bg::model::ring<P> ring;
+    typedef bg::model::multi_point<P> multi_point;
+    typedef bg::model::multi_linestring<linestring> multi_linestring;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+    typedef bg::model::box<P> box;
+    typedef bg::model::segment<P> segment;
+
+    test_same<P>("POINT(1 2)");
+    test_same<P>("point ( 1   2 )");
+    test_same<P>("POINT(1)");
+    test_same<P>("POINT()");
+    test_same<linestring>("LINESTRING(1 2,3 4,5 6)");
+    test_same<linestring>("LINESTRING EMPTY");
+    test_same<linestring>("LINESTRING(1 2,,3 4)");
+    test_same<ring>("POLYGON((0 0,0 1,1 1,1 0,0 0))");
+    test_same<polygon>("POLYGON((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 1),(3 3,4 3,4 4,3 3))");
+    test_same<polygon>("POLYGON EMPTY");
+    test_same<open_polygon>("POLYGON((0 0,0 1,1 1,1 0,0 0))");
+    test_same<open_polygon>("POLYGON((0 0,0 1,1 1,1 0))");
+    test_same<multi_point>("MULTIPOINT((1 2),(3 4))");
+    test_same<multi_point>("MULTIPOINT(1 2,3 4)");
+    test_same<multi_point>("MULTIPOINT EMPTY");
+    test_same<multi_linestring>("MULTILINESTRING((1 2,3 4),(5 6,7 8))");
+    test_same<multi_polygon>("MULTIPOLYGON(((0 0,0 1,1 1,1 0,0 0)),((2 2,2 3,3 3,2 2),(2.1 2.1,2.2 2.1,2.1 2.2,2.1 2.1)))");
+    test_same<box>("BOX(1 2,3 4)");
+    test_same<box>("POLYGON((0 0,0 1,1 1,1 0))");
+    test_same<box>("POLYGON((0 0,0 1,1 1,1 0,0 0))");
+    test_same<box>("POLYGON EMPTY");
+    test_same<segment>("SEGMENT(1 2,3 4)");
+    test_same<segment>("LINESTRING(1 2,3 4)");
+
+    // measures are ignored
+    {
+        polygon poly, expected;
+        read_buffer("POLYGON M ((0 0 7,0 1 7,1 1 7,0 0 7))", poly);
+        bg::read_wkt("POLYGON((0 0,0 1,1 1,0 0))", expected);
+        BOOST_CHECK(bg::equals(poly, expected));
+    }
+
+    // white spaces of any kind
+    {
+        linestring ls;
+        read_buffer("\tLINESTRING\n(1 2,\r\n3 4)\n", ls);
+        BOOST_CHECK_EQUAL(bg::num_points(ls), 2u);
+    }
+
+    test_wrong<P>("", 0);
+    test_wrong<P>("LINESTRING(1 2)", 0);
+    test_wrong<P>("POINT(1 2", 9);
+    test_wrong<P>("POINT(1 2 3)", 10);
+    test_wrong<P>("POINT(1 x)", 8);
+    test_wrong<P>("POINT Z(1 2)", 7);
+    test_wrong<P>("POINT(1 2) 3", 11);
+    test_wrong<linestring>("LINESTRING(1 2,(3 4))", 15);
+    test_wrong<polygon>("POLYGON(0 0,1 1)", 8);
+    test_wrong<multi_polygon>("MULTIPOLYGON(((0 0,0 1,1 1,0 0))", 32);
+    test_wrong<box>("BOX(1 2,3 4,5 6)", 16);
+    test_wrong<segment>("SEGMENT(1 2)", 12);
+}
+
+void test_integers()
+{
+    typedef bg::model::point<int, 2, bg::cs::cartesian> point;
+    test_same<point>("POINT(2147483647 -2147483648)");
+    test_same<point>("POINT(+12 -0)");
+    test_wrong<point>("POINT(2147483648 0)", 6);
+    test_wrong<point>("POINT(1.5 0)", 6);
+}
+
+template <typename T>
+void test_reuse()
+{
+    typedef bg::model::point<T, 2, bg::cs::cartesian> point;
+    typedef bg::model::polygon<point> polygon;
+    typedef bg::model::multi_polygon<polygon> multi_polygon;
+
+    multi_polygon mpoly;
+    read_buffer("MULTIPOLYGON(((0 0,0 5,5 5,5 0,0 0),(1 1,2 1,2 2,1 1)))", mpoly);
+    read_buffer("MULTIPOLYGON(((0 0,0 1,1 1,1 0,0 0)),((2 2,2 3,3 3,2 2)))", mpoly);
+
+    multi_polygon expected;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 1,1 1,1 0,0 0)),((2 2,2 3,3 3,2 2)))", expected);
+    BOOST_CHECK(bg::equals(mpoly, expected));
+    BOOST_CHECK_EQUAL(mpoly[0].inners().size(), 0u);
+
+    // The rings and parts keep their memory
+    read_buffer("MULTIPOLYGON(((0 0,0 5,5 5,5 0,0 0),(1 1,2 1,2 2,1 1)),((6 6,6 7,7 7,6 6)))", mpoly);
+    point const* const hole = &mpoly[0].inners()[0][0];
+    point const* const second = &mpoly[1].outer()[0];
+    read_buffer("MULTIPOLYGON(((0 0,0 6,6 6,6 0,0 0),(2 2,3 2,3 3,2 2)),((8 8,8 9,9 9,8 8)))", mpoly);
+    BOOST_CHECK(&mpoly[0].inners()[0][0] == hole);
+    BOOST_CHECK(&mpoly[1].outer()[0] == second);
+    BOOST_CHECK(bg::equals(mpoly[1].outer()[1], point(8, 9)));
+
+    // Grown beyond the number of parts and holes read, then shrunk
+    std::ostringstream many;
+    many << "MULTIPOLYGON(";
+    for (int i = 0; i < 9; i++)
+    {
+        many << (i > 0 ? "," : "") << "((0 0,0 9,9 9,9 0,0 0)";
+        for (int j = 0; j < i; j++)
+        {
+            many << ",(" << j << " 1," << j << " 2,"
+                 << j + 0.5 << " 2," << j << " 1)";
+        }
+        many << ")";
+    }
+    many << ")";
+    read_buffer(many.str(), mpoly);
+    BOOST_CHECK_EQUAL(mpoly.size(), 9u);
+    BOOST_CHECK_EQUAL(mpoly[8].inners().size(), 8u);
+    BOOST_CHECK_EQUAL(mpoly[5].inners().size(), 5u);
+    BOOST_CHECK(bg::equals(mpoly[8].inners()[7][2], point(7.5, 2)));
+
+    read_buffer("MULTIPOLYGON EMPTY", mpoly);
+    BOOST_CHECK(mpoly.empty());
+}
+
+template <typename T>
+std::string write_number(T const& value, int precision = -1)
+{
+    bg::model::point<T, 1, bg::cs::cartesian> point(value);
+    std::string buffer;
+    bg::write_wkt(point, buffer, precision);
+    // POINT(x)
+    return buffer.substr(6, buffer.size() - 7);
+}
+
+// Number of significant digits of a number written in decimal notation
+std::size_t significant_digits(std::string const& str)
+{
+    std::string digits;
+    for (std::size_t i = 0; i < str.size() && str[i] != 'e'; ++i)
+    {
+        if (str[i] >= '0' && str[i] <= '9')
+        {
+            digits += str[i];
+        }
+    }
+    std::size_t const first = digits.find_first_not_of('0');
+    std::size_t const last = digits.find_last_not_of('0');
+    return first == std::string::npos ? 1 : last - first + 1;
+}
+
+// The shortest number of digits of %g reading back as the value
+template <typename T>
+std::size_t shortest_length(T const& value)
+{
+    for (int p = 1; ; ++p)
+    {
+        std::ostringstream out;
+        out << std::setprecision(p) << value;
+        if (boost::lexical_cast<T>(out.str()) == value)
+        {
+            return significant_digits(out.str());
+        }
+    }
+}
+
+template <typename T>
+void test_write_round_trip()
+{
+    std::srand(2);
+    int not_shortest = 0;
+    int const count = 20000;
+    for (int i = 0; i < count; ++i)
+    {
+        T const value = T((std::rand() - RAND_MAX / 2) / double(std::rand() + 1)
+                      * std::pow(10.0, std::rand() % 40 - 20));
+        std::string const str = write_number(value);
+        T const read = boost::lexical_cast<T>(str);
+        BOOST_CHECK_MESSAGE(read == value,
+                            str << " read as " << std::setprecision(20) << read
+                            << " instead of " << value);
+
+        if (significant_digits(str) > shortest_length(value))
+        {
+            ++not_shortest;
+        }
+    }
+
+    // Grisu2 gives the shortest digits in the vast majority of cases
+    BOOST_CHECK_LT(not_shortest, count / 100);
+}
+
+// The output of std::fixed without trailing zeros and negative zero
+std::string fixed_number(double value, int precision)
+{
+    std::ostringstream out;
+    out << std::fixed << std::setprecision(precision) << value;
+    std::string result = out.str();
+    if (result.find('.') != std::string::npos)
+    {
+        result.erase(result.find_last_not_of('0') + 1);
+        if (result[result.size() - 1] == '.')
+        {
+            result.erase(result.size() - 1);
+        }
+    }
+    return result == "-0" ? "0" : result;
+}
+
+void test_write_fixed()
+{
+    std::srand(3);
+    for (int i = 0; i < 20000; ++i)
+    {
+        int const precision = std::rand() % 10;
+        double const value = (std::rand() - RAND_MAX / 2) / double(std::rand() + 1)
+                           * std::pow(10.0, std::rand() % 12 - 6);
+        if (std::fabs(value) * std::pow(10.0, precision) < 1e18)
+        {
+            BOOST_CHECK_EQUAL(write_number(value, precision),
+                              fixed_number(value, precision));
+        }
+
+        // halfway cases in decimal, not exactly representable in binary
+        double const half = (std::rand() % 100000 + 0.5) / std::pow(10.0, precision);
+        BOOST_CHECK_EQUAL(write_number(half, precision),
+                          fixed_number(half, precision));
+    }
+}
+
+void test_write_numbers()
+{
+    BOOST_CHECK_EQUAL(write_number(0.1), "0.1");
+    BOOST_CHECK_EQUAL(write_number(-0.3), "-0.3");
+    BOOST_CHECK_EQUAL(write_number(0.1 + 0.2), "0.30000000000000004");
+    BOOST_CHECK_EQUAL(write_number(123456.0), "123456");
+    BOOST_CHECK_EQUAL(write_number(1e21), "1e21");
+    BOOST_CHECK_EQUAL(write_number(1e20), "100000000000000000000");
+    BOOST_CHECK_EQUAL(write_number(1.5e-7), "1.5e-7");
+    BOOST_CHECK_EQUAL(write_number(0.000001), "0.000001");
+    BOOST_CHECK_EQUAL(write_number(1.7976931348623157e308), "1.7976931348623157e308");
+    BOOST_CHECK_EQUAL(write_number(5e-324), "5e-324");
+    BOOST_CHECK_EQUAL(write_number(0.0), "0");
+    BOOST_CHECK_EQUAL(write_number(-0.0), "-0");
+    BOOST_CHECK_EQUAL(write_number(0.1f), "0.1");
+    BOOST_CHECK_EQUAL(write_number(16777216.0f), "16777216");
+    BOOST_CHECK_EQUAL(write_number(std::numeric_limits<double>::infinity()), "inf");
+    BOOST_CHECK_EQUAL(write_number(-std::numeric_limits<double>::infinity()), "-inf");
+    BOOST_CHECK_EQUAL(write_number(std::numeric_limits<double>::quiet_NaN()), "nan");
+    BOOST_CHECK_EQUAL(write_number(-2147483647 - 1), "-2147483648");
+    BOOST_CHECK_EQUAL(write_number(1.5L), "1.5");
+
+    BOOST_CHECK_EQUAL(write_number(3.14159, 2), "3.14");
+    BOOST_CHECK_EQUAL(write_number(2.5, 0), "2");
+    BOOST_CHECK_EQUAL(write_number(3.5, 0), "4");
+    BOOST_CHECK_EQUAL(write_number(2.675, 2), "2.67");
+    BOOST_CHECK_EQUAL(write_number(0.125, 2), "0.12");
+    BOOST_CHECK_EQUAL(write_number(12.5, 0), "12");
+    BOOST_CHECK_EQUAL(write_number(0.49999999999999994, 0), "0");
+    BOOST_CHECK_EQUAL(write_number(5e-324, 18), "0");
+    BOOST_CHECK_EQUAL(write_number(1.0, 3), "1");
+    BOOST_CHECK_EQUAL(write_number(0.1, 3), "0.1");
+    BOOST_CHECK_EQUAL(write_number(-0.0001, 2), "0");
+    BOOST_CHECK_EQUAL(write_number(-0.006, 2), "-0.01");
+    BOOST_CHECK_EQUAL(write_number(0.5, 6), "0.5");
+    BOOST_CHECK_EQUAL(write_number(1e20, 3), "100000000000000000000");
+    BOOST_CHECK_EQUAL(write_number(12, 2), "12");
+}
+
+template <typename G>
+void test_write_same(std::string const& wkt)
+{
+    G geometry;
+    bg::read_wkt(wkt, geometry);
+
+    std::ostringstream out;
+    out << bg::wkt(geometry);
+
+    std::string buffer = "prefix ";
+    bg::write_wkt(geometry, buffer);
+    BOOST_CHECK_EQUAL(buffer, "prefix " + out.str());
+}
+
+void test_write_geometries()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef bg::model::linestring<P> linestring;
+    typedef bg::model::polygon<P> polygon;
+
+    test_write_same<P>("POINT(1 2)");
+    test_write_same<linestring>("LINESTRING(1 2,3 4)");
+    test_write_same<bg::model::ring<P> >("POLYGON((0 0,0 1,1 1,1 0))");
+    test_write_same<polygon>("POLYGON((0 0,0 5,5 5,5 0,0 0),(1 1,2 1,2 2,1 1))");
+    test_write_same<bg::model::polygon<P, true, false> >("POLYGON((0 0,0 5,5 5,5 0))");
+    test_write_same<bg::model::multi_point<P> >("MULTIPOINT((1 2),(3 4))");
+    test_write_same<bg::model::multi_linestring<linestring> >("MULTILINESTRING((1 2,3 4),(5 6,7 8))");
+    test_write_same<bg::model::multi_polygon<polygon> >("MULTIPOLYGON(((0 0,0 1,1 1,0 0)),((2 2,2 3,3 3,2 2)))");
+    test_write_same<bg::model::box<P> >("BOX(1 2,3 4)");
+    test_write_same<bg::model::segment<P> >("SEGMENT(1 2,3 4)");
+
+    boost::variant<P, linestring> v = linestring();
+    bg::read_wkt("LINESTRING(0.1 0.2,1e-7 1e30)", boost::get<linestring>(v));
+    std::string buffer;
+    bg::write_wkt(v, buffer);
+    BOOST_CHECK_EQUAL(buffer, "LINESTRING(0.1 0.2,1e-7 1e30)");
+
+    buffer.clear();
+    bg::write_wkt(v, buffer, 2);
+    BOOST_CHECK_EQUAL(buffer, "LINESTRING(0.1 0.2,0 1e30)");
+
+    std::vector<linestring> lines(3);
+    for (std::size_t i = 0; i < lines.size(); ++i)
+    {
+        bg::append(lines[i], P(i, 0.5));
+        bg::append(lines[i], P(0.25, i));
+    }
+    buffer.clear();
+    bg::write_wkt_range(lines, buffer);
+    BOOST_CHECK_EQUAL(buffer, "LINESTRING(0 0.5,0.25 0)\n"
+                              "LINESTRING(1 0.5,0.25 1)\n"
+                              "LINESTRING(2 0.5,0.25 2)");
+
+    // read back
+    std::vector<linestring> read;
+    char const* first = buffer.data();
+    char const* const last = first + buffer.size();
+    while (first != last)
+    {
+        char const* eol = std::find(first, last, '\n');
+        read.push_back(linestring());
+        bg::read_wkt(first, eol, read.back());
+        first = eol == last ? last : eol + 1;
+    }
+    BOOST_CHECK_EQUAL(read.size(), 3u);
+    BOOST_CHECK(bg::equals(read[2], lines[2]));
+}
+
+void test_reader()
+{
+    typedef bg::model::point<double, 2, bg::cs::cartesian> P;
+    typedef bg::model::polygon<P> polygon;
+
+    std::string const text = "POLYGON((0 0,0 5,5 5,5 0,0 0),(1 1,2 1,2 2,1 1))\n"
+                             "  POLYGON((0 0,0 1,1 1,0 0))\r\n"
+                             "POLYGON((0 0,0 1,x))\n"
+                             "polygon((2 2,2 3,3 3,2 2))\n\n";
+
+    bg::wkt_reader reader(text.data(), text.data() + text.size());
+    polygon poly;
+    BOOST_CHECK(reader.next(poly));
+    BOOST_CHECK_EQUAL(bg::num_points(poly), 9u);
+    BOOST_CHECK(reader.next(poly));
+    BOOST_CHECK_EQUAL(bg::num_points(poly), 4u);
+    BOOST_CHECK_EQUAL(poly.inners().size(), 0u);
+
+    std::size_t offset = 0;
+    std::string context;
+    try
+    {
+        reader.next(poly);
+    }
+    catch(bg::read_wkt_buffer_exception const& e)
+    {
+        offset = e.offset();
+        context = e.what();
+    }
+    BOOST_CHECK_EQUAL(offset, text.find('x'));
+    BOOST_CHECK(context.find("POLYGON((0 0,0 1,x))") != std::string::npos);
+    BOOST_CHECK(context.find("POLYGON((0 0,0 5") == std::string::npos);
+
+    reader.skip_line();
+    BOOST_CHECK(reader.next(poly));
+    BOOST_CHECK(bg::equals(poly.outer()[1], P(2, 3)));
+    BOOST_CHECK(! reader.next(poly));
+    BOOST_CHECK_EQUAL(reader.offset(), text.size());
+
+    // other geometry types and an empty buffer
+    std::string const points = "POINT(1 2) POINT(3 4)";
+    bg::wkt_reader point_reader(points.data(), points.data() + points.size());
+    P p;
+    BOOST_CHECK(point_reader.next(p) && bg::equals(p, P(1, 2)));
+    BOOST_CHECK(point_reader.next(p) && bg::equals(p, P(3, 4)));
+    BOOST_CHECK(! point_reader.next(p));
+
+    bg::wkt_reader empty_reader(points.data(), points.data());
+    BOOST_CHECK(! empty_reader.next(p));
+}
+
+int test_main(int, char* [])
+{
+    test_numbers<double>();
+    test_numbers<float>();
+    test_numbers<long double>();
+    test_geometries<bg::model::point<double, 2, bg::cs::cartesian> >();
+    test_geometries<bg::model::point<float, 2, bg::cs::cartesian> >();
+    test_integers();
+    test_reuse<double>();
+    test_reader();
+
+    test_write_numbers();
+    test_write_fixed();
+    test_write_round_trip<double>();
+    test_write_round_trip<float>();
+    test_write_geometries();
+
+    return 0;
+}
@@ -0,0 +1,162 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/shared_grids.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+
+struct ntv2_writer
+{
+    explicit ntv2_writer(std::string const& filename, boost::int32_t num_files)
+        : os(filename.c_str(), std::ios::binary)
+    {
+        char header[11 * 16];
+        std::memset(header, ' ', sizeof(header));
+        set(header, 0, "NUM_OREC", boost::int32_t(11));
+        set(header, 1, "NUM_SREC", boost::int32_t(11));
+        set(header, 2, "NUM_FILE", num_files);
+        std::memcpy(header + 3 * 16, "GS_TYPE SECONDS ", 16);
+        os.write(header, sizeof(header));
+    }
+
+    // grid of 1 degree cells starting at lon, lat in degrees, with a
+    // constant shift of the latitude in seconds
+    void add(const char* name, const char* parent,
+             int lon, int lat, int size, double step, float lat_shift)
+    {
+        char header[11 * 16];
+        std::memset(header, ' ', sizeof(header));
+        std::memcpy(header, "SUB_NAME", 8);
+        std::memcpy(header + 8, name, std::strlen(name));
+        std::memcpy(header + 16, "PARENT  ", 8);
+        std::memcpy(header + 24, parent, std::strlen(parent));
+
+        boost::int32_t const lim = boost::int32_t(size / step + 0.5) + 1;
+        set(header, 4, "S_LAT   ", lat * 3600.0);
+        set(header, 5, "N_LAT   ", (lat + size) * 3600.0);
+        // positive west
+        set(header, 6, "E_LONG  ", -(lon + size) * 3600.0);
+        set(header, 7, "W_LONG  ", -lon * 3600.0);
+        set(header, 8, "LAT_INC ", step * 3600.0);
+        set(header, 9, "LONG_INC", step * 3600.0);
+        set(header, 10, "GS_COUNT", lim * lim);
+        os.write(header, sizeof(header));
+
+        float const values[4] = { lat_shift, 0, 0, 0 };
+        for (boost::int32_t i = 0 ; i < lim * lim ; ++i)
+        {
+            os.write(reinterpret_cast<char const*>(values), sizeof(values));
+        }
+    }
+
+    template <typename T>
+    static void set(char * header, int record, const char* name, T const& value)
+    {
+        std::memcpy(header + record * 16, name, 8);
+        std::memset(header + record * 16 + 8, 0, 8);
+        std::memcpy(header + record * 16 + 8, &value, sizeof(T));
+    }
+
+    std::ofstream os;
+};
+
+// parent grid covering 0..4 degrees, children covering cells of 1 degree
+// except the last one, each with a different shift
+void write_ntv2(std::string const& filename)
+{
+    ntv2_writer writer(filename, 16);
+    writer.add("PARENT", "NONE", 0, 0, 4, 1, 100);
+    for (int k = 0 ; k < 15 ; ++k)
+    {
+        char name[9];
+        std::sprintf(name, "CHILD%02d", k);
+        writer.add(name, "PARENT", k % 4, k / 4, 1, 0.5, float(k + 1));
+    }
+}
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+
+template <typename Grids>
+void check_shift(Grids const& grids, bg::srs::transformation<> const& tr,
+                 double lon, double lat, double expected_shift)
+{
+    point_ll pt2;
+    BOOST_CHECK(tr.forward(point_ll(lon, lat), pt2, grids));
+    BOOST_CHECK_SMALL(bg::get<0>(pt2) - lon, 1e-7);
+    BOOST_CHECK_SMALL(bg::get<1>(pt2) - (lat - expected_shift / 3600), 1e-7);
+}
+
+template <typename GridsStorage>
+void test_ntv2(std::string const& filename)
+{
+    using namespace bg::srs;
+
+    transformation<> tr((proj4("+proj=longlat +ellps=GRS80 +nadgrids=" + filename)),
+                        (proj4("+proj=longlat +ellps=WGS84 +datum=WGS84")));
+
+    GridsStorage storage;
+    transformation_grids<GridsStorage> grids = tr.initialize_grids(storage);
+
+    for (int k = 0 ; k < 15 ; ++k)
+    {
+        check_shift(grids, tr, k % 4 + 0.3, k / 4 + 0.6, k + 1);
+        check_shift(grids, tr, k % 4 + 0.9, k / 4 + 0.1, k + 1);
+    }
+
+    // the parent, outside of the children
+    check_shift(grids, tr, 3.5, 3.5, 100);
+
+    // on the edges of the children the first one is used
+    check_shift(grids, tr, 1.0, 0.5, 1);
+    check_shift(grids, tr, 2.5, 1.0, 3);
+    check_shift(grids, tr, 1.0, 1.0, 1);
+
+    // outside of the grids
+    check_shift(grids, tr, 5.0, 1.0, 0);
+
+    // many points at once
+    bg::model::linestring<point_ll> ls, ls2;
+    for (int k = 0 ; k < 15 ; ++k)
+    {
+        ls.push_back(point_ll(k % 4 + 0.5, k / 4 + 0.5));
+    }
+    BOOST_CHECK(tr.forward(ls, ls2, grids));
+    for (int k = 0 ; k < 15 ; ++k)
+    {
+        BOOST_CHECK_SMALL(bg::get<1>(ls2[k]) - (k / 4 + 0.5 - (k + 1) / 3600.0), 1e-7);
+    }
+}
+
+int test_main(int, char*[])
+{
+    std::string const filename = "gridshift_ntv2_test.gsb";
+    write_ntv2(filename);
+
+    test_ntv2<bg::srs::grids_storage<> >(filename);
+    test_ntv2
+        <
+            bg::srs::grids_storage<bg::srs::ifstream_policy, bg::srs::shared_grids>
+        >(filename);
+
+    std::remove(filename.c_str());
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include <boost/cstdint.hpp>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/projections/mapped_file_policy.hpp>
+#include <boost/geometry/srs/transformation.hpp>
+
+
+// ctable2 grid covering -10..10 degrees with a constant shift
+void write_ctable2(std::string const& filename)
+{
+    char header[160];
+    std::memset(header, 0, sizeof(header));
+    std::memcpy(header, "CTABLE V2", 9);
+    std::memcpy(header + 16, "test grid", 9);
+
+    double const ll_del[4] = { -10 * bg::math::d2r<double>(),
+                               -10 * bg::math::d2r<double>(),
+                               5 * bg::math::d2r<double>(),
+                               5 * bg::math::d2r<double>() };
+    boost::int32_t const lim[2] = { 5, 5 };
+    std::memcpy(header + 96, ll_del, sizeof(ll_del));
+    std::memcpy(header + 128, lim, sizeof(lim));
+
+    std::ofstream os(filename.c_str(), std::ios::binary);
+    os.write(header, sizeof(header));
+    for (int i = 0; i < lim[0] * lim[1]; ++i)
+    {
+        float const shift[2] = { 1e-5f, 2e-5f };
+        os.write(reinterpret_cast<char const*>(shift), sizeof(shift));
+    }
+}
+
+void test_stream(std::string const& filename)
+{
+    std::ifstream is(filename.c_str(), std::ios::binary);
+    bg::projections::detail::mapped_file_istream ms;
+    ms.open(filename);
+
+    BOOST_CHECK(is.is_open());
+    BOOST_CHECK(ms.is_open());
+
+    char buf1[100], buf2[100];
+    is.seekg(90);
+    ms.seekg(90);
+    is.read(buf1, 20);
+    ms.read(buf2, 20);
+    BOOST_CHECK_EQUAL(std::streamoff(is.tellg()), std::streamoff(ms.tellg()));
+    BOOST_CHECK(std::memcmp(buf1, buf2, 20) == 0);
+
+    is.seekg(10, std::ios::cur);
+    ms.seekg(10, std::ios::cur);
+    BOOST_CHECK_EQUAL(std::streamoff(is.tellg()), std::streamoff(ms.tellg()));
+
+    // reading past the end
+    is.seekg(-8, std::ios::end);
+    ms.seekg(-8, std::ios::end);
+    is.read(buf1, 20);
+    ms.read(buf2, 20);
+    BOOST_CHECK_EQUAL(is.fail(), ms.fail());
+    BOOST_CHECK_EQUAL(is.gcount(), ms.gcount());
+    BOOST_CHECK(std::memcmp(buf1, buf2, 8) == 0);
+
+    bg::projections::detail::mapped_file_istream missing;
+    missing.open(filename + ".missing");
+    BOOST_CHECK(! missing.is_open());
+    BOOST_CHECK(missing.fail());
+}
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_ll;
+
+template <typename StreamPolicy>
+void test_transformation(std::string const& filename,
+                         point_ll & pt_fwd, point_ll & pt_inv)
+{
+    using namespace bg::srs;
+
+    transformation<> tr((proj4("+proj=longlat +ellps=clrk66 +nadgrids=" + filename)),
+                        (proj4("+proj=longlat +ellps=WGS84 +datum=WGS84")));
+
+    grids_storage<StreamPolicy> storage;
+    transformation_grids<grids_storage<StreamPolicy> > grids
+        = tr.initialize_grids(storage);
+
+    BOOST_CHECK_EQUAL(storage.hgrids.size(), 1u);
+
+    BOOST_CHECK(tr.forward(point_ll(5, 5), pt_fwd, grids));
+    BOOST_CHECK_CLOSE(bg::get<0>(pt_fwd), 5 - 1e-5 * bg::math::r2d<double>(), 0.00001);
+    BOOST_CHECK_CLOSE(bg::get<1>(pt_fwd), 5 - 2e-5 * bg::math::r2d<double>(), 0.00001);
+
+    BOOST_CHECK(tr.inverse(pt_fwd, pt_inv, grids));
+}
+
+int test_main(int, char*[])
+{
+    std::string const filename = "mapped_file_policy_test.ct2";
+    write_ctable2(filename);
+
+    test_stream(filename);
+    point_ll fwd1, inv1, fwd2, inv2;
+    test_transformation<bg::srs::ifstream_policy>(filename, fwd1, inv1);
+    test_transformation<bg::srs::mapped_file_policy>(filename, fwd2, inv2);
+
+    BOOST_CHECK(bg::equals(fwd1, fwd2));
+    BOOST_CHECK(bg::equals(inv1, inv2));
+
+    std::remove(filename.c_str());
+
+    return 0;
+}
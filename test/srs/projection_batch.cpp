@@ -0,0 +1,107 @@
+// Boost.Geometry
+// Unit Test
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/srs/projection.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::geographic<bg::radian> > point_ll;
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_xy;
+
+template <typename Projection>
+void test_batch(Projection const& prj, bool invertible = true)
+{
+    std::vector<double> lons, lats;
+    for (int lat = -60; lat <= 60; lat += 15)
+    {
+        for (int lon = -9; lon <= 9; lon += 3)
+        {
+            lons.push_back(lon * bg::math::d2r<double>());
+            lats.push_back(lat * bg::math::d2r<double>());
+        }
+    }
+
+    std::size_t const count = lons.size();
+    std::vector<double> xs(count), ys(count);
+
+    BOOST_CHECK(prj.forward(&lons[0], &lats[0], &xs[0], &ys[0], count));
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        point_xy xy;
+        BOOST_CHECK(prj.forward(point_ll(lons[i], lats[i]), xy));
+        BOOST_CHECK_EQUAL(xs[i], bg::get<0>(xy));
+        BOOST_CHECK_EQUAL(ys[i], bg::get<1>(xy));
+    }
+
+    if (! invertible)
+    {
+        std::vector<double> lons2(count), lats2(count);
+        BOOST_CHECK_THROW(prj.inverse(&xs[0], &ys[0], &lons2[0], &lats2[0], count),
+                          bg::projection_not_invertible_exception);
+        return;
+    }
+
+    std::vector<double> lons2(count), lats2(count);
+    BOOST_CHECK(prj.inverse(&xs[0], &ys[0], &lons2[0], &lats2[0], count));
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        point_ll ll;
+        BOOST_CHECK(prj.inverse(point_xy(xs[i], ys[i]), ll));
+        BOOST_CHECK_EQUAL(lons2[i], bg::get<0>(ll));
+        BOOST_CHECK_EQUAL(lats2[i], bg::get<1>(ll));
+        BOOST_CHECK_SMALL(lons2[i] - lons[i], 1e-6);
+        BOOST_CHECK_SMALL(lats2[i] - lats[i], 1e-6);
+    }
+}
+
+void test_invalid()
+{
+    bg::srs::projection<> prj = bg::srs::proj4("+proj=merc +ellps=WGS84");
+
+    double const lons[3] = { 0.1, 0.2, 0.3 };
+    double const lats[3] = { 0.1, bg::math::half_pi<double>(), 2.0 };
+    double xs[3], ys[3];
+
+    BOOST_CHECK(! prj.forward(lons, lats, xs, ys, 3));
+    BOOST_CHECK(xs[0] != HUGE_VAL && ys[0] != HUGE_VAL);
+    BOOST_CHECK(xs[1] == HUGE_VAL && ys[1] == HUGE_VAL);
+    BOOST_CHECK(xs[2] == HUGE_VAL && ys[2] == HUGE_VAL);
+}
+
+int test_main(int, char*[])
+{
+    using namespace bg::srs;
+
+    test_batch(projection<>(proj4("+proj=tmerc +ellps=WGS84 +lon_0=3")));
+    test_batch(projection<>(proj4("+proj=tmerc +R=6371000")));
+    test_batch(projection<>(proj4("+proj=merc +ellps=WGS84 +x_0=1000 +y_0=2000")));
+    test_batch(projection<>(proj4("+proj=lcc +ellps=WGS84 +lat_1=33 +lat_2=45 +lon_0=-5")));
+    test_batch(projection<>(proj4("+proj=aea +ellps=GRS80 +lat_1=29.5 +lat_2=45.5 +units=km")));
+    test_batch(projection<>(proj4("+proj=laea +ellps=WGS84 +lat_0=45")));
+    test_batch(projection<>(proj4("+proj=august +R=6371000")), false);
+
+    {
+        using namespace bg::srs::spar;
+        test_batch(projection<parameters<proj_tmerc, ellps_wgs84> >());
+        test_batch(projection<parameters<proj_merc, ellps_wgs84, units_km> >());
+    }
+
+    test_invalid();
+
+    return 0;
+}
@@ -1,7 +1,7 @@
 // Boost.Geometry
 // Unit Test
 
-// Copyright (c) 2017, Oracle and/or its affiliates.
+// Copyright (c) 2017-2019, Oracle and/or its affiliates.
 // Contributed and/or modified by Adam Wulkiewicz, on behalf of Oracle
 
 // Use, modification and distribution is subject to the Boost Software License,
@@ -115,6 +115,65 @@ void test_geometries()
     }*/
 }
 
+// rings of different sizes, transformed with a datum shift, share one
+// buffer of z values
+template <typename T>
+void test_multi_polygon()
+{
+    using namespace boost::geometry;
+    using namespace boost::geometry::srs;
+
+    typedef model::point<T, 2, cs::cartesian> point;
+    typedef model::polygon<point> polygon;
+    typedef model::multi_polygon<polygon> mpolygon;
+
+    transformation<> tr((proj4("+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs")),
+                        (proj4("+proj=longlat +ellps=airy +datum=OSGB36 +no_defs")));
+
+    mpolygon mpoly;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 10,10 10,10 0,0 0),(2 2,4 2,4 4,2 2)),"
+                 "((20 20,20 30,25 35,30 30,30 20,25 15,20 20)))", mpoly);
+    for (std::size_t i = 0; i < mpoly.size(); ++i)
+    {
+        bg::model::ring<point> & outer = mpoly[i].outer();
+        for (std::size_t j = 0; j < outer.size(); ++j)
+        {
+            bg::multiply_value(outer[j], math::d2r<T>());
+        }
+        for (std::size_t k = 0; k < mpoly[i].inners().size(); ++k)
+        {
+            bg::model::ring<point> & inner = mpoly[i].inners()[k];
+            for (std::size_t j = 0; j < inner.size(); ++j)
+            {
+                bg::multiply_value(inner[j], math::d2r<T>());
+            }
+        }
+    }
+
+    mpolygon mpoly2;
+    BOOST_CHECK(tr.forward(mpoly, mpoly2));
+    BOOST_CHECK_EQUAL(bg::num_points(mpoly2), bg::num_points(mpoly));
+
+    mpolygon mpoly3 = mpoly;
+    BOOST_CHECK(tr.forward(mpoly3, mpoly3));
+
+    for (std::size_t i = 0; i < mpoly.size(); ++i)
+    {
+        polygon poly;
+        BOOST_CHECK(tr.forward(mpoly[i], poly));
+        test::check_geometry(mpoly2[i], poly, 0.000001);
+        test::check_geometry(mpoly3[i], poly, 0.000001);
+
+        for (std::size_t j = 0; j < mpoly[i].outer().size(); ++j)
+        {
+            point pt;
+            BOOST_CHECK(tr.forward(mpoly[i].outer()[j], pt));
+            BOOST_CHECK_EQUAL(bg::get<0>(pt), bg::get<0>(mpoly2[i].outer()[j]));
+            BOOST_CHECK_EQUAL(bg::get<1>(pt), bg::get<1>(mpoly2[i].outer()[j]));
+        }
+    }
+}
+
 template <typename P1, typename P2, typename Tr>
 inline void test_combination(Tr const& tr, P1 const& pt,
                              std::string const& expected_fwd,
@@ -179,6 +238,9 @@ int test_main(int, char*[])
 {
     test_geometries<double>();
     test_geometries<float>();
+
+    test_multi_polygon<double>();
+    test_multi_polygon<float>();
     
     test_combinations("+proj=longlat +ellps=WGS84 +datum=WGS84 +no_defs",
                       "+proj=longlat +ellps=airy +datum=OSGB36 +no_defs",
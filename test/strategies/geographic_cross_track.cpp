@@ -0,0 +1,94 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2019 Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/strategies/geographic/distance_cross_track.hpp>
+#include <boost/geometry/strategies/geographic/parameters.hpp>
+
+#include <boost/geometry/geometries/point.hpp>
+
+
+// The distances of points to a prepared segment are equal to the distances
+// calculated for the segment defined by its endpoints
+template <typename FormulaPolicy, typename Point>
+void test_prepared(double lon1, double lat1, double lon2, double lat2)
+{
+    typedef bg::strategy::distance::geographic_cross_track
+        <
+            FormulaPolicy
+        > strategy_type;
+
+    strategy_type strategy;
+
+    Point const p1(lon1, lat1);
+    Point const p2(lon2, lat2);
+
+    typename strategy_type::template prepared_segment<double> const
+        segment = strategy.prepare(p1, p2);
+
+    for (int lon = -180; lon <= 180; lon += 15)
+    {
+        for (int lat = -90; lat <= 90; lat += 15)
+        {
+            Point const p(lon, lat);
+
+            double const expected = strategy.apply(p, p1, p2);
+            double const detected = strategy.apply(p, segment);
+
+            BOOST_CHECK_MESSAGE(expected == detected,
+                "segment: (" << lon1 << " " << lat1 << ", "
+                    << lon2 << " " << lat2 << ")"
+                << " point: (" << lon << " " << lat << ")"
+                << " expected: " << expected
+                << " detected: " << detected);
+        }
+    }
+}
+
+template <typename FormulaPolicy, typename Point>
+void test_segments()
+{
+    test_prepared<FormulaPolicy, Point>(0, 0, 10, 10);
+    test_prepared<FormulaPolicy, Point>(10, 10, 0, 0);
+    test_prepared<FormulaPolicy, Point>(-30, -20, 40, 5);
+    test_prepared<FormulaPolicy, Point>(170, 10, -170, 20);
+    // equatorial
+    test_prepared<FormulaPolicy, Point>(0, 0, 30, 0);
+    // meridian
+    test_prepared<FormulaPolicy, Point>(10, -20, 10, 40);
+    test_prepared<FormulaPolicy, Point>(10, 40, 10, -20);
+    // meridian crossing pole
+    test_prepared<FormulaPolicy, Point>(10, 70, -170, 80);
+    // degenerate
+    test_prepared<FormulaPolicy, Point>(5, 5, 5, 5);
+}
+
+int test_main(int, char* [])
+{
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::degree> > point_deg;
+    typedef bg::model::point<double, 2, bg::cs::geographic<bg::radian> > point_rad;
+
+    test_segments<bg::strategy::andoyer, point_deg>();
+    test_segments<bg::strategy::thomas, point_deg>();
+    test_segments<bg::strategy::vincenty, point_deg>();
+
+    // radian
+    {
+        typedef bg::strategy::distance::geographic_cross_track<> strategy_type;
+        strategy_type strategy;
+        double const d2r = bg::math::d2r<double>();
+        point_rad const p1(0, 0), p2(10 * d2r, 10 * d2r), p(2 * d2r, 8 * d2r);
+        BOOST_CHECK_EQUAL(strategy.apply(p, p1, p2),
+                          strategy.apply(p, strategy.prepare(p1, p2)));
+    }
+
+    return 0;
+}
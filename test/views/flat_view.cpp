@@ -0,0 +1,233 @@
+// Boost.Geometry (aka GGL, Generic Geometry Library)
+// Unit Test
+
+// Copyright (c) 2019, Oracle and/or its affiliates.
+
+// Use, modification and distribution is subject to the Boost Software License,
+// Version 1.0. (See accompanying file LICENSE_1_0.txt or copy at
+// http://www.boost.org/LICENSE_1_0.txt)
+
+#include <vector>
+
+#include <geometry_test_common.hpp>
+
+#include <boost/geometry/algorithms/area.hpp>
+#include <boost/geometry/algorithms/centroid.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/equals.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/is_valid.hpp>
+#include <boost/geometry/algorithms/length.hpp>
+#include <boost/geometry/algorithms/num_points.hpp>
+#include <boost/geometry/algorithms/perimeter.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+#include <boost/geometry/geometries/geometries.hpp>
+#include <boost/geometry/io/wkt/read.hpp>
+#include <boost/geometry/strategies/strategies.hpp>
+#include <boost/geometry/views/flat_view.hpp>
+
+
+typedef bg::model::point<double, 2, bg::cs::cartesian> point_type;
+typedef bg::model::box<point_type> box_type;
+typedef bg::model::linestring<point_type> linestring_type;
+typedef bg::model::polygon<point_type> polygon_type;
+typedef bg::model::multi_linestring<linestring_type> multi_linestring_type;
+typedef bg::model::multi_polygon<polygon_type> multi_polygon_type;
+
+// Flattens model geometries into a column of interleaved coordinates,
+// ring offsets and polygon offsets
+struct column
+{
+    column()
+    {
+        ring_offsets.push_back(0);
+        polygon_offsets.push_back(0);
+    }
+
+    void add(linestring_type const& ls)
+    {
+        for (std::size_t i = 0; i < ls.size(); i++)
+        {
+            coordinates.push_back(bg::get<0>(ls[i]));
+            coordinates.push_back(bg::get<1>(ls[i]));
+        }
+        ring_offsets.push_back(boost::int32_t(coordinates.size() / 2));
+    }
+
+    template <typename Ring>
+    void add_ring(Ring const& ring)
+    {
+        add(linestring_type(boost::begin(ring), boost::end(ring)));
+    }
+
+    void add(polygon_type const& poly)
+    {
+        add_ring(poly.outer());
+        for (std::size_t i = 0; i < poly.inners().size(); i++)
+        {
+            add_ring(poly.inners()[i]);
+        }
+        polygon_offsets.push_back(boost::int32_t(ring_offsets.size() - 1));
+    }
+
+    std::vector<double> coordinates;
+    std::vector<boost::int32_t> ring_offsets;
+    std::vector<boost::int32_t> polygon_offsets;
+};
+
+void test_point()
+{
+    double const xyz[] = { 1, 2, 3, 4, 5, 6 };
+
+    typedef bg::flat_point<double, 2, bg::cs::cartesian, 3> xy_of_xyz;
+    bg::flat_linestring_view<xy_of_xyz> ls(xyz, 2);
+    BOOST_CHECK_EQUAL(boost::size(ls), 2u);
+    BOOST_CHECK_EQUAL(bg::get<0>(*(boost::begin(ls) + 1)), 4.0);
+    BOOST_CHECK_EQUAL(bg::get<1>(*(boost::begin(ls) + 1)), 5.0);
+    BOOST_CHECK_EQUAL(boost::begin(ls)->get<0>(), 1.0);
+    BOOST_CHECK_CLOSE(bg::length(ls), std::sqrt(18.0), 0.0001);
+
+    bg::flat_multi_point_view<> mp(xyz, 3);
+    BOOST_CHECK_EQUAL(bg::num_points(mp), 3u);
+    BOOST_CHECK_CLOSE(bg::distance(mp, point_type(5, 5)), 1.0, 0.0001);
+}
+
+void test_linestring()
+{
+    linestring_type model;
+    bg::read_wkt("LINESTRING(0 0,3 4,3 5,10 5)", model);
+    column c;
+    c.add(model);
+
+    bg::flat_linestring_view<> view(&c.coordinates[0], model.size());
+    BOOST_CHECK_EQUAL(bg::num_points(view), model.size());
+    BOOST_CHECK_CLOSE(bg::length(view), bg::length(model), 0.0001);
+    BOOST_CHECK(bg::intersects(view, point_type(3, 4.5)));
+
+    // the last segment only
+    bg::flat_linestring_view<> last(&c.coordinates[4], 2);
+    BOOST_CHECK(bg::covered_by(last, view));
+    BOOST_CHECK(! bg::equals(last, view));
+    BOOST_CHECK(bg::intersects(last, box_type(point_type(5, 4), point_type(6, 6))));
+    BOOST_CHECK_CLOSE(bg::distance(last, point_type(0, 0)), std::sqrt(34.0), 0.0001);
+
+    box_type box = bg::return_envelope<box_type>(view);
+    BOOST_CHECK(bg::equals(box, bg::return_envelope<box_type>(model)));
+
+    BOOST_CHECK_CLOSE(bg::distance(view, point_type(5, 0)),
+                      bg::distance(model, point_type(5, 0)), 0.0001);
+}
+
+void test_multi_linestring()
+{
+    multi_linestring_type model;
+    bg::read_wkt("MULTILINESTRING((0 0,1 1),(2 2,3 3,4 3),(5 5,6 6))", model);
+    column c;
+    for (std::size_t i = 0; i < model.size(); i++)
+    {
+        c.add(model[i]);
+    }
+
+    bg::flat_multi_linestring_view<> view(&c.coordinates[0], &c.ring_offsets[0],
+                                          model.size());
+    BOOST_CHECK_EQUAL(boost::size(view), 3u);
+    BOOST_CHECK_EQUAL(boost::size(view.at(1)), 3u);
+    BOOST_CHECK_EQUAL(bg::num_points(view), 7u);
+    BOOST_CHECK_CLOSE(bg::length(view), bg::length(model), 0.0001);
+    BOOST_CHECK(bg::intersects(view, point_type(3.5, 3)));
+}
+
+void test_polygon()
+{
+    polygon_type model;
+    bg::read_wkt("POLYGON((0 0,0 10,10 10,10 0,0 0),(1 1,2 1,2 2,1 2,1 1),"
+                 "(5 5,6 5,6 6,5 6,5 5))", model);
+    column c;
+    c.add(model);
+
+    bg::flat_polygon_view<> view(&c.coordinates[0], &c.ring_offsets[0], 3);
+    BOOST_CHECK_EQUAL(boost::size(bg::exterior_ring(view)), 5u);
+    BOOST_CHECK_EQUAL(boost::size(bg::interior_rings(view)), 2u);
+    BOOST_CHECK_EQUAL(bg::num_points(view), bg::num_points(model));
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(view), 2u);
+    BOOST_CHECK_CLOSE(bg::area(view), 98.0, 0.0001);
+    BOOST_CHECK_CLOSE(bg::perimeter(view), bg::perimeter(model), 0.0001);
+    BOOST_CHECK(bg::is_valid(view));
+    BOOST_CHECK(bg::equals(view, model));
+
+    point_type centroid;
+    bg::centroid(view, centroid);
+    point_type expected;
+    bg::centroid(model, expected);
+    BOOST_CHECK_CLOSE(bg::get<0>(centroid), bg::get<0>(expected), 0.0001);
+    BOOST_CHECK_CLOSE(bg::get<1>(centroid), bg::get<1>(expected), 0.0001);
+
+    BOOST_CHECK(bg::within(point_type(3, 3), view));
+    BOOST_CHECK(! bg::within(point_type(1.5, 1.5), view));
+    BOOST_CHECK(bg::covered_by(point_type(0, 5), view));
+    BOOST_CHECK_CLOSE(bg::distance(point_type(12, 5), view), 2.0, 0.0001);
+
+    // open counterclockwise rings
+    double const open_ccw[] = { 0, 0, 4, 0, 4, 4, 0, 4 };
+    boost::int32_t const offsets[] = { 0, 4 };
+    bg::flat_polygon_view<bg::flat_point<>, false, false> open(open_ccw, offsets, 1);
+    BOOST_CHECK_CLOSE(bg::area(open), 16.0, 0.0001);
+    BOOST_CHECK_CLOSE(bg::perimeter(open), 16.0, 0.0001);
+
+    bg::flat_polygon_view<> empty;
+    BOOST_CHECK_EQUAL(bg::num_points(empty), 0u);
+}
+
+void test_multi_polygon()
+{
+    multi_polygon_type model;
+    bg::read_wkt("MULTIPOLYGON(((0 0,0 4,4 4,4 0,0 0),(1 1,2 1,2 2,1 2,1 1)),"
+                 "((10 10,10 12,12 12,12 10,10 10)),"
+                 "((20 0,20 3,23 3,23 0,20 0)))", model);
+    column c;
+    for (std::size_t i = 0; i < model.size(); i++)
+    {
+        c.add(model[i]);
+    }
+
+    bg::flat_multi_polygon_view<> view(&c.coordinates[0], &c.ring_offsets[0],
+                                       &c.polygon_offsets[0], model.size());
+    BOOST_CHECK_EQUAL(boost::size(view), 3u);
+    BOOST_CHECK_EQUAL(bg::num_points(view), bg::num_points(model));
+    BOOST_CHECK_CLOSE(bg::area(view), bg::area(model), 0.0001);
+    BOOST_CHECK_CLOSE(bg::perimeter(view), bg::perimeter(model), 0.0001);
+    BOOST_CHECK(bg::is_valid(view));
+    BOOST_CHECK(bg::equals(view, model));
+    BOOST_CHECK(bg::within(point_type(11, 11), view));
+    BOOST_CHECK(! bg::within(point_type(15, 15), view));
+
+    box_type box = bg::return_envelope<box_type>(view);
+    BOOST_CHECK(bg::equals(box, bg::return_envelope<box_type>(model)));
+
+    // the view is also a column of polygons
+    for (std::size_t i = 0; i < model.size(); i++)
+    {
+        BOOST_CHECK_CLOSE(bg::area(view.at(i)), bg::area(model[i]), 0.0001);
+        BOOST_CHECK(bg::equals(view.at(i), model[i]));
+    }
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(view.at(0)), 1u);
+    BOOST_CHECK_EQUAL(bg::num_interior_rings(view.at(2)), 0u);
+
+    // features starting in the middle of the column
+    bg::flat_multi_polygon_view<> tail(&c.coordinates[0], &c.ring_offsets[0],
+                                       &c.polygon_offsets[1], 2);
+    BOOST_CHECK_CLOSE(bg::area(tail), 13.0, 0.0001);
+}
+
+int test_main(int, char* [])
+{
+    test_point();
+    test_linestring();
+    test_multi_linestring();
+    test_polygon();
+    test_multi_polygon();
+
+    return 0;
+}